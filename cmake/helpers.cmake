@@ -139,6 +139,164 @@ function(generate_bin_hex_from_target target)
 
 endfunction()
 
+# Script generating flash image with compressed initializers of data sections
+set(STM_UTILS_COMPRESS_DATA_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/../src/device/scripts/compress_data.py)
+
+# -----------------------------------------------------------------------------
+# @brief Produces .hex and .bin files from ELF target with compressed
+#    initializers of data sections (requires STARTUP_COMPRESSED_DATA option
+#    of the device library to be enabled)
+#
+# @param target
+#    name of the ELF target
+# @param HEX_NAME
+#    name of the resulting .hex file
+# @param BIN_NAME
+#    name of the resulting .bin file
+# -----------------------------------------------------------------------------
+function(generate_compressed_bin_hex_from_target target)
+
+    # -------------------------- Parse arguments -------------------------
+
+    # Single-value arguments
+    set(SINGLE_ARGUMENTS
+        HEX_NAME
+        BIN_NAME
+    )
+
+    # Set arg prefix
+    set(ARG_PREFIX "ARG")
+    # Parse arguments
+    cmake_parse_arguments(${ARG_PREFIX}
+        ""
+        "${SINGLE_ARGUMENTS}"
+        ""
+        ${ARGN}
+    )
+
+    # --------------------------------------------------------------------
+
+    # Find Python interpreter
+    find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+    # Generate .hex and .bin binaries
+    add_custom_command(TARGET ${target} POST_BUILD
+        COMMAND ${Python3_EXECUTABLE} ${STM_UTILS_COMPRESS_DATA_SCRIPT}
+            $<TARGET_FILE:${target}>
+            --output ${CMAKE_BINARY_DIR}/${ARG_BIN_NAME}
+            --hex    ${CMAKE_BINARY_DIR}/${ARG_HEX_NAME}
+        COMMENT "Building ${ARG_HEX_NAME} (compressed)
+                Building ${ARG_BIN_NAME} (compressed)"
+    )
+
+endfunction()
+
+# Script generating code placement scripts from the profile of the application
+set(STM_UTILS_CODE_PLACEMENT_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/../src/device/scripts/code_placement.py)
+
+# -----------------------------------------------------------------------------
+# @brief Places functions of the ELF target according to the function-level
+#    profile of the application. The hottest functions are moved to ITCM,
+#    CCM RAM and main RAM up to the given budgets and the remaining profiled
+#    functions are clustered at the start of the .text section (requires
+#    the default linker script)
+#
+# @param target
+#    name of the ELF target
+# @param PROFILE
+#    path to the profile (PC samples or counters of functions, see
+#    scripts/code_placement.py)
+# @param ELF
+#    path to the profiled ELF file (linked with the default placement)
+# @param ITCM_BUDGET
+#    size of code moved to ITCM RAM [B] (0 by default)
+# @param CCMRAM_BUDGET
+#    size of code moved to CCM RAM [B] (0 by default)
+# @param RAM_BUDGET
+#    size of code moved to main RAM [B] (0 by default)
+# @param EXCLUDE
+#    functions that must not be moved to RAM
+# -----------------------------------------------------------------------------
+function(add_code_placement target)
+
+    # -------------------------- Parse arguments -------------------------
+
+    # Single-value arguments
+    set(SINGLE_ARGUMENTS
+        PROFILE
+        ELF
+        ITCM_BUDGET
+        CCMRAM_BUDGET
+        RAM_BUDGET
+    )
+
+    # Multi-value arguments
+    set(MULTI_ARGUMENTS
+        EXCLUDE
+    )
+
+    # Set arg prefix
+    set(ARG_PREFIX "ARG")
+    # Parse arguments
+    cmake_parse_arguments(${ARG_PREFIX}
+        ""
+        "${SINGLE_ARGUMENTS}"
+        "${MULTI_ARGUMENTS}"
+        ${ARGN}
+    )
+
+    # Default budgets
+    foreach(budget ITCM_BUDGET CCMRAM_BUDGET RAM_BUDGET)
+        if(NOT DEFINED ARG_${budget})
+            set(ARG_${budget} 0)
+        endif()
+    endforeach()
+
+    # Optional exclusions
+    if(ARG_EXCLUDE)
+        set(EXCLUDE_ARGS --exclude ${ARG_EXCLUDE})
+    endif()
+
+    # --------------------------------------------------------------------
+
+    # Find Python interpreter
+    find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+    # Directory of the generated scripts
+    set(PLACEMENT_DIR ${CMAKE_CURRENT_BINARY_DIR}/${target}_placement)
+    set(PLACEMENT_FILES
+        ${PLACEMENT_DIR}/placement_itcm.ld
+        ${PLACEMENT_DIR}/placement_ccmram.ld
+        ${PLACEMENT_DIR}/placement_ram.ld
+        ${PLACEMENT_DIR}/placement_text.ld
+    )
+
+    # Generate placement scripts
+    add_custom_command(OUTPUT ${PLACEMENT_FILES}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${PLACEMENT_DIR}
+        COMMAND ${Python3_EXECUTABLE} ${STM_UTILS_CODE_PLACEMENT_SCRIPT}
+            ${ARG_ELF}
+            ${ARG_PROFILE}
+            --output        ${PLACEMENT_DIR}
+            --itcm-budget   ${ARG_ITCM_BUDGET}
+            --ccmram-budget ${ARG_CCMRAM_BUDGET}
+            --ram-budget    ${ARG_RAM_BUDGET}
+            ${EXCLUDE_ARGS}
+        DEPENDS
+            ${ARG_PROFILE}
+            ${ARG_ELF}
+            ${STM_UTILS_CODE_PLACEMENT_SCRIPT}
+        COMMENT "Generating code placement of ${target}"
+    )
+    add_custom_target(${target}_placement DEPENDS ${PLACEMENT_FILES})
+    add_dependencies(${target} ${target}_placement)
+
+    # Shadow default (empty) placement scripts and relink on their change
+    target_link_options(${target} BEFORE PRIVATE -L${PLACEMENT_DIR})
+    set_property(TARGET ${target} APPEND PROPERTY LINK_DEPENDS ${PLACEMENT_FILES})
+
+endfunction()
+
 # ====================================================================================================================================
 # --------------------------------------------------- MCU-related helper functions ---------------------------------------------------
 # ====================================================================================================================================
@@ -55,7 +55,7 @@ endif()
 # ====================================================================================================================================
 
 # Path to the linker scripts
-set(LINKER_MEMORY_FILE "" CACHE FILEPATH "Path to the linker script defining memory layout"    )
+set(LINKER_MEMORY_FILE "" CACHE FILEPATH "Path to the linker script defining memory layout (generated one by default)")
 set(LINKER_LAYOUT_FILE "" CACHE FILEPATH "Path to the linker script describing sections layout")
 # Path to the toolchain root directory
 set(TOOLCHAIN_ROOT "" CACHE PATH "Path to the root directory of the ARM Embedded Toolchain")
@@ -244,14 +244,49 @@ add_compile_options(
 add_link_options(
     "$<$<CONFIG:DEBUG>:${TOOLCHAIN_LINKER_FLAGS_DEBUG}>"
     "$<$<CONFIG:RELEASE>:${TOOLCHAIN_LINKER_FLAGS_RELEASE}>")
+# Use memory layout generated for the secondary core of dual-core devices by default
+if(${LINKER_MEMORY_FILE} STREQUAL "" AND DEFINED TARGET_CORE AND
+   EXISTS ${CMAKE_CURRENT_LIST_DIR}/../config/linker/memory/${DEVICE}_${TARGET_CORE}.ld)
+    set(LINKER_MEMORY_FILE ${CMAKE_CURRENT_LIST_DIR}/../config/linker/memory/${DEVICE}_${TARGET_CORE}.ld CACHE FILEPATH
+        "Path to the linker script defining memory layout" FORCE)
+endif()
+# Use memory layout generated for the device by default
+if(${LINKER_MEMORY_FILE} STREQUAL "" AND EXISTS ${CMAKE_CURRENT_LIST_DIR}/../config/linker/memory/${DEVICE}.ld)
+    set(LINKER_MEMORY_FILE ${CMAKE_CURRENT_LIST_DIR}/../config/linker/memory/${DEVICE}.ld CACHE FILEPATH
+        "Path to the linker script defining memory layout" FORCE)
+endif()
 # Add memory layout script
 if(NOT ${LINKER_MEMORY_FILE} STREQUAL "")
     add_link_options("SHELL:-T ${LINKER_MEMORY_FILE}")
 endif()
+# Alias auxiliary regions of the default layout script missing in the memory layout (e.g. user scripts defining only
+# `FLASH` and `RAM`) to `RAM`
+if(NOT ${LINKER_MEMORY_FILE} STREQUAL "")
+    file(READ ${LINKER_MEMORY_FILE} LINKER_MEMORY_CONTENT)
+    set(LINKER_FALLBACK_CONTENT "/* Regions missing in ${LINKER_MEMORY_FILE} (generated by cmake/toolchain.cmake) */\n")
+    set(LINKER_FALLBACK_REGIONS "")
+    foreach(region CCMRAM DTCMRAM ITCMRAM SRAM2 SRAM3 BKPSRAM DMARAM BDMARAM AXIRAM)
+        if(NOT LINKER_MEMORY_CONTENT MATCHES "(^|[^A-Za-z0-9_])${region}[ \t]*[(:]" AND
+           NOT LINKER_MEMORY_CONTENT MATCHES "REGION_ALIAS[ \t]*\\([ \t]*\"${region}\"")
+            string(APPEND LINKER_FALLBACK_CONTENT "REGION_ALIAS(\"${region}\", RAM);\n")
+            list(APPEND LINKER_FALLBACK_REGIONS ${region})
+        endif()
+    endforeach()
+    if(NOT "${LINKER_FALLBACK_REGIONS}" STREQUAL "")
+        file(WRITE ${CMAKE_BINARY_DIR}/memory_fallback.ld "${LINKER_FALLBACK_CONTENT}")
+        add_link_options("SHELL:-T ${CMAKE_BINARY_DIR}/memory_fallback.ld")
+    endif()
+endif()
+# Add address windows reachable by DMA masters of the device family (has to precede the sections layout script)
+if(EXISTS ${CMAKE_CURRENT_LIST_DIR}/../config/linker/dma/${DeviceFamily}.ld)
+    add_link_options("SHELL:-T ${CMAKE_CURRENT_LIST_DIR}/../config/linker/dma/${DeviceFamily}.ld")
+endif()
 # Add sections layout script
 if(NOT ${LINKER_LAYOUT_FILE} STREQUAL "")
     add_link_options("SHELL:-T ${LINKER_LAYOUT_FILE}")
 endif()
+# Add default (empty) code placement scripts included by the layout script (shadowed by add_code_placement())
+add_link_options("-L${CMAKE_CURRENT_LIST_DIR}/../config/linker/placement")
 
 # ====================================================================================================================================
 # --------------------------------------------------------------- Tools --------------------------------------------------------------
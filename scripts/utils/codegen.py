@@ -0,0 +1,119 @@
+# ====================================================================================================================================
+# @file       codegen.py
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Saturday, 17th October 2026 6:02:48 pm
+# @modified   Saturday, 17th October 2026 6:02:48 pm
+# @project    stm-utils
+# @brief      Helpers formatting C/C++ sources generated from SVD files
+#
+#
+# @copyright Krzysztof Pierczyk © 2026
+# ====================================================================================================================================
+
+# ============================================================== Doc =============================================================== #
+
+"""
+
+.. module::
+   :platform: Unix, Windows
+   :synopsis: Helpers formatting C/C++ sources generated from SVD files
+
+.. moduleauthor:: Krzysztof Pierczyk <krzysztof.pierczyk@gmail.com>
+
+"""
+
+# ============================================================= Imports ============================================================ #
+
+import datetime
+import re
+
+# ========================================================== Configuration ========================================================= #
+
+# Length of the line in generated files
+LINE_LENGTH = 134
+
+# ============================================================ Functions =========================================================== #
+
+def banner(title=None):
+
+    """Formats section banner (closing banner if @p title is not given)"""
+
+    if title is None:
+        return '/* ' + '=' * (LINE_LENGTH - 6) + ' */'
+    width = LINE_LENGTH - 6 - len(title) - 2
+    return '/* ' + '=' * (width - width // 2) + f' {title} ' + '=' * (width // 2) + ' */'
+
+
+def condition(conditions, directive='#if'):
+
+    """Formats preprocessor @p directive joining @p conditions (wrapped to the line length)"""
+
+    lines, line = [ ], f'{directive} '
+    for i, c in enumerate(conditions):
+        part = c + (' || ' if i < len(conditions) - 1 else '')
+        if len(line) + len(part) > LINE_LENGTH - 2:
+            lines.append(line.rstrip() + ' \\')
+            line = '    '
+        line += part
+    lines.append(line)
+    return '\n'.join(lines)
+
+
+def timestamp(time=None):
+
+    """Formats @p time (current time by default) as the @date field of file headers"""
+
+    time = time or datetime.datetime.now()
+    suffix = 'th' if 11 <= time.day % 100 <= 13 else { 1: 'st', 2: 'nd', 3: 'rd' }.get(time.day % 10, 'th')
+    return f'{time:%A}, {time.day}{suffix} {time:%B %Y} {time.hour % 12 or 12}:{time:%M:%S} {"am" if time.hour < 12 else "pm"}'
+
+
+def header_dates(path, body):
+
+    """Returns @date and @modified fields of the header of the generated file @p path. The @date of the existing file is
+    kept and @modified is updated only if the @p body (content following the header) changes"""
+
+    now = timestamp()
+    try:
+        with open(path) as f:
+            existing = f.read()
+    except OSError:
+        return now, now
+
+    date     = re.search(r'@date\s+(.*)', existing)
+    modified = re.search(r'@modified\s+(.*)', existing)
+    date     = date.group(1).strip() if date is not None else now
+    modified = modified.group(1).strip() if modified is not None and existing.endswith(body) else now
+
+    return date, modified
+
+
+def file_header(name, brief, notes=[ ], dates=None):
+
+    """Formats header comment of the generated file (with @date, @modified and @copyright fields if @p dates are given,
+    see header_dates())"""
+
+    header = [
+        '/* ============================================================================================================================= *//**',
+        f' * @file       {name}',
+        ' * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)',
+        ' * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)',
+    ] + ([
+        f' * @date       {dates[0]}',
+        f' * @modified   {dates[1]}',
+    ] if dates is not None else [ ]) + [
+        ' * @project    stm-utils',
+        f' * @brief      {brief}',
+        ' *',
+    ] + [
+        line for note in notes for line in (f' * @note {note}', ' *')
+    ] + ([
+        f' * @copyright Krzysztof Pierczyk © {re.search(r"[0-9]{4}", dates[0]).group(0)}',
+    ] if dates is not None else [ ]) + [
+        ' * /// ============================================================================================================================ */',
+    ]
+
+    return header
+
+# ================================================================================================================================== #
@@ -0,0 +1,174 @@
+# ====================================================================================================================================
+# @file       elf.py
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Saturday, 17th October 2026 11:03:12 am
+# @modified   Saturday, 17th October 2026 11:03:12 am
+# @project    stm-utils
+# @brief      Minimal ELF files reader
+# 
+# 
+# @copyright Krzysztof Pierczyk © 2026
+# ====================================================================================================================================
+
+# ============================================================== Doc =============================================================== #
+
+""" 
+
+.. module:: 
+   :platform: Unix, Windows
+   :synopsis: Minimal ELF files reader
+
+.. moduleauthor:: Krzysztof Pierczyk <krzysztof.pierczyk@gmail.com>
+
+"""
+
+# ============================================================ Imports ============================================================= #
+
+import struct
+
+# ============================================================ Constants =========================================================== #
+
+# Type of the program header describing loadable segment
+PT_LOAD = 1
+# Type of the section header describing symbols table
+SHT_SYMTAB = 2
+# Type of the section header describing section not occupying space in the file
+SHT_NOBITS = 8
+# Type of the symbol describing function
+STT_FUNC = 2
+
+# ============================================================= Helpers ============================================================ #
+
+class ElfFile:
+
+    """Minimal reader of 32- and 64-bit ELF files providing access to symbols, sections and content of loadable segments"""
+
+    def __init__(self, path):
+
+        """Loads ELF file from @p path"""
+
+        # Read the file
+        with open(path, 'rb') as f:
+            self.data = f.read()
+
+        # Check magic
+        if self.data[:4] != b'\x7fELF':
+            raise Exception(f'{path} is not an ELF file')
+
+        # Parse identification
+        self.is_64   = (self.data[4] == 2)
+        self.endian  = '<' if (self.data[5] == 1) else '>'
+
+        # Parse header
+        if self.is_64:
+            (_, _, _, _, phoff, shoff, _, _, phentsize, phnum, shentsize, shnum, shstrndx) = \
+                self._unpack('HHIQQQIHHHHHH', 16)
+        else:
+            (_, _, _, _, phoff, shoff, _, _, phentsize, phnum, shentsize, shnum, shstrndx) = \
+                self._unpack('HHIIIIIHHHHHH', 16)
+
+        # Parse program headers
+        self.segments = []
+        for i in range(phnum):
+            if self.is_64:
+                (p_type, _, offset, vaddr, paddr, filesz, memsz, _) = self._unpack('IIQQQQQQ', phoff + i * phentsize)
+            else:
+                (p_type, offset, vaddr, paddr, filesz, memsz, _, _) = self._unpack('IIIIIIII', phoff + i * phentsize)
+            self.segments.append(dict(type=p_type, offset=offset, vaddr=vaddr, paddr=paddr, filesz=filesz, memsz=memsz))
+
+        # Parse section headers
+        self.sections = []
+        for i in range(shnum):
+            if self.is_64:
+                (name, sh_type, _, addr, offset, size, link, _, _, entsize) = \
+                    self._unpack('IIQQQQIIQQ', shoff + i * shentsize)
+            else:
+                (name, sh_type, _, addr, offset, size, link, _, _, entsize) = \
+                    self._unpack('IIIIIIIIII', shoff + i * shentsize)
+            self.sections.append(dict(name=name, type=sh_type, addr=addr, offset=offset, size=size, link=link, entsize=entsize))
+
+        # Resolve names of sections
+        if shstrndx < len(self.sections):
+            for section in self.sections:
+                section['name'] = self._string(self.sections[shstrndx], section['name'])
+
+    def _unpack(self, fmt, offset):
+
+        """Unpacks structure described by @p fmt from @p offset of the file"""
+
+        return struct.unpack_from(self.endian + fmt, self.data, offset)
+
+    def _string(self, strtab, offset):
+
+        """Reads null-terminated string at @p offset in the @p strtab section"""
+
+        start = strtab['offset'] + offset
+        return self.data[start : self.data.index(b'\0', start)].decode('utf-8', errors='replace')
+
+    def symbols(self):
+
+        """Returns dictionary mapping names of symbols to (address, size) pairs"""
+
+        symbols = {}
+
+        # Iterate over symbols tables
+        for section in filter(lambda s: s['type'] == SHT_SYMTAB, self.sections):
+
+            # Get associated strings table
+            strtab = self.sections[section['link']]
+
+            # Parse symbols
+            for i in range(section['size'] // section['entsize']):
+                offset = section['offset'] + i * section['entsize']
+                if self.is_64:
+                    (name, _, _, _, value, size) = self._unpack('IBBHQQ', offset)
+                else:
+                    (name, value, size, _, _, _) = self._unpack('IIIBBH', offset)
+                if name != 0:
+                    symbols[self._string(strtab, name)] = (value, size)
+
+        return symbols
+
+    def functions(self):
+
+        """Returns dictionary mapping names of function symbols to (address, size) pairs (Thumb bit cleared)"""
+
+        functions = {}
+
+        # Iterate over symbols tables
+        for section in filter(lambda s: s['type'] == SHT_SYMTAB, self.sections):
+
+            # Get associated strings table
+            strtab = self.sections[section['link']]
+
+            # Parse symbols
+            for i in range(section['size'] // section['entsize']):
+                offset = section['offset'] + i * section['entsize']
+                if self.is_64:
+                    (name, info, _, _, value, size) = self._unpack('IBBHQQ', offset)
+                else:
+                    (name, value, size, info, _, _) = self._unpack('IIIBBH', offset)
+                if name != 0 and (info & 0xF) == STT_FUNC:
+                    functions[self._string(strtab, name)] = (value & ~1, size)
+
+        return functions
+
+    def section(self, name):
+
+        """Returns header of the section named @p name (or None if there is no such a section)"""
+
+        return next(filter(lambda s: s['name'] == name, self.sections), None)
+
+    def read(self, address, size):
+
+        """Reads @p size bytes at the virtual @p address from the loadable segments of the file (None if not present)"""
+
+        for segment in filter(lambda s: s['type'] == PT_LOAD, self.segments):
+            if segment['vaddr'] <= address and address + size <= segment['vaddr'] + segment['filesz']:
+                start = segment['offset'] + address - segment['vaddr']
+                return self.data[start : start + size]
+
+        return None
+
+# ================================================================================================================================== #
@@ -0,0 +1,375 @@
+# ====================================================================================================================================
+# @file       memory.py
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Saturday, 17th October 2026 10:44:16 pm
+# @modified   Saturday, 17th October 2026 10:44:16 pm
+# @project    stm-utils
+# @brief      Database of on-chip memories of supported devices
+#
+#
+# @copyright Krzysztof Pierczyk © 2026
+# ====================================================================================================================================
+
+# ============================================================== Doc =============================================================== #
+
+"""
+
+.. module::
+   :platform: Unix, Windows
+   :synopsis: Database of on-chip memories of supported devices
+
+.. moduleauthor:: Krzysztof Pierczyk <krzysztof.pierczyk@gmail.com>
+
+"""
+
+# ============================================================ Imports ============================================================= #
+
+import os
+import re
+
+# ========================================================== Configuration ========================================================= #
+
+# Path to the main project's dircetory
+PROJECT_HOME = os.path.join(os.path.dirname(os.path.realpath(__file__)), '../..')
+
+# Directory containing CMSIS device headers (downloaded by src/device/scripts/update.py)
+CMSIS_HOME = os.path.join(PROJECT_HOME, 'src/device/include/device/st')
+
+# Regions used by the default linker script (config/linker/link.ld) in the order of generated definitions. Regions missing
+# on the device are aliased to `RAM`
+LINKER_REGIONS = [ 'FLASH', 'RAM', 'CCMRAM', 'DTCMRAM', 'ITCMRAM', 'SRAM2', 'SRAM3', 'BKPSRAM', 'DMARAM', 'BDMARAM', 'AXIRAM' ]
+
+# Base addresses of memories
+FLASH_BASE       = 0x08000000
+SRAM_BASE        = 0x20000000
+CCMRAM_BASE      = 0x10000000
+SRAM2_L4_BASE    = 0x10000000
+ITCMRAM_BASE     = 0x00000000
+BKPSRAM_BASE     = 0x40024000
+H7_AXISRAM_BASE  = 0x24000000
+H7_D2SRAM_BASE   = 0x30000000
+H7_D3SRAM_BASE   = 0x38000000
+H7_BKPSRAM_BASE  = 0x38800000
+
+# Macros of CMSIS headers holding base addresses of regions (used to cross-check the database)
+CMSIS_BASE_MACROS = {
+    'CCMRAM':  [ 'CCMDATARAM_BASE', 'CCMSRAM_BASE' ],
+    'DTCMRAM': [ 'DTCMRAM_BASE', 'D1_DTCMRAM_BASE' ],
+    'ITCMRAM': [ 'RAMITCM_BASE', 'D1_ITCMRAM_BASE' ],
+    'BKPSRAM': [ 'BKPSRAM_BASE', 'D3_BKPSRAM_BASE' ],
+    'BDMARAM': [ 'D3_SRAM_BASE', 'SRD_SRAM_BASE' ],
+    'SRAM2':   [ 'SRAM2_BASE' ],
+    'SRAM3':   [ 'SRAM3_BASE' ],
+}
+
+# Macros of CMSIS headers holding sizes of regions (used to cross-check the database)
+CMSIS_SIZE_MACROS = {
+    'CCMRAM':  [ 'CCMSRAM_SIZE' ],
+    'SRAM2':   [ 'SRAM2_SIZE' ],
+    'SRAM3':   [ 'SRAM3_SIZE' ],
+}
+
+# Macros of CMSIS headers holding sizes of the first SRAM bank (the `RAM` region may merge it with following banks)
+CMSIS_SRAM1_SIZE_MACROS = [ 'SRAM1_SIZE_MAX', 'SRAM1_SIZE', 'SRAM_SIZE_MAX' ]
+
+# Fields of RCC registers given by SVD files that imply presence of the region (used to cross-check the database)
+SVD_REGION_FIELDS = {
+    'BKPSRAM': [ 'BKPSRAMEN', 'BKPRAMEN' ],
+    'SRAM3':   [ 'SRAM3SMEN' ],
+}
+
+# ============================================================ Helpers ============================================================= #
+
+def _k(size):
+    return size * 1024
+
+
+def _f0(flash, ram):
+    return dict(FLASH=(FLASH_BASE, _k(flash)), RAM=(SRAM_BASE, _k(ram)))
+
+
+def _f4(flash, ram, ccm=0, bkp=False, banks=1):
+    regions = dict(FLASH=(FLASH_BASE, _k(flash)), RAM=(SRAM_BASE, _k(ram)))
+    if ccm:
+        regions['CCMRAM'] = (CCMRAM_BASE, _k(ccm))
+    if bkp:
+        regions['BKPSRAM'] = (BKPSRAM_BASE, _k(4))
+    return dict(regions, banks=banks)
+
+
+def _f7(flash, dtcm, ram):
+    return dict(
+        FLASH=(FLASH_BASE, _k(flash)),
+        RAM=(SRAM_BASE + _k(dtcm), _k(ram)),
+        DTCMRAM=(SRAM_BASE, _k(dtcm)),
+        ITCMRAM=(ITCMRAM_BASE, _k(16)),
+        BKPSRAM=(BKPSRAM_BASE, _k(4)),
+    )
+
+
+def _h7(flash, axi, d2, d3, banks):
+    return dict(
+        FLASH=(FLASH_BASE, _k(flash)),
+        RAM=(H7_AXISRAM_BASE, _k(axi)),
+        DTCMRAM=(SRAM_BASE, _k(128)),
+        ITCMRAM=(ITCMRAM_BASE, _k(64)),
+        DMARAM=(H7_D2SRAM_BASE, _k(d2)),
+        BDMARAM=(H7_D3SRAM_BASE, _k(d3)),
+        BKPSRAM=(H7_BKPSRAM_BASE, _k(4)),
+        banks=banks,
+    )
+
+
+def _l4(flash, sram1, sram2, banks=1, sram2_base=SRAM2_L4_BASE, sram3=0):
+    regions = dict(FLASH=(FLASH_BASE, _k(flash)), RAM=(SRAM_BASE, _k(sram1)), SRAM2=(sram2_base, _k(sram2)))
+    if sram3:
+        # SRAM3 follows the SRAM2's alias placed after SRAM1 (DMA buffers are placed there)
+        regions['SRAM3'] = (SRAM_BASE + _k(sram1 + sram2), _k(sram3))
+        regions['aliases'] = dict(DMARAM='SRAM3')
+    return dict(regions, banks=banks)
+
+
+def _h7_cm4(flash, d2, d3):
+    # Cortex-M4 core of dual-core devices boots from the second flash bank and runs from the D2 SRAM (TCMs are
+    # coupled with the Cortex-M7 core and the AXI SRAM is left to it)
+    return dict(
+        FLASH=(FLASH_BASE + _k(flash // 2), _k(flash // 2)),
+        RAM=(H7_D2SRAM_BASE, _k(d2)),
+        BDMARAM=(H7_D3SRAM_BASE, _k(d3)),
+        BKPSRAM=(H7_BKPSRAM_BASE, _k(4)),
+    )
+
+# ============================================================ Database ============================================================ #
+
+# Memories of devices (device macro pattern -> regions). The database is maintained by hand from reference manuals and
+# datasheets (SVD files do not describe memories) and cross-checked with CMSIS headers and SVD files by
+# scripts/generate_memory.py. Sizes of flash correspond to the largest variant of the device line (as FLASH_END of CMSIS
+# headers does). Main SRAM banks that are contiguous in the address space are merged into the `RAM` region; `banks`
+# gives number of flash banks (split evenly) and `aliases` maps regions missing on the device to other regions than
+# `RAM`
+DATABASE = [
+
+    # F0
+    (r'STM32F03[01]x6|STM32F038xx',             _f0(32, 4)),
+    (r'STM32F04[28].*|STM32F070x6',             _f0(32, 6)),
+    (r'STM32F030x8|STM32F05[18].*',             _f0(64, 8)),
+    (r'STM32F07[0128]xB|STM32F078xx',           _f0(128, 16)),
+    (r'STM32F09[18].*|STM32F030xC',             _f0(256, 32)),
+
+    # F1
+    (r'STM32F100xB',                            _f0(128, 8)),
+    (r'STM32F100xE',                            _f0(512, 32)),
+    (r'STM32F10[12]x6',                         _f0(32, 6)),
+    (r'STM32F10[12]xB',                         _f0(128, 16)),
+    (r'STM32F101xE',                            _f0(512, 48)),
+    (r'STM32F101xG',                            _f4(1024, 80, banks=2)),
+    (r'STM32F103x6',                            _f0(32, 10)),
+    (r'STM32F103xB',                            _f0(128, 20)),
+    (r'STM32F103xE',                            _f0(512, 64)),
+    (r'STM32F103xG',                            _f4(1024, 96, banks=2)),
+    (r'STM32F10[57]xC',                         _f0(256, 64)),
+
+    # F2
+    (r'STM32F2[01][57]xx',                      _f4(1024, 128, bkp=True)),
+
+    # F3
+    (r'STM32F30[12]x8|STM32F318xx',             _f4(64, 16)),
+    (r'STM32F302xC',                            _f4(256, 40)),
+    (r'STM32F303xC|STM32F358xx',                _f4(256, 40, ccm=8)),
+    (r'STM32F303x8|STM32F334x8|STM32F328xx',    _f4(64, 12, ccm=4)),
+    (r'STM32F302xE',                            _f4(512, 64)),
+    (r'STM32F303xE|STM32F398xx',                _f4(512, 64, ccm=16)),
+    (r'STM32F37[38].*',                         _f4(256, 32)),
+
+    # F4
+    (r'STM32F4[01][57]xx',                      _f4(1024, 128, ccm=64, bkp=True)),
+    (r'STM32F4[23][79]xx',                      _f4(2048, 192, ccm=64, bkp=True, banks=2)),
+    (r'STM32F401xC',                            _f4(256, 64)),
+    (r'STM32F401xE',                            _f4(512, 96)),
+    (r'STM32F410.*',                            _f4(128, 32)),
+    (r'STM32F411xE',                            _f4(512, 128)),
+    (r'STM32F446xx',                            _f4(512, 128, bkp=True)),
+    (r'STM32F4[67]9xx',                         _f4(2048, 320, ccm=64, bkp=True, banks=2)),
+    (r'STM32F412.*',                            _f4(1024, 256)),
+    (r'STM32F4[12]3xx',                         _f4(1536, 320)),
+
+    # F7
+    (r'STM32F7[45][56]xx',                      _f7(1024, 64, 256)),
+    (r'STM32F750xx',                            _f7(64, 64, 256)),
+    (r'STM32F7[67][5679]xx',                    dict(_f7(2048, 128, 384), banks=2)),
+    (r'STM32F7[23][23]xx',                      _f7(512, 64, 192)),
+    (r'STM32F730xx',                            _f7(64, 64, 192)),
+
+    # G0
+    (r'STM32G0[78][01]xx',                      _f0(128, 36)),
+    (r'STM32G0[34][01]xx',                      _f0(64, 8)),
+    (r'STM32G0B0xx',                            _f0(512, 144)),
+    (r'STM32G0[BC]1xx',                         _f4(512, 144, banks=2)),
+    (r'STM32G0[56][01]xx',                      _f0(64, 18)),
+
+    # G4
+    (r'STM32G4[34]1xx|STM32GBK1CB',             _f4(128, 22, ccm=10)),
+    (r'STM32G47[134]xx|STM32G484xx',            _f4(512, 96, ccm=32, banks=2)),
+    (r'STM32G491xx|STM32G4A1xx',                _f4(512, 96, ccm=16)),
+
+    # H7
+    (r'STM32H74[2357]xx|STM32H75[357]xx',       _h7(2048, 512, 288, 64, banks=2)),
+    (r'STM32H750xx',                            _h7(128, 512, 288, 64, banks=1)),
+    (r'STM32H7[AB]3xxQ?',                       _h7(2048, 1024, 128, 32, banks=2)),
+    (r'STM32H7B0xxQ?',                          _h7(128, 1024, 128, 32, banks=1)),
+    (r'STM32H72[35]xx|STM32H73[35]xx',          _h7(1024, 320, 32, 16, banks=1)),
+    (r'STM32H730xxQ?',                          _h7(128, 320, 32, 16, banks=1)),
+
+    # L0
+    (r'STM32L010x4|STM32L0[12]1xx',             _f0(16, 2)),
+    (r'STM32L010x6|STM32L0[34]1xx',             _f0(32, 8)),
+    (r'STM32L010x8|STM32L0[56][123]xx',         _f0(64, 8)),
+    (r'STM32L010xB',                            _f0(128, 20)),
+    (r'STM32L0[78][123]xx',                     _f4(192, 20, banks=2)),
+
+    # L1
+    (r'STM32L1[05][012]xB',                     _f0(128, 10)),
+    (r'STM32L1[05][012]xBA',                    _f0(128, 16)),
+    (r'STM32L100xC',                            _f0(256, 16)),
+    (r'STM32L1[56][12]xCA?',                    _f0(256, 32)),
+    (r'STM32L1[56][12]xD',                      _f4(384, 48, banks=2)),
+    (r'STM32L1[56][12]xDX',                     _f4(384, 80, banks=2)),
+    (r'STM32L1[56][12]xE',                      _f4(512, 80, banks=2)),
+
+    # L4 (SRAM2 is kept in a separate region as it may be retained in Standby mode)
+    (r'STM32L4[12]2xx',                         _l4(128, 32, 8)),
+    (r'STM32L43[123]xx|STM32L44[23]xx',         _l4(256, 48, 16)),
+    (r'STM32L45[12]xx|STM32L462xx',             _l4(512, 128, 32)),
+    (r'STM32L47[156]xx|STM32L48[56]xx',         _l4(1024, 96, 32, banks=2)),
+    (r'STM32L496xx|STM32L4A6xx',                _l4(1024, 256, 64, banks=2)),
+    (r'STM32L4[PQ]5xx',                         _l4(1024, 128, 64, banks=2, sram3=128)),
+    (r'STM32L4[RS][579]xx',                     _l4(2048, 192, 64, banks=2, sram3=384)),
+
+    # L5
+    (r'STM32L5[56]2xx',                         _l4(512, 192, 64, banks=2, sram2_base=SRAM_BASE + _k(192))),
+
+    # WL (SRAM2 follows SRAM1)
+    (r'STM32WL[E5][45]xx',                      _l4(256, 32, 32, sram2_base=SRAM_BASE + _k(32))),
+
+    # WB (SRAM2 is shared with the wireless stack of CPU2 and so it is not used by the application by default)
+    (r'STM32WB5[5M]xx',                         _f0(1024, 192)),
+    (r'STM32WB50xx',                            _f0(1024, 64)),
+    (r'STM32WB3[05]xx',                         _f0(512, 32)),
+    (r'STM32WB1[05M]xx',                        _f0(320, 12)),
+
+]
+
+# Memories seen by secondary cores of dual-core devices (device macro pattern, core -> regions)
+CORE_DATABASE = [
+
+    # H7
+    (r'STM32H74[57]xx|STM32H75[57]xx',          'CM4', _h7_cm4(2048, 288, 64)),
+
+]
+
+# ============================================================ Functions =========================================================== #
+
+def device_memory(device, core=None):
+
+    """
+    Returns description of memories of the @p device (as seen by the secondary @p core of dual-core devices if given)
+
+    Returns
+    -------
+    regions
+        map of names of regions to (origin, length) pairs
+    aliases
+        map of names of regions missing on the device to names of regions they are aliased to (other than `RAM`)
+    banks
+        number of flash banks
+    """
+
+    database = DATABASE if core is None else [ (pattern, regions) for pattern, c, regions in CORE_DATABASE if c == core ]
+
+    for pattern, regions in database:
+        if re.fullmatch(pattern, device):
+            regions = dict(regions)
+            banks = regions.pop('banks', 1)
+            aliases = regions.pop('aliases', { })
+            return regions, aliases, banks
+
+    return None, None, None
+
+
+def device_cores(device):
+
+    """Returns list of secondary cores of the @p device described by the database"""
+
+    return [ core for pattern, core, _ in CORE_DATABASE if re.fullmatch(pattern, device) ]
+
+
+def cmsis_check(family, device, regions):
+
+    """
+    Cross-checks @p regions of the @p device against its CMSIS header (if downloaded)
+
+    Returns
+    -------
+    list of detected mismatches (None if the header is not available)
+    """
+
+    path = os.path.join(CMSIS_HOME, f'stm32{family}xx', f'{device.lower()}.h')
+    if not os.path.exists(path):
+        return None
+
+    # Parse definitions of addresses
+    with open(path) as f:
+        macros = { name: int(value, 16) for name, value in re.findall(r'#define\s+(\w+)\s+\(?(?:\(uint32_t\))?\s*(0x[0-9A-Fa-f]+)', f.read()) }
+
+    mismatches = [ ]
+
+    # Check bases of regions
+    for region, names in CMSIS_BASE_MACROS.items():
+        for name in names:
+            if name in macros and region in regions and macros[name] != regions[region][0]:
+                mismatches.append(f'{region} placed at 0x{regions[region][0]:08X} while {name} is 0x{macros[name]:08X}')
+
+    # Check sizes of regions
+    for region, names in CMSIS_SIZE_MACROS.items():
+        for name in names:
+            if name in macros and region in regions and macros[name] != regions[region][1]:
+                mismatches.append(f'{region} is 0x{regions[region][1]:X} bytes long while {name} is 0x{macros[name]:X}')
+
+    # Check size of the main SRAM (that may be merged with following banks)
+    for name in CMSIS_SRAM1_SIZE_MACROS:
+        if name in macros and macros[name] > regions['RAM'][1]:
+            mismatches.append(f'RAM is 0x{regions["RAM"][1]:X} bytes long while {name} is 0x{macros[name]:X}')
+
+    # Check end of the flash
+    if 'FLASH_END' in macros and macros['FLASH_END'] + 1 != regions['FLASH'][0] + regions['FLASH'][1]:
+        mismatches.append(f'FLASH ends at 0x{regions["FLASH"][0] + regions["FLASH"][1]:08X} while FLASH_END is 0x{macros["FLASH_END"]:08X}')
+
+    return mismatches
+
+
+def svd_check(svd, regions):
+
+    """
+    Cross-checks @p regions of the device against its parsed @p svd description (utils.svd.SvdDevice). SVD files do not
+    describe memories but RCC registers control clocks of some of them
+
+    Returns
+    -------
+    list of detected mismatches
+    """
+
+    # Collect fields of RCC registers
+    fields = { field['name'] for register in svd.peripherals.get('RCC', [ ]) for field in register['fields'] }
+
+    mismatches = [ ]
+
+    # Check presence of regions
+    for region, names in SVD_REGION_FIELDS.items():
+        for name in names:
+            if name in fields and region not in regions:
+                mismatches.append(f'{region} is not defined while RCC of the SVD file has the {name} field')
+
+    return mismatches
+
+# ================================================================================================================================== #
@@ -0,0 +1,352 @@
+# ====================================================================================================================================
+# @file       svd.py
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Saturday, 17th October 2026 4:20:05 pm
+# @modified   Saturday, 17th October 2026 4:20:05 pm
+# @project    stm-utils
+# @brief      Minimal reader of SVD files and helpers mapping them to supported devices
+#
+#
+# @copyright Krzysztof Pierczyk © 2026
+# ====================================================================================================================================
+
+# ============================================================== Doc =============================================================== #
+
+"""
+
+.. module::
+   :platform: Unix, Windows
+   :synopsis: Minimal reader of SVD files and helpers mapping them to supported devices
+
+.. moduleauthor:: Krzysztof Pierczyk <krzysztof.pierczyk@gmail.com>
+
+"""
+
+# ============================================================ Imports ============================================================= #
+
+import os
+import re
+import glob
+import xml.etree.ElementTree as ElementTree
+
+# ========================================================== Configuration ========================================================= #
+
+# Path to the main project's dircetory
+PROJECT_HOME = os.path.join(os.path.dirname(os.path.realpath(__file__)), '../..')
+
+# Directory containing SVD files (one subdirectory per family)
+SVD_HOME = os.path.join(PROJECT_HOME, 'config/svd')
+
+# Script listing supported devices
+DEVICES_LIST = os.path.join(PROJECT_HOME, 'cmake/device.cmake')
+
+# SVD files describing devices that have no dedicated file (variants differing only in the memory size or crypto/SMPS/radio
+# peripherals not relevant for mapped data)
+SVD_ALIASES = {
+    'STM32F105': 'STM32F107',
+    'STM32F205': 'STM32F215',
+    'STM32F207': 'STM32F217',
+    'STM32F415': 'STM32F405',
+    'STM32F417': 'STM32F407',
+    'STM32F423': 'STM32F413',
+    'STM32F437': 'STM32F427',
+    'STM32F439': 'STM32F429',
+    'STM32F479': 'STM32F469',
+    'STM32GBK1': 'STM32GBK1CBT6',
+    'STM32H750': 'STM32H743',
+    'STM32L486': 'STM32L476',
+    'STM32L4A6': 'STM32L496',
+    'STM32WB1M': 'STM32WB15',
+    'STM32WB5M': 'STM32WB55',
+    'STM32WLE4': 'STM32WLE5',
+}
+
+# Interrupts missing or misdescribed in SVD files (name of the device -> { number: name }, None removes the interrupt). Entries
+# override interrupts given by the SVD file and are checked against CMSIS headers by scripts/generate_vectors.py
+INTERRUPT_FIXES = {
+    'STM32F0x2': {
+        10: 'DMA1_CH2_3', 11: 'DMA1_CH4_5_6_7',
+    },
+    'STM32F401': {
+        0: 'WWDG', 11: 'DMA1_Stream0', 12: 'DMA1_Stream1', 13: 'DMA1_Stream2',
+        14: 'DMA1_Stream3', 15: 'DMA1_Stream4', 16: 'DMA1_Stream5', 17: 'DMA1_Stream6',
+        47: 'DMA1_Stream7', 56: 'DMA2_Stream0', 57: 'DMA2_Stream1', 58: 'DMA2_Stream2',
+        59: 'DMA2_Stream3', 60: 'DMA2_Stream4', 68: 'DMA2_Stream5', 69: 'DMA2_Stream6',
+        70: 'DMA2_Stream7',
+    },
+    'STM32F405': {
+        4: 'FLASH', 88: None, 89: None,
+    },
+    'STM32F407': {
+        4: 'FLASH', 88: None, 89: None,
+    },
+    'STM32F410': {
+        0: 'WWDG', 11: 'DMA1_Stream0', 12: 'DMA1_Stream1', 13: 'DMA1_Stream2',
+        14: 'DMA1_Stream3', 15: 'DMA1_Stream4', 16: 'DMA1_Stream5', 17: 'DMA1_Stream6',
+        47: 'DMA1_Stream7', 56: 'DMA2_Stream0', 57: 'DMA2_Stream1', 58: 'DMA2_Stream2',
+        59: 'DMA2_Stream3', 60: 'DMA2_Stream4', 68: 'DMA2_Stream5', 69: 'DMA2_Stream6',
+        70: 'DMA2_Stream7', 50: 'TIM5', 25: 'TIM1_UP',
+    },
+    'STM32F412': {
+        12: 'DMA1_Stream1', 43: 'TIM8_BRK_TIM12', 44: 'TIM8_UP_TIM13', 45: 'TIM8_TRG_COM_TIM14',
+        60: 'DMA2_Stream4', 80: 'RNG',
+    },
+    'STM32F413': {
+        0: 'WWDG', 42: 'OTG_FS_WKUP', 67: 'OTG_FS',
+    },
+    'STM32F427': {
+        87: 'SAI1', 88: None, 89: None, 90: 'DMA2D',
+    },
+    'STM32F469': {
+        92: 'DSI',
+    },
+    'STM32F745': {
+        25: 'TIM1_UP_TIM10', 27: 'TIM1_CC', 33: 'I2C2_EV', 34: 'I2C2_ER',
+        52: 'UART4', 71: 'USART6', 72: 'I2C3_EV', 73: 'I2C3_ER',
+        82: 'UART7',
+    },
+    'STM32F750x': {
+        25: 'TIM1_UP_TIM10', 27: 'TIM1_CC', 33: 'I2C2_EV', 34: 'I2C2_ER',
+        52: 'UART4', 71: 'USART6', 72: 'I2C3_EV', 73: 'I2C3_ER',
+        82: 'UART7',
+    },
+    'STM32F765': {
+        25: 'TIM1_UP_TIM10', 27: 'TIM1_CC', 33: 'I2C2_EV', 34: 'I2C2_ER',
+        52: 'UART4', 71: 'USART6', 72: 'I2C3_EV', 73: 'I2C3_ER',
+        82: 'UART7',
+    },
+    'STM32F767': {
+        94: 'HDMI_CEC',
+    },
+    'STM32F769': {
+        25: 'TIM1_UP_TIM10', 27: 'TIM1_CC', 33: 'I2C2_EV', 34: 'I2C2_ER',
+    },
+    'STM32F777': {
+        94: 'HDMI_CEC',
+    },
+    'STM32F779': {
+        25: 'TIM1_UP_TIM10', 27: 'TIM1_CC', 33: 'I2C2_EV', 34: 'I2C2_ER',
+    },
+    'STM32G030': {
+        11: 'DMA1_Ch4_5_DMAMUX1_OVR',
+    },
+    'STM32G031': {
+        11: 'DMA1_Ch4_5_DMAMUX1_OVR', 12: 'ADC1',
+    },
+    'STM32G041': {
+        11: 'DMA1_Ch4_5_DMAMUX1_OVR', 12: 'ADC1',
+    },
+    'STM32G050': {
+        11: 'DMA1_Ch4_7_DMAMUX1_OVR',
+    },
+    'STM32G051': {
+        11: 'DMA1_Ch4_7_DMAMUX1_OVR', 18: 'TIM7_LPTIM2',
+    },
+    'STM32G061': {
+        11: 'DMA1_Ch4_7_DMAMUX1_OVR', 18: 'TIM7_LPTIM2',
+    },
+    'STM32G070': {
+        11: 'DMA1_Ch4_7_DMAMUX1_OVR', 17: 'TIM6', 18: 'TIM7', 29: 'USART3_4',
+    },
+    'STM32G071': {
+        11: 'DMA1_Ch4_7_DMAMUX1_OVR',
+    },
+    'STM32G081': {
+        11: 'DMA1_Ch4_7_DMAMUX1_OVR',
+    },
+    'STM32G0B0': {
+        11: 'DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR', 17: 'TIM6', 29: 'USART3_4_5_6',
+    },
+    'STM32G0B1': {
+        11: 'DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR', 18: 'TIM7_LPTIM2',
+    },
+    'STM32G0C1': {
+        11: 'DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR', 17: 'TIM6_DAC_LPTIM1', 18: 'TIM7_LPTIM2',
+    },
+    'STM32L412': {
+        5: 'RCC',
+    },
+    'STM32L4x3': {
+        26: 'TIM1_TRG_COM', 67: 'USB', 70: 'LPUART1', 79: None,
+        80: 'RNG', 82: 'CRS',
+    },
+    'STM32L4x5': {
+        4: 'FLASH', 19: 'CAN1_TX', 20: 'CAN1_RX0', 21: 'CAN1_RX1',
+        22: 'CAN1_SCE', 70: 'LPUART1', 79: None, 80: 'RNG',
+    },
+    'STM32WB10_CM4': {
+        39: 'TSC',
+    },
+    'STM32WB15_CM4': {
+        39: 'TSC',
+    },
+}
+
+# Macros selecting the core of dual-core devices (listed from the main core)
+CORE_MACROS = {
+    'CM7':  'CORE_CM7',
+    'CM4':  'CORE_CM4',
+    'CM0P': 'CORE_CM0PLUS',
+}
+
+# ============================================================= Helpers ============================================================ #
+
+def _text(element, tag, default=None):
+
+    """Returns stripped text of the @p tag child of the @p element"""
+
+    child = element.find(tag)
+    return child.text.strip() if (child is not None and child.text is not None) else default
+
+
+def _int(text):
+
+    """Parses integer literal of the SVD file"""
+
+    text = text.strip().lower()
+    if text.startswith('#'):
+        return int(text[1:], 2)
+    if text.startswith(('0x', '0b')):
+        return int(text, 0)
+    return int(text, 10)
+
+# ============================================================== Classes =========================================================== #
+
+class SvdDevice:
+
+    """Description of the device parsed from the SVD file (interrupts and registers of peripherals)"""
+
+    def __init__(self, path):
+
+        """Parses SVD file at @p path"""
+
+        root = ElementTree.parse(path).getroot()
+
+        # Name of the device
+        self.name = _text(root, 'name')
+
+        # Interrupts (number -> list of names)
+        self.interrupts = {}
+        for interrupt in root.iter('interrupt'):
+            names = self.interrupts.setdefault(_int(_text(interrupt, 'value')), [])
+            name = _text(interrupt, 'name')
+            if name not in names:
+                names.append(name)
+        for number, name in INTERRUPT_FIXES.get(self.name, { }).items():
+            if name is None:
+                self.interrupts.pop(number, None)
+            else:
+                self.interrupts[number] = [ name ]
+
+        # Peripherals (name -> element)
+        elements = { _text(p, 'name'): p for p in root.iter('peripheral') }
+
+        # Registers of peripherals (name -> [ { name, offset, fields: [ { name, offset, width } ] } ])
+        self.peripherals = {}
+        for name, element in elements.items():
+            registers = element.find('registers')
+            # Use registers of the base peripheral if not given
+            if registers is None and element.get('derivedFrom') in elements:
+                registers = elements[element.get('derivedFrom')].find('registers')
+            self.peripherals[name] = [ ] if registers is None else [
+                dict(
+                    name=_text(register, 'name'),
+                    offset=_int(_text(register, 'addressOffset')),
+                    fields=[ self._field(field) for field in register.iter('field') ]
+                ) for register in registers.iter('register')
+            ]
+
+    @staticmethod
+    def _field(element):
+
+        """Parses bit field"""
+
+        name = _text(element, 'name')
+
+        # Field given with offset and width
+        if element.find('bitOffset') is not None:
+            offset = _int(_text(element, 'bitOffset'))
+            width  = _int(_text(element, 'bitWidth', '1'))
+        # Field given with LSB and MSB
+        elif element.find('lsb') is not None:
+            offset = _int(_text(element, 'lsb'))
+            width  = _int(_text(element, 'msb')) - offset + 1
+        # Field given with range
+        else:
+            msb, lsb = map(int, re.match(r'\[(\d+):(\d+)\]', _text(element, 'bitRange')).groups())
+            offset, width = lsb, msb - lsb + 1
+
+        return dict(name=name, offset=offset, width=width)
+
+# ============================================================ Functions =========================================================== #
+
+def family_devices(family):
+
+    """Returns list of device macros supported for the @p family (as listed in cmake/device.cmake)"""
+
+    with open(DEVICES_LIST) as f:
+        content = f.read()
+
+    # Find list of the family
+    match = re.search(rf'list\(APPEND DEVICES_{family.upper()}\s(.*?)\)', content, re.S)
+    return [ ] if match is None else re.findall(r'"(\w+)"', match.group(1))
+
+
+def family_svd_files(family):
+
+    """
+    Maps devices of the @p family to SVD files describing them
+
+    Returns
+    -------
+    files
+        list of (path, conditions) pairs where conditions is a list of preprocessor expressions (one per device) that
+        select the device (and its core for dual-core devices)
+    unsupported
+        list of device macros that are not described by any SVD file
+    """
+
+    # List SVD files (some files are placed in directories of other families)
+    paths = sorted(glob.glob(os.path.join(SVD_HOME, '*', '*.svd')))
+
+    # Parse names of SVD files into (model pattern, core) pairs
+    models = { }
+    for path in paths:
+        name, _, core = os.path.splitext(os.path.basename(path))[0].partition('_')
+        models[path] = (re.sub(r'x+$', '', name), core)
+
+    files = { path: [ ] for path in paths }
+    unsupported = [ ]
+
+    # Iterate over devices
+    for device in family_devices(family):
+
+        # Find SVD files matching model of the device (`x` stands for any character)
+        def matches(model):
+            return re.match(model.replace('x', '[0-9A-Za-z]'), SVD_ALIASES.get(device[:9], device)) is not None
+        candidates = [ path for path, (model, _) in models.items() if matches(model) ]
+
+        # Select the most specific model
+        if len(candidates) == 0:
+            unsupported.append(device)
+            continue
+        best = min(models[path][0].count('x') for path in candidates)
+        candidates = [ path for path in candidates if models[path][0].count('x') == best ]
+
+        # Select core (the main core of dual-core devices is selected by default)
+        candidates.sort(key=lambda path: list(CORE_MACROS).index(models[path][1]) if models[path][1] else 0)
+        cores = [ models[path][1] for path in candidates ]
+        for path in candidates:
+            core = models[path][1]
+            if len(candidates) == 1:
+                files[path].append(f'defined({device})')
+            elif core == cores[0]:
+                others = ' && '.join(f'!defined({CORE_MACROS[c]})' for c in cores[1:])
+                files[path].append(f'(defined({device}) && {others})')
+            else:
+                files[path].append(f'(defined({device}) && defined({CORE_MACROS[core]}))')
+
+    return [ (path, conditions) for path, conditions in files.items() if len(conditions) > 0 ], unsupported
+
+# ================================================================================================================================== #
@@ -0,0 +1,137 @@
+/* ============================================================================================================================= *//**
+ * @file       benchmark.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 11:58:02 pm
+ * @modified   Saturday, 17th October 2026 11:58:02 pm
+ * @project    stm-utils
+ * @brief      Cycle counting helpers shared by on-target benchmarks of the device library (DEVICE_BENCHMARKS option)
+ * @details    Cycles are counted with the DWT cycle counter where available and with SysTick (counting down from its
+ *    maximal value with the core clock) otherwise, e.g. on Cortex-M0+. With SysTick measured intervals need to be
+ *    shorter than 2^24 cycles. Results are kept in global variables to be read with the debugger once the benchmark
+ *    reaches its final loop.
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_BENCHMARK_H__
+#define __STM_UTILS_BENCHMARK_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <stdbool.h>
+#include "device.h"
+
+/* ========================================================= Configuration ======================================================== */
+
+#if defined(DWT_CTRL_CYCCNTENA_Msk) && defined(CoreDebug_DEMCR_TRCENA_Msk)
+#define BENCHMARK_DWT
+#endif
+
+/* ============================================================= Types ============================================================ */
+
+/// Statistics of the measured operation
+typedef struct benchmark_result {
+
+    /// Number of measurements
+    unsigned long count;
+    /// Minimal duration [cycles]
+    unsigned long min;
+    /// Maximal duration [cycles]
+    unsigned long max;
+    /// Total duration [cycles]
+    unsigned long total;
+
+} benchmark_result;
+
+/* ======================================================= Global variables ======================================================= */
+
+// Cost of two back-to-back reads of the counter (subtracted from measurements) [cycles]
+static unsigned long benchmark_overhead;
+
+/* ========================================================== Definitions ========================================================= */
+
+/**
+ * @returns
+ *    current value of the cycles counter
+ */
+static inline __attribute__((always_inline)) unsigned long benchmark_counter(void) {
+    #ifdef BENCHMARK_DWT
+        return DWT->CYCCNT;
+    #else
+        return SysTick->VAL;
+    #endif
+}
+
+
+/**
+ * @returns
+ *    number of cycles elapsed between the @p start and @p stop values of the counter
+ */
+static inline __attribute__((always_inline)) unsigned long benchmark_elapsed(unsigned long start, unsigned long stop) {
+    #ifdef BENCHMARK_DWT
+        return stop - start;
+    #else
+        return (start >= stop) ? (start - stop) : (start + SysTick_LOAD_RELOAD_Msk + 1 - stop);
+    #endif
+}
+
+
+/**
+ * @brief Starts the cycles counter and measures its overhead
+ *
+ * @note Overwrites configuration of SysTick on cores without the DWT cycle counter
+ */
+static inline void benchmark_init(void) {
+
+    // Enable DWT cycles counter
+    #ifdef BENCHMARK_DWT
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        #if (__CORTEX_M == 7U)
+            DWT->LAR = 0xC5ACCE55UL;
+        #endif
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    // Otherwise, run SysTick from its maximal value with the core clock
+    #else
+        SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+        SysTick->VAL  = 0;
+        SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+    #endif
+
+    // Measure cost of back-to-back reads of the counter
+    unsigned long start = benchmark_counter();
+    unsigned long stop  = benchmark_counter();
+    benchmark_overhead = benchmark_elapsed(start, stop);
+}
+
+
+/**
+ * @brief Accounts measurement of the operation lasting between the @p start and @p stop values of the counter
+ *    in the @p result
+ */
+static inline void benchmark_record(volatile benchmark_result *result, unsigned long start, unsigned long stop) {
+
+    // Compensate for the counter's overhead
+    unsigned long cycles = benchmark_elapsed(start, stop);
+    cycles = (cycles > benchmark_overhead) ? (cycles - benchmark_overhead) : 0;
+
+    // Update statistics
+    if(result->count++ == 0 || cycles < result->min)
+        result->min = cycles;
+    if(cycles > result->max)
+        result->max = cycles;
+    result->total += cycles;
+}
+
+
+/**
+ * @brief Final loop of the benchmark (results are read with the debugger)
+ */
+static inline void __attribute__((noreturn)) benchmark_finish(void) {
+    while(true)
+        __NOP();
+}
+
+/* ================================================================================================================================ */
+
+#endif
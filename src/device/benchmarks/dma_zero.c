@@ -0,0 +1,100 @@
+/* ============================================================================================================================= *//**
+ * @file       dma_zero.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 11:58:02 pm
+ * @modified   Saturday, 17th October 2026 11:58:02 pm
+ * @project    stm-utils
+ * @brief      Benchmark of zeroing memory with the CPU and with the DMA (STARTUP_DMA_MEMORY_INIT option)
+ * @details    Compares the word-by-word zeroing loop with the DMA zeroing of src/startup/dma.c used by the startup code
+ *    for the .dma_bss section. The DMA is measured both end-to-end (startup_dma_zero_begin() followed by
+ *    startup_dma_zero_wait()) and for the time the CPU spends in startup_dma_zero_begin() only, i.e. the CPU time
+ *    consumed before the rest of the zeroing proceeds in the background. Built only with the STARTUP_DMA_MEMORY_INIT
+ *    option enabled. Results are kept in `dma_zero_results`
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "benchmark.h"
+
+/* ========================================================= Configuration ======================================================== */
+
+// Size of the zeroed buffer [words] (the DMA zeroes the 32-byte aligned part of it, the CPU zeroes the edges)
+#define DMA_ZERO_WORDS 2050
+// Number of measurements of each routine
+#define DMA_ZERO_SAMPLES 16
+
+/* ========================================================= Declarations ========================================================= */
+
+// Starts zeroing of the range with the DMA (defined in src/startup/dma.c)
+extern void startup_dma_zero_begin(unsigned long *start, unsigned long *end);
+
+/* ============================================================= Types ============================================================ */
+
+/// Results of the benchmark
+typedef struct dma_zero_benchmark {
+
+    /// Word-by-word zeroing with the CPU
+    benchmark_result cpu;
+    /// Zeroing with the DMA (until the transfer completes)
+    benchmark_result dma;
+    /// Time spent by the CPU to start zeroing with the DMA
+    benchmark_result dma_begin;
+
+} dma_zero_benchmark;
+
+/* ======================================================= Global variables ======================================================= */
+
+// Results of the benchmark
+volatile dma_zero_benchmark dma_zero_results;
+
+/* ======================================================= Static variables ======================================================= */
+
+// Zeroed buffer (offset by one word so that edges zeroed by the CPU are included in the measurement)
+static unsigned long buffer[DMA_ZERO_WORDS + 1] __attribute__ ((aligned(32)));
+
+/* ====================================================== Static definitions ====================================================== */
+
+/**
+ * @brief Fills the [@p dst, @p end) range with zeros word by word (keeps the compiler from replacing the loop with
+ *    memset() call)
+ */
+__attribute__ ((noinline, optimize("no-tree-loop-distribute-patterns")))
+static void cpu_zero(unsigned long *dst, const unsigned long *end) {
+    while(dst < end)
+        *(dst++) = 0;
+}
+
+/* ========================================================== Definitions ========================================================= */
+
+int main(void) {
+
+    benchmark_init();
+
+    unsigned long *start = &buffer[1];
+    unsigned long *end   = &buffer[1 + DMA_ZERO_WORDS];
+
+    for(unsigned i = 0; i < DMA_ZERO_SAMPLES; ++i) {
+
+        // Measure zeroing with the CPU
+        unsigned long cpu_start = benchmark_counter();
+        cpu_zero(start, end);
+        unsigned long cpu_stop = benchmark_counter();
+        benchmark_record(&dma_zero_results.cpu, cpu_start, cpu_stop);
+
+        // Measure zeroing with the DMA
+        unsigned long dma_start = benchmark_counter();
+        startup_dma_zero_begin(start, end);
+        unsigned long dma_started = benchmark_counter();
+        startup_dma_zero_wait();
+        unsigned long dma_stop = benchmark_counter();
+        benchmark_record(&dma_zero_results.dma_begin, dma_start, dma_started);
+        benchmark_record(&dma_zero_results.dma,       dma_start, dma_stop);
+    }
+
+    benchmark_finish();
+}
+
+/* ================================================================================================================================ */
@@ -0,0 +1,159 @@
+/* ============================================================================================================================= *//**
+ * @file       exti_dispatch.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 11:58:02 pm
+ * @modified   Saturday, 17th October 2026 11:58:02 pm
+ * @project    stm-utils
+ * @brief      Benchmark of the EXTI dispatchers (cycles from pending EXTI lines to the return of the last line's handler)
+ * @details    Handlers of EXTI lines 5-15 are registered with exti_register_line_handler(), lines are unmasked in EXTI
+ *    and pended at once by a single write to the software interrupt event register. Each handler clears its line and
+ *    stamps the counter as its last statement, so that the stamp left by the last dispatched line marks the end of
+ *    the dispatch. The EXTI15_10 dispatcher (EXTI4_15 on Cortex-M0/M0+ families, using the de Bruijn lookup of the
+ *    lowest line) is measured with 1, 2 and 6 lines pending (10, 10-11 and 10-15) and the EXTI9_5 dispatcher (where
+ *    present) with 1, 2 and 5 lines pending (5, 5-6 and 5-9). Results are kept in `exti_dispatch_results`
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "benchmark.h"
+
+/* ========================================================= Configuration ======================================================== */
+
+// Number of measurements of each case
+#define EXTI_DISPATCH_SAMPLES 1000
+
+// Dispatchers of the measured lines
+#if defined(STM32MCU_MAJOR_TYPE_F0) || defined(STM32MCU_MAJOR_TYPE_G0) || defined(STM32MCU_MAJOR_TYPE_L0)
+#define EXTI_DISPATCH_UPPER_IRQn EXTI4_15_IRQn
+#elif defined(STM32MCU_MAJOR_TYPE_WL) && defined(CORE_CM0PLUS)
+#define EXTI_DISPATCH_UPPER_IRQn EXTI15_4_IRQn
+#else
+#define EXTI_DISPATCH_UPPER_IRQn EXTI15_10_IRQn
+#define EXTI_DISPATCH_LOWER_IRQn EXTI9_5_IRQn
+#endif
+
+// Registers of the EXTI lines for the current core (mask, software trigger and pending flags)
+#if defined(STM32MCU_MAJOR_TYPE_G0)
+#define EXTI_IMR   (EXTI->IMR1)
+#define EXTI_SWIER (EXTI->SWIER1)
+#define EXTI_PR    (EXTI->RPR1)
+#elif defined(STM32MCU_MAJOR_TYPE_H7) && defined(CORE_CM4)
+#define EXTI_IMR   (EXTI_D2->IMR1)
+#define EXTI_SWIER (EXTI->SWIER1)
+#define EXTI_PR    (EXTI_D2->PR1)
+#elif defined(STM32MCU_MAJOR_TYPE_H7)
+#define EXTI_IMR   (EXTI_D1->IMR1)
+#define EXTI_SWIER (EXTI->SWIER1)
+#define EXTI_PR    (EXTI_D1->PR1)
+#elif defined(STM32MCU_MAJOR_TYPE_WL) && defined(CORE_CM0PLUS)
+#define EXTI_IMR   (EXTI->C2IMR1)
+#define EXTI_SWIER (EXTI->SWIER1)
+#define EXTI_PR    (EXTI->PR1)
+#elif defined(STM32MCU_MAJOR_TYPE_G4) || defined(STM32MCU_MAJOR_TYPE_L4) || defined(STM32MCU_MAJOR_TYPE_WB) || \
+      defined(STM32MCU_MAJOR_TYPE_WL)
+#define EXTI_IMR   (EXTI->IMR1)
+#define EXTI_SWIER (EXTI->SWIER1)
+#define EXTI_PR    (EXTI->PR1)
+#else
+#define EXTI_IMR   (EXTI->IMR)
+#define EXTI_SWIER (EXTI->SWIER)
+#define EXTI_PR    (EXTI->PR)
+#endif
+
+// Measured lines
+#define EXTI_DISPATCH_FIRST_LINE 5
+#define EXTI_DISPATCH_LAST_LINE  15
+
+/* ============================================================= Types ============================================================ */
+
+/// Results of the benchmark
+typedef struct exti_dispatch_benchmark {
+
+    /// EXTI15_10 dispatcher (EXTI4_15 on Cortex-M0/M0+ families) with 1, 2 and 6 lines pending
+    benchmark_result upper[3];
+    /// EXTI9_5 dispatcher with 1, 2 and 5 lines pending
+    benchmark_result lower[3];
+
+} exti_dispatch_benchmark;
+
+/* ======================================================= Global variables ======================================================= */
+
+// Results of the benchmark
+volatile exti_dispatch_benchmark exti_dispatch_results;
+
+/* ======================================================= Static variables ======================================================= */
+
+// Number of pended lines whose handlers have not returned yet
+static volatile unsigned pending_lines;
+// Value of the counter at the end of the last handler
+static volatile unsigned long return_stamp;
+
+/* ====================================================== Static definitions ====================================================== */
+
+/**
+ * @brief Handler of the measured line (@p context holds mask of the line)
+ */
+static void line_handler(void *context) {
+    EXTI_PR = (unsigned long) context;
+    pending_lines = pending_lines - 1;
+    return_stamp = benchmark_counter();
+}
+
+
+/**
+ * @brief Measures dispatch of the @p count @p lines pended at once into the @p result
+ */
+static void measure(volatile benchmark_result *result, unsigned long lines, unsigned count) {
+
+    for(unsigned i = 0; i < EXTI_DISPATCH_SAMPLES; ++i) {
+
+        pending_lines = count;
+
+        // Pend lines
+        unsigned long start = benchmark_counter();
+        EXTI_SWIER = lines;
+
+        // Wait until all handlers return
+        while(pending_lines != 0);
+
+        benchmark_record(result, start, return_stamp);
+    }
+}
+
+/* ========================================================== Definitions ========================================================= */
+
+int main(void) {
+
+    benchmark_init();
+
+    // Register handlers of the measured lines and unmask them
+    for(unsigned line = EXTI_DISPATCH_FIRST_LINE; line <= EXTI_DISPATCH_LAST_LINE; ++line) {
+        exti_register_line_handler(line, line_handler, (void *) (1UL << line));
+        EXTI_IMR |= (1UL << line);
+    }
+
+    // Measure dispatcher of the upper lines
+    NVIC_ClearPendingIRQ(EXTI_DISPATCH_UPPER_IRQn);
+    NVIC_EnableIRQ(EXTI_DISPATCH_UPPER_IRQn);
+    measure(&exti_dispatch_results.upper[0], 0x0400UL, 1);
+    measure(&exti_dispatch_results.upper[1], 0x0C00UL, 2);
+    measure(&exti_dispatch_results.upper[2], 0xFC00UL, 6);
+    NVIC_DisableIRQ(EXTI_DISPATCH_UPPER_IRQn);
+
+    // Measure dispatcher of the lower lines
+    #ifdef EXTI_DISPATCH_LOWER_IRQn
+        NVIC_ClearPendingIRQ(EXTI_DISPATCH_LOWER_IRQn);
+        NVIC_EnableIRQ(EXTI_DISPATCH_LOWER_IRQn);
+        measure(&exti_dispatch_results.lower[0], 0x0020UL, 1);
+        measure(&exti_dispatch_results.lower[1], 0x0060UL, 2);
+        measure(&exti_dispatch_results.lower[2], 0x03E0UL, 5);
+        NVIC_DisableIRQ(EXTI_DISPATCH_LOWER_IRQn);
+    #endif
+
+    benchmark_finish();
+}
+
+/* ================================================================================================================================ */
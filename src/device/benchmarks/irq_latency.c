@@ -0,0 +1,161 @@
+/* ============================================================================================================================= *//**
+ * @file       irq_latency.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 11:58:02 pm
+ * @modified   Saturday, 17th October 2026 11:58:02 pm
+ * @project    stm-utils
+ * @brief      Benchmark of the interrupt latency (cycles from pending the IRQ to the first statement of its handler and
+ *    back to the interrupted code)
+ * @details    The WWDG interrupt (IRQ 0 on all supported families) is pended by software (NVIC->STIR, ISPR on ARMv6-M)
+ *    and its handler stamps the counter as its first statement. The program is built twice: `irq_latency` defines the
+ *    handler with the `interrupt` attribute (default ISR_ATTRIBUTES) and `irq_latency_plain` as a plain AAPCS function
+ *    (ISR_PLAIN_HANDLERS option), so that the difference is the cost of the stack realignment prologue. Vectors are
+ *    fetched from the ISR vectors table in flash and results are kept in `irq_latency_flash` (e.g. configure with
+ *    DEVICE=STM32G071xx, STM32F407xx and STM32F767xx to cover Cortex-M0+, Cortex-M4 and Cortex-M7 cores).
+ * 
+ *    With the RAM_VECTOR_TABLE option enabled the program is additionally built as `irq_latency_ram` which, after
+ *    measuring the flash table, installs the handler with interrupts_install_handler() and repeats the measurement with
+ *    vectors fetched from the RAM copy of the table. Results of the second run are kept in `irq_latency_ram` next to
+ *    `irq_latency_flash`. With the ISR_PROFILING option enabled as well the program is built as `isr_profiling` and the
+ *    second run goes through the profiling trampoline, so that the difference between `irq_latency_ram` of the
+ *    `isr_profiling` and `irq_latency_ram` programs (of `entry` and `total` results) is the cost of the trampoline
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "benchmark.h"
+#ifdef BENCHMARK_RAM_VECTORS
+#include "interrupts/ram_vectors.h"
+#endif
+
+/* ========================================================= Configuration ======================================================== */
+
+// Number of measured entries
+#define IRQ_LATENCY_SAMPLES 1000
+
+// Attributes of the measured handler
+#ifdef BENCHMARK_PLAIN_HANDLER
+#define IRQ_LATENCY_ATTRIBUTES
+#else
+#define IRQ_LATENCY_ATTRIBUTES __attribute__ ((interrupt))
+#endif
+
+/* ============================================================= Types ============================================================ */
+
+/// Results of the benchmark for a single location of the vectors table
+typedef struct irq_latency_benchmark {
+
+    /// Cycles from pending the interrupt to the first statement of its handler
+    benchmark_result entry;
+    /// Cycles from pending the interrupt to the return to the interrupted code
+    benchmark_result total;
+
+} irq_latency_benchmark;
+
+/* ======================================================= Global variables ======================================================= */
+
+// Results of the benchmark with vectors fetched from the table in flash
+volatile irq_latency_benchmark irq_latency_flash;
+
+#ifdef BENCHMARK_RAM_VECTORS
+// Results of the benchmark with vectors fetched from the RAM copy of the table
+volatile irq_latency_benchmark irq_latency_ram;
+#endif
+
+/* ======================================================= Static variables ======================================================= */
+
+// Value of the counter at the entry to the handler
+static volatile unsigned long entry_stamp;
+
+/* ========================================================= Declarations ========================================================= */
+
+void ISR_WWDG(void) IRQ_LATENCY_ATTRIBUTES;
+
+/* ====================================================== Static definitions ====================================================== */
+
+/**
+ * @brief Redirects vector fetches to the ISR vectors table in flash (@p ram is @c false) or to its RAM copy (@p ram
+ *    is @c true) the same way the startup code does
+ */
+static void vectors_select(bool ram) {
+
+    #if defined(STM32MCU_MAJOR_TYPE_F0)
+        RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+        if(ram)
+            SYSCFG->CFGR1 |= SYSCFG_CFGR1_MEM_MODE;
+        else
+            SYSCFG->CFGR1 &= ~SYSCFG_CFGR1_MEM_MODE;
+    #elif defined(BENCHMARK_RAM_VECTORS)
+        SCB->VTOR = ram ? (unsigned long) __ram_vectors_start : (unsigned long) isr_vectors_table;
+    #else
+        (void) ram;
+        SCB->VTOR = (unsigned long) isr_vectors_table;
+    #endif
+    __DSB();
+    __ISB();
+}
+
+
+/**
+ * @brief Measures latency of the interrupt into the @p result
+ */
+static void measure(volatile irq_latency_benchmark *result) {
+
+    for(unsigned i = 0; i < IRQ_LATENCY_SAMPLES; ++i) {
+
+        // Pend the interrupt
+        unsigned long start = benchmark_counter();
+        #if (__CORTEX_M == 0U)
+            NVIC->ISPR[0] = (1UL << (unsigned long) WWDG_IRQn);
+        #else
+            NVIC->STIR = (unsigned long) WWDG_IRQn;
+        #endif
+
+        // Make sure that the interrupt has been taken
+        __DSB();
+        __ISB();
+        unsigned long stop = benchmark_counter();
+
+        benchmark_record(&result->entry, start, entry_stamp);
+        benchmark_record(&result->total, start, stop);
+    }
+}
+
+/* ========================================================== Definitions ========================================================= */
+
+/**
+ * @brief Handler of the measured interrupt (overrides the weak vector)
+ */
+void ISR_WWDG(void) {
+    entry_stamp = benchmark_counter();
+}
+
+
+int main(void) {
+
+    benchmark_init();
+
+    // Enable the interrupt in NVIC only (the watchdog itself stays disabled)
+    NVIC_ClearPendingIRQ(WWDG_IRQn);
+    NVIC_EnableIRQ(WWDG_IRQn);
+
+    // Measure vectors fetched from flash (the startup code may have redirected them to the RAM copy)
+    vectors_select(false);
+    measure(&irq_latency_flash);
+
+    // Measure vectors fetched from the RAM copy
+    #ifdef BENCHMARK_RAM_VECTORS
+        interrupts_install_handler(WWDG_IRQn, ISR_WWDG);
+        vectors_select(true);
+        measure(&irq_latency_ram);
+    #endif
+
+    NVIC_DisableIRQ(WWDG_IRQn);
+
+    benchmark_finish();
+}
+
+/* ================================================================================================================================ */
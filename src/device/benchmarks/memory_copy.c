@@ -0,0 +1,154 @@
+/* ============================================================================================================================= *//**
+ * @file       memory_copy.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 11:58:02 pm
+ * @modified   Saturday, 17th October 2026 11:58:02 pm
+ * @project    stm-utils
+ * @brief      Benchmark of memory initialization routines of the startup code (STARTUP_BURST_MEMORY_INIT option)
+ * @details    Compares LDM/STM burst routines of the startup code with the word-by-word loops used when the option is
+ *    disabled: copy of a buffer from flash and from RAM into RAM (initialization of .data) and zeroing of a RAM buffer
+ *    (initialization of .bss). Routines are the ones shipped in src/startup/memory.h, wrapped into non-inlined functions.
+ *    Burst results are available on ARMv7-M and ARMv8-M Mainline cores only. Results are kept in `memory_copy_results`
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "benchmark.h"
+#include "startup/memory.h"
+
+/* ========================================================= Configuration ======================================================== */
+
+// Size of buffers [words] (not a multiple of 4 words so that the trailing 8-byte block is exercised)
+#define MEMORY_COPY_WORDS 1026
+// Number of measurements of each routine
+#define MEMORY_COPY_SAMPLES 16
+
+/* ============================================================= Types ============================================================ */
+
+/// Results of the benchmark
+typedef struct memory_copy_benchmark {
+
+    /// Word-by-word copy from flash
+    benchmark_result copy_flash_word;
+    /// Word-by-word copy from RAM
+    benchmark_result copy_ram_word;
+    /// Word-by-word zeroing
+    benchmark_result zero_word;
+
+    /// Burst copy from flash
+    benchmark_result copy_flash_burst;
+    /// Burst copy from RAM
+    benchmark_result copy_ram_burst;
+    /// Burst zeroing
+    benchmark_result zero_burst;
+
+} memory_copy_benchmark;
+
+/* ======================================================= Global variables ======================================================= */
+
+// Results of the benchmark
+volatile memory_copy_benchmark memory_copy_results;
+
+/* ======================================================= Static variables ======================================================= */
+
+// Source buffer in flash
+static const unsigned long flash_buffer[MEMORY_COPY_WORDS] __attribute__ ((aligned(8))) = { 0xA5A5A5A5UL };
+// Source buffer in RAM
+static unsigned long ram_buffer[MEMORY_COPY_WORDS] __attribute__ ((aligned(8)));
+// Destination buffer
+static unsigned long destination[MEMORY_COPY_WORDS] __attribute__ ((aligned(8)));
+
+/* ====================================================== Static definitions ====================================================== */
+
+/**
+ * @brief Non-inlined memory_copy_words()
+ */
+__attribute__ ((noinline)) static void copy_words(const unsigned long *src, unsigned long *dst, const unsigned long *end) {
+    memory_copy_words(src, dst, end);
+}
+
+
+/**
+ * @brief Non-inlined memory_zero_words()
+ */
+__attribute__ ((noinline)) static void zero_words(unsigned long *dst, const unsigned long *end) {
+    memory_zero_words(dst, end);
+}
+
+
+#ifdef STARTUP_BURST_SUPPORTED
+
+/**
+ * @brief Non-inlined memory_copy_burst()
+ */
+__attribute__ ((noinline)) static void copy_burst(const unsigned long *src, unsigned long *dst, const unsigned long *end) {
+    memory_copy_burst(src, dst, end);
+}
+
+
+/**
+ * @brief Non-inlined memory_zero_burst()
+ */
+__attribute__ ((noinline)) static void zero_burst(unsigned long *dst, const unsigned long *end) {
+    memory_zero_burst(dst, end);
+}
+
+#endif
+
+
+/**
+ * @brief Measures copy of the @p src buffer into the destination buffer with the @p copy routine
+ */
+static void measure_copy(volatile benchmark_result *result, const unsigned long *src,
+    void (*copy)(const unsigned long *, unsigned long *, const unsigned long *)
+) {
+    for(unsigned i = 0; i < MEMORY_COPY_SAMPLES; ++i) {
+        unsigned long start = benchmark_counter();
+        copy(src, destination, &destination[MEMORY_COPY_WORDS]);
+        unsigned long stop = benchmark_counter();
+        benchmark_record(result, start, stop);
+    }
+}
+
+
+/**
+ * @brief Measures zeroing of the destination buffer with the @p zero routine
+ */
+static void measure_zero(volatile benchmark_result *result, void (*zero)(unsigned long *, const unsigned long *)) {
+    for(unsigned i = 0; i < MEMORY_COPY_SAMPLES; ++i) {
+        unsigned long start = benchmark_counter();
+        zero(destination, &destination[MEMORY_COPY_WORDS]);
+        unsigned long stop = benchmark_counter();
+        benchmark_record(result, start, stop);
+    }
+}
+
+/* ========================================================== Definitions ========================================================= */
+
+int main(void) {
+
+    benchmark_init();
+
+    // Fill the source buffer in RAM
+    for(unsigned i = 0; i < MEMORY_COPY_WORDS; ++i)
+        ram_buffer[i] = i;
+
+    // Measure word-by-word routines
+    measure_copy(&memory_copy_results.copy_flash_word, flash_buffer, copy_words);
+    measure_copy(&memory_copy_results.copy_ram_word,   ram_buffer,   copy_words);
+    measure_zero(&memory_copy_results.zero_word, zero_words);
+
+    // Measure burst routines
+    #ifdef STARTUP_BURST_SUPPORTED
+        measure_copy(&memory_copy_results.copy_flash_burst, flash_buffer, copy_burst);
+        measure_copy(&memory_copy_results.copy_ram_burst,   ram_buffer,   copy_burst);
+        measure_zero(&memory_copy_results.zero_burst, zero_burst);
+    #endif
+
+    benchmark_finish();
+}
+
+/* ================================================================================================================================ */
@@ -17,7 +17,9 @@
 
 #include "device/device.h"
 #include "device/startup.h"
+#include "device/sections.h"
 #include "device/interrupts.h"
+#include "device/deferred.h"
 
 /* ================================================================================================================================ */
 
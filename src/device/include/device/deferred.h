@@ -0,0 +1,84 @@
+/* ============================================================================================================================= *//**
+ * @file       deferred.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 8:41:09 pm
+ * @modified   Saturday, 17th October 2026 8:41:09 pm
+ * @project    stm-utils
+ * @brief      Queue of work deferred by ISRs to the lowest-priority context (DEFERRED_WORK option)
+ * @details    ISRs post statically allocated work items which are executed in the FIFO order by the PendSV handler
+ *    running at the lowest priority. When RTX RTOS owns PendSV (USE_CMSIS_RTOS option), posting calls the weak
+ *    deferred_work_notify() hook instead and the application drains the queue with deferred_work_drain() from its own
+ *    thread (e.g. waiting for a thread flag set by the hook).
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_DEFERRED_H__
+#define __STM_UTILS_DEVICE_DEFERRED_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <stdbool.h>
+
+/* ========================================================== C mangling ========================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================== Definitions ========================================================= */
+
+// Static initializer of the deferred work item calling @p handler with the @p context
+#define DEFERRED_WORK_INIT(handler, context) { 0, (handler), (context), 0 }
+
+/* ============================================================= Types ============================================================ */
+
+/// Item of the deferred work queue (needs to stay valid as long as it is queued)
+typedef struct deferred_work {
+
+    /// Next item in the queue (managed by the queue)
+    struct deferred_work *volatile next;
+    /// Function executed by the queue
+    void (*handler)(void *context);
+    /// Context passed to the handler
+    void *context;
+    /// Non-zero if the item is queued (managed by the queue)
+    volatile unsigned long pending;
+
+} deferred_work;
+
+/* ========================================================= Declarations ========================================================= */
+
+/**
+ * @brief Posts @p work to the queue (may be called from any ISR and from the thread mode)
+ *
+ * @param work
+ *    item to be executed
+ * @retval true
+ *    if item has been queued
+ * @retval false
+ *    if item is already pending (posts are coalesced; the item may be posted again from its own handler)
+ */
+bool deferred_work_post(deferred_work *work);
+
+/**
+ * @brief Executes all work items posted so far (called by the PendSV handler in bare-metal builds)
+ */
+void deferred_work_drain(void);
+
+/**
+ * @brief Hook called after the work is posted when RTX RTOS owns PendSV (USE_CMSIS_RTOS option). Does nothing by default
+ *    and may be overridden to wake the thread calling deferred_work_drain()
+ */
+void deferred_work_notify(void);
+
+/* ================================================================================================================================ */
+
+#ifdef __cplusplus
+}
+#endif
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,283 @@
+/* ============================================================================================================================= *//**
+ * @file       interrupt.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Tuesday, 6th July 2021 2:08:23 pm
+ * @modified   Tuesday, 6th July 2021 2:23:13 pm
+ * @project    stm-utils
+ * @brief      header file composing interrupt vectors' definitions for all STM32 microcontrollers
+ *    
+ * @copyright Krzysztof Pierczyk © 2022
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE__INTERUPT_H__
+#define __STM_UTILS_DEVICE__INTERUPT_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#ifndef __cplusplus
+#include <stdint.h>
+#else
+#include <cstdint>
+#include <optional>
+#endif
+// ST includes
+#include "device.h"
+// Private includes
+#ifdef __cplusplus
+#include "device/traits.h"
+#endif
+
+/* ========================================================= C++ inclusion ======================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================= Types ============================================================ */
+
+/// Pointer to the ISR function
+typedef void(*vector_function_ptr)(void);
+
+/// Pointer to the handler of the EXTI line
+typedef void(*exti_line_handler_ptr)(void *context);
+
+/// Entry of the EXTI lines' handlers table
+typedef struct {
+
+    /// Handler of the line
+    exti_line_handler_ptr handler;
+    /// Context passed to the handler
+    void *context;
+
+} exti_line_handler;
+
+/// Statistics of the interrupt vector collected by the profiling trampoline (ISR_PROFILING option)
+typedef struct {
+
+    /// Profiled handler of the vector
+    vector_function_ptr handler;
+    /// Number of entries
+    uint32_t count;
+    /// Minimal duration of the handler [cycles]
+    uint32_t min;
+    /// Maximal duration of the handler [cycles]
+    uint32_t max;
+    /// Total duration of the handler [cycles]
+    uint64_t total;
+
+} isr_profiling_entry;
+
+/// Throttle bounding rate of the interrupt source (ISR_THROTTLING option)
+typedef struct isr_throttle {
+
+    /// Maximal number of events handled within the window (configuration)
+    uint32_t budget;
+    /// Next throttle re-armed by interrupts_throttle_tick() (managed by the library)
+    struct isr_throttle *next;
+    /// Throttled source (EXTI line or interrupt, managed by the library)
+    int16_t source;
+    /// Non-zero if the source is an EXTI line (managed by the library)
+    uint8_t exti;
+    /// Non-zero if the source is masked until the end of the window (managed by the library)
+    volatile uint8_t masked;
+    /// Throttled handler of the EXTI line (managed by the library)
+    exti_line_handler line;
+    /// Number of events handled within the current window (managed by the library)
+    volatile uint32_t events;
+    /// Number of events handled since attaching
+    volatile uint32_t handled;
+    /// Number of times the source has been masked
+    volatile uint32_t throttled;
+    /// Number of windows closed with an event pending on the masked source (events coalesced into a single one)
+    volatile uint32_t coalesced;
+
+} isr_throttle;
+
+/* ========================================================== Definitions ========================================================= */
+
+// Static initializer of the throttle handling at most @p budget events per window
+#define ISR_THROTTLE_INIT(budget) { (budget), 0, 0, 0, 0, { 0, 0 }, 0, 0, 0, 0 }
+
+/* ============================================================ Objects =========================================================== */
+
+/// ISR vectors table
+extern const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector")));
+
+/// Handlers of the EXTI lines called by EXTI dispatchers (indexed by line number, call ISR_EXTIx pseudo-vectors by default)
+extern exti_line_handler exti_line_handlers[16];
+
+/// Cycles added by the accounting to each measured duration, measured at startup (ISR_PROFILING option). Covers the
+/// counter reads and the call and return of the handler only. Dispatch done by the trampoline before the measured window
+/// (IPSR read, lookup of the handler, extra call) is excluded from both this value and the statistics; the latency it
+/// adds to each interrupt is measured by the `isr_profiling` benchmark
+extern unsigned long interrupts_profiling_overhead;
+
+/* =========================================================== Functions ========================================================== */
+
+/**
+ * @brief Installs @p handler of the @p irqn interrupt (or system exception) in the RAM copy of the ISR vectors table
+ *    (requires RAM_VECTOR_TABLE option)
+ * 
+ * @param irqn 
+ *    interrupt to be handled
+ * @param handler 
+ *    new handler
+ * @returns 
+ *    previous handler of the interrupt (NULL if the @p irqn has no entry in the table, in which case nothing is installed)
+ * 
+ * @note Entry is replaced with a single store and so the function may be called with the interrupt enabled
+ */
+vector_function_ptr interrupts_install_handler(IRQn_Type irqn, vector_function_ptr handler);
+
+/**
+ * @brief Registers @p handler of the EXTI @p line called by the EXTI dispatchers with the given @p context
+ * 
+ * @param line 
+ *    index of the line
+ * @param handler 
+ *    new handler (if NULL, the default ISR_EXTIx pseudo-vector is restored)
+ * @param context 
+ *    context passed to the handler
+ * 
+ * @note Entry is replaced with interrupts disabled and so the function may be called with the line enabled
+ * @note Calls for lines not dispatched by EXTI dispatchers (@p line >= 16) are ignored
+ */
+void exti_register_line_handler(unsigned line, exti_line_handler_ptr handler, void *context);
+
+/**
+ * @param irqn 
+ *    interrupt to be inspected
+ * @returns 
+ *    statistics of the @p irqn interrupt's handler collected since startup or the last call to interrupts_profiling_reset()
+ *    (requires ISR_PROFILING option), NULL if @p irqn is not an interrupt of the device
+ * 
+ * @note Durations include time spent in handlers of interrupts preempting the measured one
+ */
+const isr_profiling_entry *interrupts_profiling_entry(IRQn_Type irqn);
+
+/**
+ * @brief Clears statistics of all interrupts (requires ISR_PROFILING option)
+ */
+void interrupts_profiling_reset(void);
+
+/**
+ * @brief Registers @p handler of the EXTI @p line whose rate is bounded by the @p throttle (requires ISR_THROTTLING
+ *    option). When the line's budget is exhausted within the window, the line is masked in EXTI until the next call to
+ *    interrupts_throttle_tick()
+ * 
+ * @param line 
+ *    index of the line
+ * @param handler 
+ *    new handler
+ * @param context 
+ *    context passed to the handler
+ * @param throttle 
+ *    throttle of the line (needs to stay valid until detached)
+ * 
+ * @note Calls for lines not dispatched by EXTI dispatchers (@p line >= 16) are ignored (the throttle is not attached)
+ */
+void exti_register_throttled_line_handler(unsigned line, exti_line_handler_ptr handler, void *context, isr_throttle *throttle);
+
+/**
+ * @brief Attaches @p throttle to the @p irqn interrupt (requires ISR_THROTTLING option). Handler of the interrupt needs
+ *    to call interrupts_throttle_event() (see ISR_VECTOR_BIND_THROTTLED()) and the interrupt is disabled in NVIC when its
+ *    budget is exhausted until the next call to interrupts_throttle_tick()
+ * 
+ * @param irqn 
+ *    throttled interrupt
+ * @param throttle 
+ *    throttle of the interrupt (needs to stay valid until detached)
+ */
+void interrupts_throttle_attach(IRQn_Type irqn, isr_throttle *throttle);
+
+/**
+ * @brief Detaches @p throttle from its source and unmasks the source if it has been masked (requires ISR_THROTTLING option)
+ * 
+ * @note Handler of the EXTI line registered with exti_register_throttled_line_handler() is not restored
+ */
+void interrupts_throttle_detach(isr_throttle *throttle);
+
+/**
+ * @brief Accounts the event handled by the throttled source and masks the source if the @p throttle's budget is
+ *    exhausted (requires ISR_THROTTLING option)
+ */
+void interrupts_throttle_event(isr_throttle *throttle);
+
+/**
+ * @brief Closes the window of all attached throttles re-arming masked sources (requires ISR_THROTTLING option). Should
+ *    be called periodically (e.g. from the timer's or SysTick's interrupt) with the period defining length of the window
+ * 
+ * @note Events that arrived while the source was masked stay pending and are handled once after re-arming
+ */
+void interrupts_throttle_tick(void);
+
+/* ================================================================================================================================ */
+
+#ifdef __cplusplus
+}
+#endif
+
+/* ================================================= Helper functions definitions ================================================= */
+
+#ifndef __cplusplus
+
+/**
+ * @retval irqn 
+ *    constant corresponding to the interrupt line of the NVIC controller
+ *    used by the EXTIx line where x is given by @p index on success
+ * @retval 0xFFFF'FFFF
+ *    optional if @p idnex is out of range
+ */
+IRQn_Type get_exti_line_irqn(unsigned index);
+
+#else
+
+namespace device {
+
+/**
+ * @retval irqn 
+ *    constant corresponding to the interrupt line of the NVIC controller
+ *    used by the EXTIx line where x is given by @p index on success
+ * @retval empty 
+ *    optional if @p idnex is out of range
+ */
+std::optional<IRQn_Type> get_exti_line_irqn(unsigned index);
+
+/**
+ * @returns 
+ *    constant corresponding to the interrupt line of the NVIC controller
+ *    used by the EXTIx line where x is given by @p index (resolved at compile
+ *    time, fails to compile if @p index is out of range)
+ */
+template<unsigned index>
+constexpr IRQn_Type get_exti_line_irqn() {
+    return traits::exti_line_irqn<index>();
+}
+
+/**
+ * @brief Registers @p method of the @p instance as handler of the EXTI @p line
+ * 
+ * @tparam method 
+ *    pointer to the member function of T called on the line's interrupt
+ * @param line 
+ *    index of the line
+ * @param instance 
+ *    object which the @p method is called on
+ * 
+ * @note The binding is resolved at compile time and so the dispatcher calls the method through a thunk (usually reduced
+ *    to a tail call) without any global lookups
+ */
+template<auto method, typename T>
+inline void register_exti_line_handler(unsigned line, T &instance) {
+    exti_register_line_handler(line, [](void *context) { (static_cast<T*>(context)->*method)(); }, &instance);
+}
+
+}
+
+#endif
+
+/* ================================================================================================================================ */
+
+#endif
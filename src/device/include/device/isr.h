@@ -0,0 +1,194 @@
+/* ============================================================================================================================= *//**
+ * @file       isr.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 8:05:37 pm
+ * @modified   Saturday, 17th October 2026 8:05:37 pm
+ * @project    stm-utils
+ * @brief      Compile-time binding of interrupt vectors to static functions and member functions of drivers
+ * @details    The vector is bound statically with the ISR_VECTOR_BIND() macro overriding the weak vector of the family, e.g.
+ *
+ *        ISR_VECTOR_BIND(ISR_USART1, USART1_IRQn, &Uart::on_irq);
+ *        ...
+ *        device::Interrupt<USART1_IRQn>::bind<&Uart::on_irq>(uart);
+ *
+ *    The vector's slot points directly to the generated ISR which calls the target through always-inlined handler and so
+ *    the target's body is usually inlined into the ISR. Member functions are called on the instance registered with
+ *    bind() (a single load of the static pointer) or on the object given as the template argument (no load at all).
+ *    If the RAM copy of the ISR vectors table is used (RAM_VECTOR_TABLE option), the handler can also be installed at
+ *    runtime with install().
+ *
+ * @note Vectors of EXTI lines are always defined by the library (see exti_register_line_handler()) and so they cannot
+ *    be bound with the macros
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_ISR_H__
+#define __STM_UTILS_DEVICE_ISR_H__
+
+#ifndef __cplusplus
+#error "device/isr.h can be used from C++ sources only"
+#endif
+
+/* =========================================================== Includes =========================================================== */
+
+#include <type_traits>
+#include "device/interrupts.h"
+#include "interrupts/definitions.h"
+
+/* ========================================================== Definitions ========================================================= */
+
+/**
+ * @brief Defines @p handler_name vector (e.g. ISR_USART1) of the @p irqn interrupt calling the @p target function (either
+ *    static function or member function called on the instance registered with device::Interrupt<irqn>::bind())
+ */
+#define ISR_VECTOR_BIND( handler_name, irqn, target )  \
+    extern "C" { ISR_VECTOR_EXTERN(handler_name); }     \
+    void handler_name(void) {                           \
+        ::device::Interrupt<irqn>::handler<target>();   \
+    }
+
+/**
+ * @brief Defines @p handler_name vector (e.g. ISR_USART1) of the @p irqn interrupt calling the member @p target function
+ *    on the @p object with static storage duration (resolved at compile time)
+ */
+#define ISR_VECTOR_BIND_OBJECT( handler_name, irqn, target, object )  \
+    extern "C" { ISR_VECTOR_EXTERN(handler_name); }                    \
+    void handler_name(void) {                                          \
+        ::device::Interrupt<irqn>::handler<target, &(object)>();       \
+    }
+
+/**
+ * @brief Defines @p handler_name vector (e.g. ISR_USART1) of the @p irqn interrupt calling the @p target function and
+ *    accounting the event in the @p throttle attached with interrupts_throttle_attach() (requires ISR_THROTTLING option)
+ */
+#define ISR_VECTOR_BIND_THROTTLED( handler_name, irqn, target, throttle )  \
+    extern "C" { ISR_VECTOR_EXTERN(handler_name); }                         \
+    void handler_name(void) {                                               \
+        ::device::Interrupt<irqn>::handler<target>();                       \
+        interrupts_throttle_event(&(throttle));                             \
+    }
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device {
+
+/* ============================================================ Helpers =========================================================== */
+
+namespace details {
+
+/// Traits of the target bound to the interrupt (static function)
+template<typename F>
+struct isr_target_traits {
+
+    /// Target is not a member function
+    static constexpr bool is_member = false;
+    /// Class of the target (none)
+    using class_type = void;
+
+};
+
+/// Traits of the target bound to the interrupt (member function)
+template<typename C, typename R>
+struct isr_target_traits<R (C::*)()> {
+
+    /// Target is a member function
+    static constexpr bool is_member = true;
+    /// Class of the target
+    using class_type = C;
+
+};
+
+/// Traits of the target bound to the interrupt (noexcept member function)
+template<typename C, typename R>
+struct isr_target_traits<R (C::*)() noexcept> : isr_target_traits<R (C::*)()> { };
+
+}
+
+/* ============================================================= Class ============================================================ */
+
+/**
+ * @brief Binding of the @p irqn interrupt to the C++ function
+ *
+ * @tparam irqn
+ *    interrupt line
+ */
+template<IRQn_Type irqn>
+struct Interrupt {
+
+    /// Instance of the class @p T whose member function handles the interrupt
+    template<typename T>
+    static inline T *instance = nullptr;
+
+    /**
+     * @brief Calls the @p target (static function or member function) bound to the interrupt
+     *
+     * @tparam target
+     *    function handling the interrupt
+     * @tparam object
+     *    pointer to the object with static storage duration which the member @p target is called on (if not given,
+     *    instance registered with bind() is used)
+     */
+    template<auto target, auto object = nullptr>
+    static inline __attribute__((always_inline)) void handler() {
+
+        using traits = details::isr_target_traits<decltype(target)>;
+
+        if constexpr(not traits::is_member)
+            target();
+        else if constexpr(object != nullptr)
+            (object->*target)();
+        else
+            (instance<typename traits::class_type>->*target)();
+    }
+
+    /**
+     * @brief Registers @p object which the member @p target bound to the interrupt is called on
+     *
+     * @note Registration is a single store and so it may be done with the interrupt enabled (as long as the vector is not
+     *    entered before the first registration)
+     */
+    template<auto target, typename T>
+    static inline void bind(T &object) {
+        static_assert(std::is_same_v<typename details::isr_target_traits<decltype(target)>::class_type, T>,
+            "Object does not match class of the bound member function");
+        instance<T> = &object;
+    }
+
+    /**
+     * @brief Installs handler calling the member @p target on the @p object in the RAM copy of the ISR vectors table
+     *    (requires RAM_VECTOR_TABLE option)
+     *
+     * @returns
+     *    previous handler of the interrupt
+     */
+    template<auto target, typename T>
+    static inline vector_function_ptr install(T &object) {
+        bind<target>(object);
+        return interrupts_install_handler(irqn, &handler<target>);
+    }
+
+    /**
+     * @brief Installs handler calling the static @p target in the RAM copy of the ISR vectors table (requires
+     *    RAM_VECTOR_TABLE option)
+     *
+     * @returns
+     *    previous handler of the interrupt
+     */
+    template<auto target>
+    static inline vector_function_ptr install() {
+        static_assert(not details::isr_target_traits<decltype(target)>::is_member,
+            "Object needs to be given for the member function");
+        return interrupts_install_handler(irqn, &handler<target>);
+    }
+
+};
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
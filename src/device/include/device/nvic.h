@@ -0,0 +1,169 @@
+/* ============================================================================================================================= *//**
+ * @file       nvic.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 9:26:50 pm
+ * @modified   Saturday, 17th October 2026 9:26:50 pm
+ * @project    stm-utils
+ * @brief      Compile-time plan of NVIC priorities
+ * @details    Priorities of all interrupts used by the application are declared once in a constexpr table which is
+ *    validated at compile time and programmed into NVIC in a single pass, e.g.
+ *
+ *        constexpr device::nvic::Entry nvic_plan[] = {
+ *            { TIM1_UP_TIM10_IRQn, 0, 0, device::nvic::enable                      }, // control loop (zero-latency band)
+ *            { USART1_IRQn,        2, 0, device::nvic::enable | device::nvic::os   }, // calls RTOS API
+ *            { SysTick_IRQn,       3                                                },
+ *        };
+ *        ...
+ *        device::nvic::Plan<nvic_plan, 2, 1>::init();
+ *
+ *    Interrupts marked with device::nvic::os call RTOS API and so they are required to have preemption priority not
+ *    higher (numerically not lower) than the OS boundary. Interrupts above the boundary form the zero-latency band that
+ *    is never delayed by the kernel's critical sections (e.g. BASEPRI-based ones).
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_NVIC_H__
+#define __STM_UTILS_DEVICE_NVIC_H__
+
+#ifndef __cplusplus
+#error "device/nvic.h can be used from C++ sources only"
+#endif
+
+/* =========================================================== Includes =========================================================== */
+
+#include <cstddef>
+#include <iterator>
+#include "device/interrupts.h"
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::nvic {
+
+/* ============================================================= Types ============================================================ */
+
+/// Interrupt calls RTOS API (needs to be placed at or below the OS boundary)
+inline constexpr unsigned os = 1U << 0;
+/// Interrupt is enabled when the plan is programmed
+inline constexpr unsigned enable = 1U << 1;
+
+/// Entry of the priority plan
+struct Entry {
+
+    /// Interrupt line (or system exception)
+    IRQn_Type irqn;
+    /// Preemption priority (lower value preempts higher ones)
+    unsigned preempt;
+    /// Subpriority (orders pending interrupts of the same preemption priority)
+    unsigned sub = 0;
+    /// Flags of the entry (device::nvic::os, device::nvic::enable)
+    unsigned flags = 0;
+
+};
+
+/* ============================================================= Class ============================================================ */
+
+/**
+ * @brief Priority plan of the application
+ *
+ * @tparam entries
+ *    table of entries
+ * @tparam preempt_bits
+ *    number of bits of the priority used as preemption priority (remaining bits are used as subpriority)
+ * @tparam os_boundary
+ *    the highest (numerically lowest) preemption priority of interrupts calling RTOS API
+ */
+template<const auto &entries, unsigned preempt_bits = __NVIC_PRIO_BITS, unsigned os_boundary = 0>
+class Plan {
+
+public: /* ---------------------------------------------------- Public constants ---------------------------------------------------- */
+
+    /// Number of bits of the subpriority
+    static constexpr unsigned sub_bits = __NVIC_PRIO_BITS - preempt_bits;
+
+private: /* ------------------------------------------------------ Validation ------------------------------------------------------- */
+
+    /// Checks whether all priorities fit into their fields
+    static constexpr bool priorities_fit() {
+        for(const Entry &entry : entries)
+            if(entry.preempt >= (1U << preempt_bits) or entry.sub >= (1U << sub_bits))
+                return false;
+        return true;
+    }
+
+    /// Checks whether all interrupts calling RTOS API are placed at or below the OS boundary
+    static constexpr bool os_band_respected() {
+        for(const Entry &entry : entries)
+            if((entry.flags & os) and entry.preempt < os_boundary)
+                return false;
+        return true;
+    }
+
+    /// Checks whether each interrupt is planned once
+    static constexpr bool unique() {
+        for(std::size_t i = 0; i < std::size(entries); ++i)
+            for(std::size_t j = i + 1; j < std::size(entries); ++j)
+                if(entries[i].irqn == entries[j].irqn)
+                    return false;
+        return true;
+    }
+
+    static_assert(preempt_bits <= __NVIC_PRIO_BITS,
+        "Number of preemption bits exceeds number of priority bits implemented by the device");
+    #if (__CORTEX_M < 3U)
+    static_assert(preempt_bits == __NVIC_PRIO_BITS,
+        "ARMv6-M cores do not support priority grouping (all priority bits are preemption bits)");
+    #endif
+    static_assert(os_boundary < (1U << preempt_bits),
+        "OS boundary exceeds the range of preemption priorities");
+    static_assert(priorities_fit(),
+        "Preemption priority or subpriority of the interrupt exceeds range given by the number of preemption bits");
+    static_assert(os_band_respected(),
+        "Interrupt calling RTOS API is placed above the OS boundary");
+    static_assert(unique(),
+        "Interrupt is planned more than once");
+
+public: /* ---------------------------------------------------- Public methods ----------------------------------------------------- */
+
+    /**
+     * @returns
+     *    priority of the @p entry as written by NVIC_SetPriority()
+     */
+    static constexpr uint32_t encode(const Entry &entry) {
+        return (entry.preempt << sub_bits) | entry.sub;
+    }
+
+    /**
+     * @brief Programs priority grouping and priorities of all planned interrupts (and enables interrupts marked with
+     *    device::nvic::enable)
+     *
+     * @note Should be called before the RTOS kernel is started as the kernel derives priorities of its exceptions from
+     *    the priority grouping
+     */
+    static inline void init() {
+
+        // Set priority grouping (ARMv7-M and ARMv8-M Mainline only)
+        #if (__CORTEX_M >= 3U)
+            NVIC_SetPriorityGrouping(7U - preempt_bits);
+        #endif
+
+        // Program priorities
+        for(const Entry &entry : entries)
+            NVIC_SetPriority(entry.irqn, encode(entry));
+
+        // Enable interrupts (system exceptions are always enabled)
+        for(const Entry &entry : entries)
+            if((entry.flags & enable) and static_cast<int>(entry.irqn) >= 0)
+                NVIC_EnableIRQ(entry.irqn);
+    }
+
+};
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,70 @@
+/* ============================================================================================================================= *//**
+ * @file       sections.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 10:12:31 am
+ * @modified   Saturday, 17th October 2026 10:12:31 am
+ * @project    stm-utils
+ * @brief      Attributes placing objects in auxiliary memory regions defined by the default linker script
+ * @details    Regions that are not present on the target device are aliased to the main RAM by the linker memory file, so
+ *    objects marked with these attributes land in the regular .data/.bss on such devices. All DATA/BSS regions are initialized
+ *    by the startup code. Functions placed in RAM are copied from flash along with data. The backup SRAM is never touched
+ *    by the startup code so that its content survives resets.
+ *    
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_SECTIONS_H__
+#define __STM_UTILS_DEVICE_SECTIONS_H__
+
+/* ========================================================== Definitions ========================================================= */
+
+// Initialized data placed in the CCM RAM
+#define STM_CCMRAM_DATA __attribute__ ((section(".ccmram_data")))
+// Zero-initialized data placed in the CCM RAM
+#define STM_CCMRAM_BSS __attribute__ ((section(".ccmram_bss")))
+
+// Initialized data placed in the DTCM RAM
+#define STM_DTCM_DATA __attribute__ ((section(".dtcm_data")))
+// Zero-initialized data placed in the DTCM RAM
+#define STM_DTCM_BSS __attribute__ ((section(".dtcm_bss")))
+
+// Initialized data placed in the SRAM2
+#define STM_SRAM2_DATA __attribute__ ((section(".sram2_data")))
+// Zero-initialized data placed in the SRAM2
+#define STM_SRAM2_BSS __attribute__ ((section(".sram2_bss")))
+
+// Initialized data placed in the SRAM3 (L4+ devices)
+#define STM_SRAM3_DATA __attribute__ ((section(".sram3_data")))
+// Zero-initialized data placed in the SRAM3 (L4+ devices)
+#define STM_SRAM3_BSS __attribute__ ((section(".sram3_bss")))
+
+// Buffer reachable by DMA1/DMA2 (zeroed at startup, aligned to the cache line of Cortex-M7)
+#define STM_DMA_BUFFER __attribute__ ((section(".dma_buffer"), aligned(32)))
+// Buffer reachable by BDMA (D3 SRAM4 of H7 devices, zeroed at startup)
+#define STM_BDMA_BUFFER __attribute__ ((section(".bdma_buffer"), aligned(32)))
+// Buffer placed in the AXI SRAM (H7 devices, e.g. for MDMA, DMA2D or LTDC, zeroed at startup)
+#define STM_AXI_BUFFER __attribute__ ((section(".axi_buffer"), aligned(32)))
+
+// Large zero-initialized buffer placed in the main RAM that is zeroed by the DMA in the background of startup_extension()
+// (STARTUP_DMA_MEMORY_INIT option, zeroed by the CPU otherwise). It must not be accessed before startup_dma_zero_wait()
+#define STM_DMA_BSS __attribute__ ((section(".dma_bss")))
+
+// Data placed in the main RAM that is never initialized at startup
+#define STM_NOINIT __attribute__ ((section(".noinit")))
+// Data placed in the main RAM that is zeroed on demand with startup_deferred_zero() or startup_deferred_zero_step()
+#define STM_DEFERRED_ZERO __attribute__ ((section(".deferred_bss")))
+
+// Function executed from the main RAM (called with long calls as RAM lies out of the range of the BL instruction)
+#define STM_RAMFUNC __attribute__ ((section(".ramfunc"), long_call, noinline))
+// Function executed from the ITCM RAM (F7/H7 devices)
+#define STM_ITCM __attribute__ ((section(".itcm_text"), long_call, noinline))
+// Function executed from the CCM RAM (F3/G4 devices, CCM RAM of F4 devices is not executable)
+#define STM_CCMRAM __attribute__ ((section(".ccmram_text"), long_call, noinline))
+
+// Data placed in the backup SRAM (not initialized at startup)
+#define STM_BKPSRAM __attribute__ ((section(".bkpsram")))
+
+/* ================================================================================================================================ */
+
+#endif
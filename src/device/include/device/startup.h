@@ -0,0 +1,186 @@
+/* ============================================================================================================================= *//**
+ * @file       startup.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Tuesday, 6th July 2021 1:36:47 pm
+ * @modified   Thursday, 15th July 2021 11:11:28 am
+ * @project    stm-utils
+ * @brief      Functions related to the MCU's startup
+ *    
+ * @copyright Krzysztof Pierczyk © 2022
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE__STARTUP_H__
+#define __STM_UTILS_DEVICE__STARTUP_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <stdbool.h>
+
+/* ========================================================== C mangling ========================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================== Definitions ========================================================= */
+
+// Value of the `magic` field of the boot timing record marking completed measurement ('BOOT')
+#define STARTUP_BOOT_TIMING_MAGIC 0x544F4F42UL
+
+/* ============================================================= Types ============================================================ */
+
+/// Boot phases measured by the startup code (if STARTUP_BOOT_TIMING option is enabled)
+typedef enum {
+    STARTUP_BOOT_PHASE_EARLY_CPU_SETUP,
+    STARTUP_BOOT_PHASE_DATA_COPY,
+    STARTUP_BOOT_PHASE_BSS_ZERO,
+    STARTUP_BOOT_PHASE_CLOCK_INIT,
+    STARTUP_BOOT_PHASE_STARTUP_EXTENSION,
+    STARTUP_BOOT_PHASE_BSS_WAIT,
+    STARTUP_BOOT_PHASE_INIT_ARRAY,
+    STARTUP_BOOT_PHASE_NUM
+} startup_boot_phase;
+
+/// Source of timestamps of the boot timing record
+typedef enum {
+    STARTUP_BOOT_TIMING_COUNTER_DWT,
+    STARTUP_BOOT_TIMING_COUNTER_SYSTICK,
+} startup_boot_timing_counter;
+
+/**
+ * @brief Boot timing record filled by the startup code (if STARTUP_BOOT_TIMING option is enabled). Timestamps are
+ *    given in core clock cycles counted from the entry to the reset handler to the end of the given phase. End of
+ *    the last phase marks the entry to main(). The record is placed in the `.noinit` section so that it can be
+ *    read from the RAM dump (see src/device/scripts/boot_timing.py)
+ */
+typedef struct {
+
+    // STARTUP_BOOT_TIMING_MAGIC if measurement has been completed
+    unsigned long magic;
+    // Core clock frequency at the entry to main() [Hz]
+    unsigned long frequency;
+    // Source of timestamps (startup_boot_timing_counter)
+    unsigned long counter;
+    // Timestamps of ends of subsequent phases
+    unsigned long timestamps[STARTUP_BOOT_PHASE_NUM];
+
+} startup_boot_timing;
+
+/* ========================================================= Declarations ========================================================= */
+
+/// Boot timing record (defined only if STARTUP_BOOT_TIMING option is enabled)
+extern startup_boot_timing startup_boot_timing_record;
+
+
+/**
+ * @brief Empty stub function
+ */
+void stub_function();
+
+/**
+ * @brief Function called at the very beginning of the reset handler, before memory initialization. Intended to start
+ *    clock sources (HSE, PLL) so that their stabilization overlaps with the memory initialization
+ * 
+ * @note The function must not use .data and .bss sections (these are not initialized yet)
+ * @note If the STARTUP_CLOCK_INIT option is enabled, the function is provided by the library (F2/F4/F7 devices only)
+ */
+void startup_clock_begin(void) __attribute__ ((weak));
+
+/**
+ * @brief Function called just after memory initialization. Intended to wait for clock sources started by the 
+ *    startup_clock_begin() and to switch the system clock
+ * 
+ * @note If the STARTUP_CLOCK_INIT option is enabled, the function is provided by the library (F2/F4/F7 devices only)
+ */
+void startup_clock_end(void) __attribute__ ((weak));
+
+/**
+ * @brief Function called just after initialization of the MCU
+ * 
+ * @note If the STARTUP_DMA_MEMORY_INIT option is enabled, the `.dma_bss` section (objects marked with STM_DMA_BSS) may
+ *    still be zeroed by the DMA when the function is called. The function must not access these objects before calling
+ *    startup_dma_zero_wait() as their content may be overwritten by the transfer in progress. All other sections,
+ *    including the main `.bss` (e.g. `uwTick` set by HAL_Init()), are zeroed by the CPU before the function is called
+ * @note Only the first chunk of the DMA transfer runs in the background (up to 256 KiB with DMA streams and channels,
+ *    256 MiB with MDMA). Remaining chunks are transferred by startup_dma_zero_wait()
+ */
+void startup_extension(void) __attribute__ ((weak));
+
+/**
+ * @brief Function called instead of startup_extension() on warm boot, i.e. when the MCU wakes up from Standby mode
+ *    after startup_warm_boot_arm() has been called (STARTUP_WARM_BOOT option). Memories retained in Standby mode 
+ *    (SRAM2, backup SRAM) are not reinitialized on warm boot
+ */
+void warm_start_extension(void) __attribute__ ((weak));
+
+/**
+ * @returns 
+ *    @c true if the current boot is a warm boot (see warm_start_extension()) \n
+ *    @c false otherwise
+ */
+bool startup_is_warm_boot(void);
+
+/**
+ * @brief Arms warm boot on the next wake up from Standby mode by writing signature to the backup register 
+ *    (STARTUP_WARM_BOOT option only)
+ * 
+ * @note Write access to the backup domain (DBP bit of the PWR module) is required
+ * @note Index of the backup register can be changed with STARTUP_WARM_BOOT_BACKUP_REGISTER definition (1 by default)
+ */
+void startup_warm_boot_arm(void);
+
+/**
+ * @brief Disarms warm boot (STARTUP_WARM_BOOT option only)
+ * 
+ * @note Write access to the backup domain (DBP bit of the PWR module) is required
+ */
+void startup_warm_boot_disarm(void);
+
+/**
+ * @brief Waits until the `.dma_bss` section is zeroed by the DMA (STARTUP_DMA_MEMORY_INIT option). Called by the 
+ *    startup code after startup_extension() and before constructors. Returns immediately if the option is disabled or
+ *    the section is already zeroed
+ */
+void startup_dma_zero_wait(void);
+
+/**
+ * @brief Function called just after deinitialization of the MCU
+ */
+void exit_extension(void) __attribute__ ((weak));
+
+/**
+ * @brief Zeroes the part of the `.deferred_bss` section that has not been zeroed yet
+ * 
+ * @note Neither this function nor startup_deferred_zero_step() are reentrant. If the section is zeroed in the background
+ *    (e.g. by a low-priority task) the application needs to ensure that the other contexts do not call them concurrently
+ */
+void startup_deferred_zero(void);
+
+/**
+ * @brief Zeroes the next chunk of the `.deferred_bss` section
+ * 
+ * @param size 
+ *    maximal number of bytes to be zeroed (rounded up to the multiple of 8)
+ * @returns 
+ *    @c true if the whole section has been zeroed \n
+ *    @c false otherwise
+ */
+bool startup_deferred_zero_step(unsigned long size);
+
+/**
+ * @returns 
+ *    @c true if the whole `.deferred_bss` section has been zeroed \n
+ *    @c false otherwise
+ */
+bool startup_deferred_zero_done(void);
+
+/* ================================================================================================================================ */
+
+#ifdef __cplusplus
+}
+#endif
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,186 @@
+/* ============================================================================================================================= *//**
+ * @file       traits.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 5:10:21 pm
+ * @modified   Saturday, 17th October 2026 5:10:21 pm
+ * @project    stm-utils
+ * @brief      Compile-time traits of STM32 devices (EXTI line -> IRQn, DMA stream -> IRQn, peripheral -> RCC enable bit)
+ * @details    Family-specific specializations of traits are generated from SVD files by scripts/generate_traits.py
+ *    into include/device/traits/stm32xxxx.h. All lookups resolve to constants and lookups of mappings that are not
+ *    present on the target device fail to compile.
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_H__
+#define __STM_UTILS_DEVICE_TRAITS_H__
+
+#ifndef __cplusplus
+#error "device/traits.h can be used from C++ sources only"
+#endif
+
+/* =========================================================== Includes =========================================================== */
+
+#include <cstdint>
+#include "device.h"
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ========================================================= Base traits ========================================================== */
+
+/// Trait mapping to the interrupt line of the NVIC controller
+template<int irq>
+struct irqn_trait {
+
+    /// Mapping is valid
+    static constexpr bool valid = true;
+    /// Interrupt line
+    static constexpr IRQn_Type irqn = static_cast<IRQn_Type>(irq);
+
+};
+
+/// Trait mapping to the enable bit in the RCC register
+template<unsigned register_offset, unsigned register_bit>
+struct rcc_bit_trait {
+
+    /// Mapping is valid
+    static constexpr bool valid = true;
+    /// Offset of the register relative to the RCC base address
+    static constexpr unsigned offset = register_offset;
+    /// Index of the bit in the register
+    static constexpr unsigned bit = register_bit;
+
+};
+
+/* ======================================================= Primary templates ====================================================== */
+
+/// Mapping of the EXTI line to the interrupt line of the NVIC controller
+template<unsigned line>
+struct exti_line { static constexpr bool valid = false; };
+
+/// Mapping of the DMA stream (channel) to the interrupt line of the NVIC controller
+template<unsigned dma, unsigned stream>
+struct dma_stream { static constexpr bool valid = false; };
+
+/// Mapping of the peripheral to its enable bit in RCC registers
+template<auto peripheral>
+struct rcc_enable { static constexpr bool valid = false; };
+
+/* ================================================================================================================================ */
+
+}
+
+/* ==================================================== Family-specific traits ==================================================== */
+
+#if defined(STM32MCU_MAJOR_TYPE_F0)
+#include "device/traits/stm32f0xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_F1)
+#include "device/traits/stm32f1xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_F2)
+#include "device/traits/stm32f2xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_F3)
+#include "device/traits/stm32f3xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_F4)
+#include "device/traits/stm32f4xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_F7)
+#include "device/traits/stm32f7xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_G0)
+#include "device/traits/stm32g0xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_G4)
+#include "device/traits/stm32g4xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_H7)
+#include "device/traits/stm32h7xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_L0)
+#include "device/traits/stm32l0xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_L1)
+#include "device/traits/stm32l1xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_L4)
+#include "device/traits/stm32l4xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_L5)
+#include "device/traits/stm32l5xx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_WL)
+#include "device/traits/stm32wlxx.h"
+#elif defined(STM32MCU_MAJOR_TYPE_WB)
+#include "device/traits/stm32wbxx.h"
+#else
+#error Unknown MCU major type
+#endif
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* =========================================================== Accessors ========================================================== */
+
+/**
+ * @returns
+ *    interrupt line of the NVIC controller used by the EXTI @p line
+ */
+template<unsigned line>
+constexpr IRQn_Type exti_line_irqn() {
+    static_assert(exti_line<line>::valid, "EXTI line is not present on the target device");
+    return exti_line<line>::irqn;
+}
+
+/**
+ * @returns
+ *    interrupt line of the NVIC controller used by the @p stream (channel) of the @p dma controller
+ */
+template<unsigned dma, unsigned stream>
+constexpr IRQn_Type dma_stream_irqn() {
+    static_assert(dma_stream<dma, stream>::valid, "DMA stream is not present on the target device");
+    return dma_stream<dma, stream>::irqn;
+}
+
+/**
+ * @returns
+ *    address of the RCC register holding enable bit of the @p peripheral
+ */
+template<peripheral p>
+constexpr std::uintptr_t rcc_enable_register() {
+    static_assert(rcc_enable<p>::valid, "Peripheral is not present on the target device");
+    return RCC_BASE + rcc_enable<p>::offset;
+}
+
+/**
+ * @returns
+ *    mask of the enable bit of the @p peripheral in its RCC register
+ */
+template<peripheral p>
+constexpr std::uint32_t rcc_enable_mask() {
+    static_assert(rcc_enable<p>::valid, "Peripheral is not present on the target device");
+    return 1UL << rcc_enable<p>::bit;
+}
+
+/* ============================================================ Helpers =========================================================== */
+
+/**
+ * @brief Enables clock of the @p peripheral
+ * @note Register is read back after the write to make sure that the clock is running before the peripheral is accessed
+ */
+template<peripheral p>
+inline void enable_clock() {
+    auto &reg = *reinterpret_cast<volatile std::uint32_t*>(rcc_enable_register<p>());
+    reg |= rcc_enable_mask<p>();
+    [[maybe_unused]] std::uint32_t readback = reg;
+}
+
+/**
+ * @brief Disables clock of the @p peripheral
+ */
+template<peripheral p>
+inline void disable_clock() {
+    auto &reg = *reinterpret_cast<volatile std::uint32_t*>(rcc_enable_register<p>());
+    reg &= ~rcc_enable_mask<p>();
+}
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,191 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32f0xx.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @project    stm-utils
+ * @brief      Device traits for STM32F0xx devices (generated by scripts/generate_traits.py, do not edit)
+ *
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_STM32F0XX_H__
+#define __STM_UTILS_DEVICE_TRAITS_STM32F0XX_H__
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ============================================================= Types ============================================================ */
+
+/// Peripherals clocked through RCC enable bits (union over all devices of the family)
+enum class peripheral {
+    adc,
+    can,
+    cec,
+    crc,
+    crs,
+    dac,
+    dbgmcu,
+    dma1,
+    dma2,
+    flitf,
+    gpioa,
+    gpiob,
+    gpioc,
+    gpiod,
+    gpiof,
+    i2c1,
+    i2c2,
+    pwr,
+    spi1,
+    spi2,
+    sram,
+    syscfg,
+    tim1,
+    tim14,
+    tim15,
+    tim16,
+    tim17,
+    tim2,
+    tim3,
+    tim6,
+    tim7,
+    tsc,
+    usart1,
+    usart2,
+    usart3,
+    usart4,
+    usart5,
+    usart6,
+    usart7,
+    usart8,
+    wwdg
+};
+
+/* ============================================================ Traits ============================================================ */
+
+template<> struct exti_line<0> : irqn_trait<5> { }; // EXTI0_1
+template<> struct exti_line<1> : irqn_trait<5> { }; // EXTI0_1
+template<> struct exti_line<2> : irqn_trait<6> { }; // EXTI2_3
+template<> struct exti_line<3> : irqn_trait<6> { }; // EXTI2_3
+template<> struct exti_line<4> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<5> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<6> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<7> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<8> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<9> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<10> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<11> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<12> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<13> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<14> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<15> : irqn_trait<7> { }; // EXTI4_15
+template<> struct dma_stream<1, 1> : irqn_trait<9> { }; // DMA1_CH1
+template<> struct rcc_enable<peripheral::adc> : rcc_bit_trait<0x18, 9> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0x14, 6> { }; // AHBENR
+template<> struct rcc_enable<peripheral::dbgmcu> : rcc_bit_trait<0x18, 22> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::dma1> : rcc_bit_trait<0x14, 0> { }; // AHBENR
+template<> struct rcc_enable<peripheral::flitf> : rcc_bit_trait<0x14, 4> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioa> : rcc_bit_trait<0x14, 17> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpiob> : rcc_bit_trait<0x14, 18> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioc> : rcc_bit_trait<0x14, 19> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpiof> : rcc_bit_trait<0x14, 22> { }; // AHBENR
+template<> struct rcc_enable<peripheral::i2c1> : rcc_bit_trait<0x1C, 21> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::i2c2> : rcc_bit_trait<0x1C, 22> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::pwr> : rcc_bit_trait<0x1C, 28> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0x18, 12> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi2> : rcc_bit_trait<0x1C, 14> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::sram> : rcc_bit_trait<0x14, 2> { }; // AHBENR
+template<> struct rcc_enable<peripheral::syscfg> : rcc_bit_trait<0x18, 0> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim1> : rcc_bit_trait<0x18, 11> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim14> : rcc_bit_trait<0x1C, 8> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim15> : rcc_bit_trait<0x18, 16> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim16> : rcc_bit_trait<0x18, 17> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim17> : rcc_bit_trait<0x18, 18> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim3> : rcc_bit_trait<0x1C, 1> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim6> : rcc_bit_trait<0x1C, 4> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim7> : rcc_bit_trait<0x1C, 5> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0x18, 14> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart2> : rcc_bit_trait<0x1C, 17> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart3> : rcc_bit_trait<0x1C, 18> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart4> : rcc_bit_trait<0x1C, 19> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::wwdg> : rcc_bit_trait<0x1C, 11> { }; // APB1ENR
+
+#if defined(STM32F030x6) || defined(STM32F030x8) || defined(STM32F070x6) || defined(STM32F070xB) || defined(STM32F030xC)
+
+template<> struct dma_stream<1, 4> : irqn_trait<11> { }; // DMA1_CH4_5
+template<> struct dma_stream<1, 5> : irqn_trait<11> { }; // DMA1_CH4_5
+
+#endif
+
+#if defined(STM32F030x6) || defined(STM32F030x8) || defined(STM32F070x6) || defined(STM32F070xB) || defined(STM32F030xC) || \
+    defined(STM32F031x6) || defined(STM32F051x8) || defined(STM32F071xB) || defined(STM32F091xC) || defined(STM32F038xx) || \
+    defined(STM32F048xx) || defined(STM32F058xx) || defined(STM32F078xx) || defined(STM32F098xx)
+
+template<> struct rcc_enable<peripheral::usart5> : rcc_bit_trait<0x1C, 20> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F030x6) || defined(STM32F030x8) || defined(STM32F070x6) || defined(STM32F070xB) || defined(STM32F030xC) || \
+    defined(STM32F042x6) || defined(STM32F072xB)
+
+template<> struct dma_stream<1, 2> : irqn_trait<10> { }; // DMA1_CH2_3
+template<> struct dma_stream<1, 3> : irqn_trait<10> { }; // DMA1_CH2_3
+
+#endif
+
+#if defined(STM32F031x6) || defined(STM32F051x8) || defined(STM32F071xB) || defined(STM32F091xC)
+
+template<> struct rcc_enable<peripheral::usart6> : rcc_bit_trait<0x18, 5> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart7> : rcc_bit_trait<0x18, 6> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart8> : rcc_bit_trait<0x18, 7> { }; // APB2ENR
+
+#endif
+
+#if defined(STM32F031x6) || defined(STM32F051x8) || defined(STM32F071xB) || defined(STM32F091xC) || defined(STM32F042x6) || \
+    defined(STM32F072xB) || defined(STM32F038xx) || defined(STM32F048xx) || defined(STM32F058xx) || defined(STM32F078xx) || \
+    defined(STM32F098xx)
+
+template<> struct rcc_enable<peripheral::can> : rcc_bit_trait<0x1C, 25> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::cec> : rcc_bit_trait<0x1C, 30> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::crs> : rcc_bit_trait<0x1C, 27> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::dac> : rcc_bit_trait<0x1C, 29> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::gpiod> : rcc_bit_trait<0x14, 20> { }; // AHBENR
+template<> struct rcc_enable<peripheral::tim2> : rcc_bit_trait<0x1C, 0> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tsc> : rcc_bit_trait<0x14, 24> { }; // AHBENR
+
+#endif
+
+#if defined(STM32F031x6) || defined(STM32F051x8) || defined(STM32F071xB) || defined(STM32F091xC) || defined(STM32F038xx) || \
+    defined(STM32F048xx) || defined(STM32F058xx) || defined(STM32F078xx) || defined(STM32F098xx)
+
+template<> struct dma_stream<1, 2> : irqn_trait<10> { }; // DMA1_CH2_3_DMA2_CH1_2
+template<> struct dma_stream<1, 3> : irqn_trait<10> { }; // DMA1_CH2_3_DMA2_CH1_2
+template<> struct dma_stream<1, 4> : irqn_trait<11> { }; // DMA1_CH4_5_6_7_DMA2_CH3_4_5
+template<> struct dma_stream<1, 5> : irqn_trait<11> { }; // DMA1_CH4_5_6_7_DMA2_CH3_4_5
+template<> struct dma_stream<1, 6> : irqn_trait<11> { }; // DMA1_CH4_5_6_7_DMA2_CH3_4_5
+template<> struct dma_stream<1, 7> : irqn_trait<11> { }; // DMA1_CH4_5_6_7_DMA2_CH3_4_5
+template<> struct dma_stream<2, 1> : irqn_trait<10> { }; // DMA1_CH2_3_DMA2_CH1_2
+template<> struct dma_stream<2, 2> : irqn_trait<10> { }; // DMA1_CH2_3_DMA2_CH1_2
+template<> struct dma_stream<2, 3> : irqn_trait<11> { }; // DMA1_CH4_5_6_7_DMA2_CH3_4_5
+template<> struct dma_stream<2, 4> : irqn_trait<11> { }; // DMA1_CH4_5_6_7_DMA2_CH3_4_5
+template<> struct dma_stream<2, 5> : irqn_trait<11> { }; // DMA1_CH4_5_6_7_DMA2_CH3_4_5
+template<> struct rcc_enable<peripheral::dma2> : rcc_bit_trait<0x14, 1> { }; // AHBENR
+
+#endif
+
+#if defined(STM32F042x6) || defined(STM32F072xB)
+
+template<> struct dma_stream<1, 4> : irqn_trait<11> { }; // DMA1_CH4_5_6_7
+template<> struct dma_stream<1, 5> : irqn_trait<11> { }; // DMA1_CH4_5_6_7
+template<> struct dma_stream<1, 6> : irqn_trait<11> { }; // DMA1_CH4_5_6_7
+template<> struct dma_stream<1, 7> : irqn_trait<11> { }; // DMA1_CH4_5_6_7
+
+#endif
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
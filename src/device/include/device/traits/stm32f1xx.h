@@ -0,0 +1,245 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32f1xx.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @project    stm-utils
+ * @brief      Device traits for STM32F1xx devices (generated by scripts/generate_traits.py, do not edit)
+ *
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_STM32F1XX_H__
+#define __STM_UTILS_DEVICE_TRAITS_STM32F1XX_H__
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ============================================================= Types ============================================================ */
+
+/// Peripherals clocked through RCC enable bits (union over all devices of the family)
+enum class peripheral {
+    adc1,
+    adc2,
+    adc3,
+    afio,
+    bkp,
+    can,
+    can1,
+    can2,
+    cec,
+    crc,
+    dac,
+    dma1,
+    dma2,
+    ethmac,
+    ethmacrx,
+    ethmactx,
+    flitf,
+    fsmc,
+    gpioa,
+    gpiob,
+    gpioc,
+    gpiod,
+    gpioe,
+    gpiof,
+    gpiog,
+    i2c1,
+    i2c2,
+    otgfs,
+    pwr,
+    sdio,
+    spi1,
+    spi2,
+    spi3,
+    sram,
+    tim1,
+    tim10,
+    tim11,
+    tim12,
+    tim13,
+    tim14,
+    tim15,
+    tim16,
+    tim17,
+    tim2,
+    tim3,
+    tim4,
+    tim5,
+    tim6,
+    tim7,
+    tim8,
+    tim9,
+    uart4,
+    uart5,
+    usart1,
+    usart2,
+    usart3,
+    usb,
+    wwdg
+};
+
+/* ============================================================ Traits ============================================================ */
+
+template<> struct exti_line<0> : irqn_trait<6> { }; // EXTI0
+template<> struct exti_line<1> : irqn_trait<7> { }; // EXTI1
+template<> struct exti_line<2> : irqn_trait<8> { }; // EXTI2
+template<> struct exti_line<3> : irqn_trait<9> { }; // EXTI3
+template<> struct exti_line<4> : irqn_trait<10> { }; // EXTI4
+template<> struct exti_line<5> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<6> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<7> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<8> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<9> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<10> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<11> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<12> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<13> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<14> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<15> : irqn_trait<40> { }; // EXTI15_10
+template<> struct dma_stream<1, 1> : irqn_trait<11> { }; // DMA1_Channel1
+template<> struct dma_stream<1, 2> : irqn_trait<12> { }; // DMA1_Channel2
+template<> struct dma_stream<1, 3> : irqn_trait<13> { }; // DMA1_Channel3
+template<> struct dma_stream<1, 4> : irqn_trait<14> { }; // DMA1_Channel4
+template<> struct dma_stream<1, 5> : irqn_trait<15> { }; // DMA1_Channel5
+template<> struct dma_stream<1, 6> : irqn_trait<16> { }; // DMA1_Channel6
+template<> struct dma_stream<1, 7> : irqn_trait<17> { }; // DMA1_Channel7
+template<> struct rcc_enable<peripheral::adc1> : rcc_bit_trait<0x18, 9> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::afio> : rcc_bit_trait<0x18, 0> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::bkp> : rcc_bit_trait<0x1C, 27> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0x14, 6> { }; // AHBENR
+template<> struct rcc_enable<peripheral::dma1> : rcc_bit_trait<0x14, 0> { }; // AHBENR
+template<> struct rcc_enable<peripheral::dma2> : rcc_bit_trait<0x14, 1> { }; // AHBENR
+template<> struct rcc_enable<peripheral::flitf> : rcc_bit_trait<0x14, 4> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioa> : rcc_bit_trait<0x18, 2> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::gpiob> : rcc_bit_trait<0x18, 3> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::gpioc> : rcc_bit_trait<0x18, 4> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::gpiod> : rcc_bit_trait<0x18, 5> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::i2c1> : rcc_bit_trait<0x1C, 21> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::pwr> : rcc_bit_trait<0x1C, 28> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0x18, 12> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::sram> : rcc_bit_trait<0x14, 2> { }; // AHBENR
+template<> struct rcc_enable<peripheral::tim2> : rcc_bit_trait<0x1C, 0> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim3> : rcc_bit_trait<0x1C, 1> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0x18, 14> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart2> : rcc_bit_trait<0x1C, 17> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::wwdg> : rcc_bit_trait<0x1C, 11> { }; // APB1ENR
+
+#if defined(STM32F100xB) || defined(STM32F100xE)
+
+template<> struct rcc_enable<peripheral::cec> : rcc_bit_trait<0x1C, 30> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim15> : rcc_bit_trait<0x18, 16> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim16> : rcc_bit_trait<0x18, 17> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim17> : rcc_bit_trait<0x18, 18> { }; // APB2ENR
+
+#endif
+
+#if defined(STM32F100xB) || defined(STM32F100xE) || defined(STM32F101x6) || defined(STM32F101xB) || defined(STM32F101xE) || \
+    defined(STM32F101xG) || defined(STM32F102x6) || defined(STM32F102xB) || defined(STM32F103x6) || defined(STM32F103xB) || \
+    defined(STM32F103xE) || defined(STM32F103xG)
+
+template<> struct dma_stream<2, 4> : irqn_trait<59> { }; // DMA2_Channel4_5
+template<> struct dma_stream<2, 5> : irqn_trait<59> { }; // DMA2_Channel4_5
+
+#endif
+
+#if defined(STM32F100xB) || defined(STM32F100xE) || defined(STM32F101x6) || defined(STM32F101xB) || defined(STM32F101xE) || \
+    defined(STM32F101xG) || defined(STM32F103x6) || defined(STM32F103xB) || defined(STM32F103xE) || defined(STM32F103xG)
+
+template<> struct rcc_enable<peripheral::fsmc> : rcc_bit_trait<0x14, 8> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpiof> : rcc_bit_trait<0x18, 7> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::gpiog> : rcc_bit_trait<0x18, 8> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim12> : rcc_bit_trait<0x1C, 6> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim13> : rcc_bit_trait<0x1C, 7> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim14> : rcc_bit_trait<0x1C, 8> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F100xB) || defined(STM32F100xE) || defined(STM32F101x6) || defined(STM32F101xB) || defined(STM32F101xE) || \
+    defined(STM32F101xG) || defined(STM32F103x6) || defined(STM32F103xB) || defined(STM32F103xE) || defined(STM32F103xG) || \
+    defined(STM32F105xC) || defined(STM32F107xC)
+
+template<> struct rcc_enable<peripheral::dac> : rcc_bit_trait<0x1C, 29> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::gpioe> : rcc_bit_trait<0x18, 6> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::i2c2> : rcc_bit_trait<0x1C, 22> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::spi2> : rcc_bit_trait<0x1C, 14> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::spi3> : rcc_bit_trait<0x1C, 15> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim4> : rcc_bit_trait<0x1C, 2> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim5> : rcc_bit_trait<0x1C, 3> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim6> : rcc_bit_trait<0x1C, 4> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim7> : rcc_bit_trait<0x1C, 5> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::uart4> : rcc_bit_trait<0x1C, 19> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::uart5> : rcc_bit_trait<0x1C, 20> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart3> : rcc_bit_trait<0x1C, 18> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F100xB) || defined(STM32F100xE) || defined(STM32F102x6) || defined(STM32F102xB) || defined(STM32F103x6) || \
+    defined(STM32F103xB) || defined(STM32F103xE) || defined(STM32F103xG) || defined(STM32F105xC) || defined(STM32F107xC)
+
+template<> struct dma_stream<2, 1> : irqn_trait<56> { }; // DMA2_Channel1
+template<> struct dma_stream<2, 2> : irqn_trait<57> { }; // DMA2_Channel2
+template<> struct dma_stream<2, 3> : irqn_trait<58> { }; // DMA2_Channel3
+
+#endif
+
+#if defined(STM32F100xB) || defined(STM32F100xE) || defined(STM32F103x6) || defined(STM32F103xB) || defined(STM32F103xE) || \
+    defined(STM32F103xG) || defined(STM32F105xC) || defined(STM32F107xC)
+
+template<> struct rcc_enable<peripheral::tim1> : rcc_bit_trait<0x18, 11> { }; // APB2ENR
+
+#endif
+
+#if defined(STM32F101x6) || defined(STM32F101xB) || defined(STM32F101xE) || defined(STM32F101xG)
+
+template<> struct dma_stream<2, 1> : irqn_trait<56> { }; // DMA2_CH1
+template<> struct dma_stream<2, 2> : irqn_trait<57> { }; // DMA2_CH2
+template<> struct dma_stream<2, 3> : irqn_trait<58> { }; // DMA2_CH3
+
+#endif
+
+#if defined(STM32F101x6) || defined(STM32F101xB) || defined(STM32F101xE) || defined(STM32F101xG) || defined(STM32F103x6) || \
+    defined(STM32F103xB) || defined(STM32F103xE) || defined(STM32F103xG)
+
+template<> struct rcc_enable<peripheral::tim10> : rcc_bit_trait<0x18, 20> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim11> : rcc_bit_trait<0x18, 21> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim9> : rcc_bit_trait<0x18, 19> { }; // APB2ENR
+
+#endif
+
+#if defined(STM32F103x6) || defined(STM32F103xB) || defined(STM32F103xE) || defined(STM32F103xG)
+
+template<> struct rcc_enable<peripheral::adc3> : rcc_bit_trait<0x18, 15> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::can> : rcc_bit_trait<0x1C, 25> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::sdio> : rcc_bit_trait<0x14, 10> { }; // AHBENR
+template<> struct rcc_enable<peripheral::tim8> : rcc_bit_trait<0x18, 13> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usb> : rcc_bit_trait<0x1C, 23> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F103x6) || defined(STM32F103xB) || defined(STM32F103xE) || defined(STM32F103xG) || defined(STM32F105xC) || \
+    defined(STM32F107xC)
+
+template<> struct rcc_enable<peripheral::adc2> : rcc_bit_trait<0x18, 10> { }; // APB2ENR
+
+#endif
+
+#if defined(STM32F105xC) || defined(STM32F107xC)
+
+template<> struct dma_stream<2, 4> : irqn_trait<59> { }; // DMA2_Channel4
+template<> struct dma_stream<2, 5> : irqn_trait<60> { }; // DMA2_Channel5
+template<> struct rcc_enable<peripheral::can1> : rcc_bit_trait<0x1C, 25> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::can2> : rcc_bit_trait<0x1C, 26> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::ethmac> : rcc_bit_trait<0x14, 14> { }; // AHBENR
+template<> struct rcc_enable<peripheral::ethmacrx> : rcc_bit_trait<0x14, 16> { }; // AHBENR
+template<> struct rcc_enable<peripheral::ethmactx> : rcc_bit_trait<0x14, 15> { }; // AHBENR
+template<> struct rcc_enable<peripheral::otgfs> : rcc_bit_trait<0x14, 12> { }; // AHBENR
+
+#endif
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,294 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32f3xx.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @project    stm-utils
+ * @brief      Device traits for STM32F3xx devices (generated by scripts/generate_traits.py, do not edit)
+ *
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_STM32F3XX_H__
+#define __STM_UTILS_DEVICE_TRAITS_STM32F3XX_H__
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ============================================================= Types ============================================================ */
+
+/// Peripherals clocked through RCC enable bits (union over all devices of the family)
+enum class peripheral {
+    adc,
+    adc1,
+    adc12,
+    adc34,
+    can,
+    cec,
+    crc,
+    dac,
+    dac2,
+    dac3,
+    dbgmcu,
+    dma1,
+    dma2,
+    flitf,
+    fmc,
+    gpioa,
+    gpiob,
+    gpioc,
+    gpiod,
+    gpioe,
+    gpiof,
+    gpiog,
+    gpioh,
+    i2c1,
+    i2c2,
+    i2c3,
+    pwr,
+    sdad1,
+    sdad2,
+    sdad3,
+    spi1,
+    spi2,
+    spi3,
+    sram,
+    syscfg,
+    tim1,
+    tim12,
+    tim13,
+    tim14,
+    tim15,
+    tim16,
+    tim17,
+    tim18,
+    tim19,
+    tim2,
+    tim3,
+    tim4,
+    tim5,
+    tim6,
+    tim7,
+    tim8,
+    tsc,
+    usart1,
+    usart2,
+    usart3,
+    usart4,
+    usart5,
+    usb,
+    wwdg
+};
+
+/* ============================================================ Traits ============================================================ */
+
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0x14, 6> { }; // AHBENR
+template<> struct rcc_enable<peripheral::dac> : rcc_bit_trait<0x1C, 29> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::dma1> : rcc_bit_trait<0x14, 0> { }; // AHBENR
+template<> struct rcc_enable<peripheral::flitf> : rcc_bit_trait<0x14, 4> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioa> : rcc_bit_trait<0x14, 17> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpiob> : rcc_bit_trait<0x14, 18> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioc> : rcc_bit_trait<0x14, 19> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpiod> : rcc_bit_trait<0x14, 20> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpiof> : rcc_bit_trait<0x14, 22> { }; // AHBENR
+template<> struct rcc_enable<peripheral::i2c1> : rcc_bit_trait<0x1C, 21> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::i2c2> : rcc_bit_trait<0x1C, 22> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::pwr> : rcc_bit_trait<0x1C, 28> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::spi2> : rcc_bit_trait<0x1C, 14> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::spi3> : rcc_bit_trait<0x1C, 15> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::sram> : rcc_bit_trait<0x14, 2> { }; // AHBENR
+template<> struct rcc_enable<peripheral::syscfg> : rcc_bit_trait<0x18, 0> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim1> : rcc_bit_trait<0x18, 11> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim15> : rcc_bit_trait<0x18, 16> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim16> : rcc_bit_trait<0x18, 17> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim17> : rcc_bit_trait<0x18, 18> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim2> : rcc_bit_trait<0x1C, 0> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim6> : rcc_bit_trait<0x1C, 4> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tsc> : rcc_bit_trait<0x14, 24> { }; // AHBENR
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0x18, 14> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart2> : rcc_bit_trait<0x1C, 17> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::wwdg> : rcc_bit_trait<0x1C, 11> { }; // APB1ENR
+
+#if defined(STM32F301x8)
+
+template<> struct exti_line<0> : irqn_trait<6> { }; // EXTI0_IRQ
+template<> struct exti_line<1> : irqn_trait<7> { }; // EXTI1_IRQ
+template<> struct exti_line<2> : irqn_trait<8> { }; // EXTI2_RI_IRQ
+template<> struct exti_line<3> : irqn_trait<9> { }; // EXTI3_IRQ
+template<> struct exti_line<4> : irqn_trait<10> { }; // EXTI4_IRQ
+template<> struct exti_line<5> : irqn_trait<23> { }; // EXTI5_9_IRQ
+template<> struct exti_line<6> : irqn_trait<23> { }; // EXTI5_9_IRQ
+template<> struct exti_line<7> : irqn_trait<23> { }; // EXTI5_9_IRQ
+template<> struct exti_line<8> : irqn_trait<23> { }; // EXTI5_9_IRQ
+template<> struct exti_line<9> : irqn_trait<23> { }; // EXTI5_9_IRQ
+template<> struct rcc_enable<peripheral::adc1> : rcc_bit_trait<0x14, 28> { }; // AHBENR
+
+#endif
+
+#if defined(STM32F301x8) || defined(STM32F302x8) || defined(STM32F302xC) || defined(STM32F302xE) || defined(STM32F303xC) || \
+    defined(STM32F303x8) || defined(STM32F303xE) || defined(STM32F373xC) || defined(STM32F334x8)
+
+template<> struct dma_stream<1, 1> : irqn_trait<11> { }; // DMA1_CH1
+template<> struct dma_stream<1, 2> : irqn_trait<12> { }; // DMA1_CH2
+template<> struct dma_stream<1, 3> : irqn_trait<13> { }; // DMA1_CH3
+template<> struct dma_stream<1, 4> : irqn_trait<14> { }; // DMA1_CH4
+template<> struct dma_stream<1, 5> : irqn_trait<15> { }; // DMA1_CH5
+template<> struct dma_stream<1, 6> : irqn_trait<16> { }; // DMA1_CH6
+template<> struct dma_stream<1, 7> : irqn_trait<17> { }; // DMA1_CH7
+
+#endif
+
+#if defined(STM32F301x8) || defined(STM32F303xC) || defined(STM32F303x8) || defined(STM32F303xE) || defined(STM32F373xC) || \
+    defined(STM32F318xx) || defined(STM32F358xx) || defined(STM32F328xx) || defined(STM32F398xx) || defined(STM32F378xx)
+
+template<> struct rcc_enable<peripheral::usart3> : rcc_bit_trait<0x1C, 18> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F301x8) || defined(STM32F373xC) || defined(STM32F318xx) || defined(STM32F358xx) || defined(STM32F328xx) || \
+    defined(STM32F398xx) || defined(STM32F378xx)
+
+template<> struct rcc_enable<peripheral::cec> : rcc_bit_trait<0x1C, 30> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F301x8) || defined(STM32F318xx) || defined(STM32F358xx) || defined(STM32F328xx) || defined(STM32F398xx) || \
+    defined(STM32F378xx)
+
+template<> struct exti_line<10> : irqn_trait<40> { }; // EXTI15_10_IRQ
+template<> struct exti_line<11> : irqn_trait<40> { }; // EXTI15_10_IRQ
+template<> struct exti_line<12> : irqn_trait<40> { }; // EXTI15_10_IRQ
+template<> struct exti_line<13> : irqn_trait<40> { }; // EXTI15_10_IRQ
+template<> struct exti_line<14> : irqn_trait<40> { }; // EXTI15_10_IRQ
+template<> struct exti_line<15> : irqn_trait<40> { }; // EXTI15_10_IRQ
+
+#endif
+
+#if defined(STM32F302x8) || defined(STM32F302xC) || defined(STM32F302xE) || defined(STM32F303xC) || defined(STM32F303x8) || \
+    defined(STM32F303xE) || defined(STM32F373xC)
+
+template<> struct dma_stream<2, 1> : irqn_trait<56> { }; // DMA2_CH1
+template<> struct dma_stream<2, 2> : irqn_trait<57> { }; // DMA2_CH2
+template<> struct dma_stream<2, 3> : irqn_trait<58> { }; // DMA2_CH3
+template<> struct dma_stream<2, 4> : irqn_trait<59> { }; // DMA2_CH4
+template<> struct dma_stream<2, 5> : irqn_trait<60> { }; // DMA2_CH5
+
+#endif
+
+#if defined(STM32F302x8) || defined(STM32F302xC) || defined(STM32F302xE) || defined(STM32F303xC) || defined(STM32F303x8) || \
+    defined(STM32F303xE) || defined(STM32F373xC) || defined(STM32F334x8)
+
+template<> struct exti_line<10> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<11> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<12> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<13> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<14> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<15> : irqn_trait<40> { }; // EXTI15_10
+
+#endif
+
+#if defined(STM32F302x8) || defined(STM32F302xC) || defined(STM32F302xE) || defined(STM32F303xC) || defined(STM32F303x8) || \
+    defined(STM32F303xE) || defined(STM32F373xC) || defined(STM32F334x8) || defined(STM32F318xx) || defined(STM32F358xx) || \
+    defined(STM32F328xx) || defined(STM32F398xx) || defined(STM32F378xx)
+
+template<> struct exti_line<0> : irqn_trait<6> { }; // EXTI0
+template<> struct exti_line<1> : irqn_trait<7> { }; // EXTI1
+template<> struct exti_line<3> : irqn_trait<9> { }; // EXTI3
+template<> struct exti_line<4> : irqn_trait<10> { }; // EXTI4
+template<> struct rcc_enable<peripheral::can> : rcc_bit_trait<0x1C, 25> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::dma2> : rcc_bit_trait<0x14, 1> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioe> : rcc_bit_trait<0x14, 21> { }; // AHBENR
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0x18, 12> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim3> : rcc_bit_trait<0x1C, 1> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim4> : rcc_bit_trait<0x1C, 2> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim7> : rcc_bit_trait<0x1C, 5> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usb> : rcc_bit_trait<0x1C, 23> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F302x8) || defined(STM32F302xC) || defined(STM32F302xE) || defined(STM32F303xC) || defined(STM32F303x8) || \
+    defined(STM32F303xE) || defined(STM32F334x8)
+
+template<> struct rcc_enable<peripheral::adc12> : rcc_bit_trait<0x14, 28> { }; // AHBENR
+template<> struct rcc_enable<peripheral::adc34> : rcc_bit_trait<0x14, 29> { }; // AHBENR
+template<> struct rcc_enable<peripheral::tim8> : rcc_bit_trait<0x18, 13> { }; // APB2ENR
+
+#endif
+
+#if defined(STM32F302x8) || defined(STM32F302xC) || defined(STM32F302xE) || defined(STM32F303xC) || defined(STM32F303x8) || \
+    defined(STM32F303xE) || defined(STM32F334x8) || defined(STM32F318xx) || defined(STM32F358xx) || defined(STM32F328xx) || \
+    defined(STM32F398xx) || defined(STM32F378xx)
+
+template<> struct exti_line<2> : irqn_trait<8> { }; // EXTI2_TSC
+template<> struct exti_line<5> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<6> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<7> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<8> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<9> : irqn_trait<23> { }; // EXTI9_5
+
+#endif
+
+#if defined(STM32F303xC) || defined(STM32F303x8) || defined(STM32F303xE)
+
+template<> struct rcc_enable<peripheral::dac2> : rcc_bit_trait<0x1C, 26> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::fmc> : rcc_bit_trait<0x14, 5> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpiog> : rcc_bit_trait<0x14, 23> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioh> : rcc_bit_trait<0x14, 16> { }; // AHBENR
+template<> struct rcc_enable<peripheral::i2c3> : rcc_bit_trait<0x1C, 30> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart4> : rcc_bit_trait<0x1C, 19> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart5> : rcc_bit_trait<0x1C, 20> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F373xC)
+
+template<> struct exti_line<2> : irqn_trait<8> { }; // EXTI2_TS
+template<> struct exti_line<5> : irqn_trait<23> { }; // EXTI5_9
+template<> struct exti_line<6> : irqn_trait<23> { }; // EXTI5_9
+template<> struct exti_line<7> : irqn_trait<23> { }; // EXTI5_9
+template<> struct exti_line<8> : irqn_trait<23> { }; // EXTI5_9
+template<> struct exti_line<9> : irqn_trait<23> { }; // EXTI5_9
+
+#endif
+
+#if defined(STM32F373xC) || defined(STM32F318xx) || defined(STM32F358xx) || defined(STM32F328xx) || defined(STM32F398xx) || \
+    defined(STM32F378xx)
+
+template<> struct rcc_enable<peripheral::adc> : rcc_bit_trait<0x18, 9> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::dac3> : rcc_bit_trait<0x1C, 26> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::dbgmcu> : rcc_bit_trait<0x18, 22> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::sdad1> : rcc_bit_trait<0x18, 24> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::sdad2> : rcc_bit_trait<0x18, 25> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::sdad3> : rcc_bit_trait<0x18, 26> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim12> : rcc_bit_trait<0x1C, 6> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim13> : rcc_bit_trait<0x1C, 7> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim14> : rcc_bit_trait<0x1C, 8> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim18> : rcc_bit_trait<0x1C, 9> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim19> : rcc_bit_trait<0x18, 19> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim5> : rcc_bit_trait<0x1C, 3> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F318xx) || defined(STM32F358xx) || defined(STM32F328xx) || defined(STM32F398xx) || defined(STM32F378xx)
+
+template<> struct dma_stream<1, 1> : irqn_trait<11> { }; // DMA1_CH1_IRQ
+template<> struct dma_stream<1, 2> : irqn_trait<12> { }; // DMA1_CH2_IRQ
+template<> struct dma_stream<1, 3> : irqn_trait<13> { }; // DMA1_CH3_IRQ
+template<> struct dma_stream<1, 4> : irqn_trait<14> { }; // DMA1_CH4_IRQ
+template<> struct dma_stream<1, 5> : irqn_trait<15> { }; // DMA1_CH5_IRQ
+template<> struct dma_stream<1, 6> : irqn_trait<16> { }; // DMA1_CH6_IRQ
+template<> struct dma_stream<1, 7> : irqn_trait<17> { }; // DMA1_CH7_IRQ
+template<> struct dma_stream<2, 1> : irqn_trait<56> { }; // DMA2_Channel1
+template<> struct dma_stream<2, 2> : irqn_trait<57> { }; // DMA2_Channel2
+template<> struct dma_stream<2, 3> : irqn_trait<58> { }; // DMA2_Channel3
+template<> struct dma_stream<2, 4> : irqn_trait<59> { }; // DMA2_Channel4
+template<> struct dma_stream<2, 5> : irqn_trait<60> { }; // DMA2_Channel5
+
+#endif
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
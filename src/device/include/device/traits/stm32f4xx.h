@@ -0,0 +1,371 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32f4xx.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @project    stm-utils
+ * @brief      Device traits for STM32F4xx devices (generated by scripts/generate_traits.py, do not edit)
+ *
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_STM32F4XX_H__
+#define __STM_UTILS_DEVICE_TRAITS_STM32F4XX_H__
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ============================================================= Types ============================================================ */
+
+/// Peripherals clocked through RCC enable bits (union over all devices of the family)
+enum class peripheral {
+    adc1,
+    adc2,
+    adc3,
+    bkpsram,
+    can1,
+    can2,
+    can3,
+    ccmdataram,
+    crc,
+    cryp,
+    dac,
+    dcmi,
+    dfsdm1,
+    dfsdm2,
+    dma1,
+    dma2,
+    dma2d,
+    dsi,
+    ethmac,
+    ethmacptp,
+    ethmacrx,
+    ethmactx,
+    extit,
+    fmc,
+    fmpi2c1,
+    fsmc,
+    gpioa,
+    gpiob,
+    gpioc,
+    gpiod,
+    gpioe,
+    gpiof,
+    gpiog,
+    gpioh,
+    gpioi,
+    gpioj,
+    gpiok,
+    hash,
+    i2c1,
+    i2c2,
+    i2c3,
+    i2c4,
+    lptim1,
+    ltdc,
+    otgfs,
+    otghs,
+    otghsulpi,
+    pwr,
+    qspi,
+    rng,
+    rtcapb,
+    sai1,
+    sai2,
+    sdio,
+    spdif,
+    spi1,
+    spi2,
+    spi3,
+    spi4,
+    spi5,
+    syscfg,
+    tim1,
+    tim10,
+    tim11,
+    tim12,
+    tim13,
+    tim14,
+    tim2,
+    tim3,
+    tim4,
+    tim5,
+    tim6,
+    tim7,
+    tim8,
+    tim9,
+    uart4,
+    uart5,
+    uart7,
+    uart8,
+    usart1,
+    usart2,
+    usart3,
+    usart6,
+    wwdg
+};
+
+/* ============================================================ Traits ============================================================ */
+
+template<> struct exti_line<0> : irqn_trait<6> { }; // EXTI0
+template<> struct exti_line<1> : irqn_trait<7> { }; // EXTI1
+template<> struct exti_line<2> : irqn_trait<8> { }; // EXTI2
+template<> struct exti_line<3> : irqn_trait<9> { }; // EXTI3
+template<> struct exti_line<4> : irqn_trait<10> { }; // EXTI4
+template<> struct exti_line<5> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<6> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<7> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<8> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<9> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<10> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<11> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<12> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<13> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<14> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<15> : irqn_trait<40> { }; // EXTI15_10
+template<> struct dma_stream<1, 0> : irqn_trait<11> { }; // DMA1_Stream0
+template<> struct dma_stream<1, 1> : irqn_trait<12> { }; // DMA1_Stream1
+template<> struct dma_stream<1, 2> : irqn_trait<13> { }; // DMA1_Stream2
+template<> struct dma_stream<1, 3> : irqn_trait<14> { }; // DMA1_Stream3
+template<> struct dma_stream<1, 4> : irqn_trait<15> { }; // DMA1_Stream4
+template<> struct dma_stream<1, 5> : irqn_trait<16> { }; // DMA1_Stream5
+template<> struct dma_stream<1, 6> : irqn_trait<17> { }; // DMA1_Stream6
+template<> struct dma_stream<1, 7> : irqn_trait<47> { }; // DMA1_Stream7
+template<> struct dma_stream<2, 0> : irqn_trait<56> { }; // DMA2_Stream0
+template<> struct dma_stream<2, 1> : irqn_trait<57> { }; // DMA2_Stream1
+template<> struct dma_stream<2, 2> : irqn_trait<58> { }; // DMA2_Stream2
+template<> struct dma_stream<2, 3> : irqn_trait<59> { }; // DMA2_Stream3
+template<> struct dma_stream<2, 4> : irqn_trait<60> { }; // DMA2_Stream4
+template<> struct dma_stream<2, 5> : irqn_trait<68> { }; // DMA2_Stream5
+template<> struct dma_stream<2, 6> : irqn_trait<69> { }; // DMA2_Stream6
+template<> struct dma_stream<2, 7> : irqn_trait<70> { }; // DMA2_Stream7
+template<> struct rcc_enable<peripheral::adc1> : rcc_bit_trait<0x44, 8> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0x30, 12> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dma1> : rcc_bit_trait<0x30, 21> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dma2> : rcc_bit_trait<0x30, 22> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::gpioa> : rcc_bit_trait<0x30, 0> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::gpiob> : rcc_bit_trait<0x30, 1> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::gpioc> : rcc_bit_trait<0x30, 2> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::gpioh> : rcc_bit_trait<0x30, 7> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::i2c1> : rcc_bit_trait<0x40, 21> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::i2c2> : rcc_bit_trait<0x40, 22> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::pwr> : rcc_bit_trait<0x40, 28> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0x44, 12> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi2> : rcc_bit_trait<0x40, 14> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::syscfg> : rcc_bit_trait<0x44, 14> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim1> : rcc_bit_trait<0x44, 0> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim11> : rcc_bit_trait<0x44, 18> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim5> : rcc_bit_trait<0x40, 3> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim9> : rcc_bit_trait<0x44, 16> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0x44, 4> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart2> : rcc_bit_trait<0x40, 17> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart6> : rcc_bit_trait<0x44, 5> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::wwdg> : rcc_bit_trait<0x40, 11> { }; // APB1ENR
+
+#if defined(STM32F401xC) || defined(STM32F401xE) || defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || \
+    defined(STM32F417xx) || defined(STM32F411xE) || defined(STM32F412Cx) || defined(STM32F412Zx) || defined(STM32F412Rx) || \
+    defined(STM32F412Vx) || defined(STM32F413xx) || defined(STM32F423xx) || defined(STM32F427xx) || defined(STM32F437xx) || \
+    defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F446xx) || defined(STM32F469xx) || defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::gpiod> : rcc_bit_trait<0x30, 3> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::gpioe> : rcc_bit_trait<0x30, 4> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::i2c3> : rcc_bit_trait<0x40, 23> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::otgfs> : rcc_bit_trait<0x34, 7> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::sdio> : rcc_bit_trait<0x44, 11> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi3> : rcc_bit_trait<0x40, 15> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim10> : rcc_bit_trait<0x44, 17> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim2> : rcc_bit_trait<0x40, 0> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim3> : rcc_bit_trait<0x40, 1> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim4> : rcc_bit_trait<0x40, 2> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || defined(STM32F410Tx) || \
+    defined(STM32F410Cx) || defined(STM32F410Rx) || defined(STM32F412Cx) || defined(STM32F412Zx) || defined(STM32F412Rx) || \
+    defined(STM32F412Vx) || defined(STM32F413xx) || defined(STM32F423xx) || defined(STM32F427xx) || defined(STM32F437xx) || \
+    defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F446xx) || defined(STM32F469xx) || defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::tim6> : rcc_bit_trait<0x40, 4> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || defined(STM32F410Tx) || \
+    defined(STM32F410Cx) || defined(STM32F410Rx) || defined(STM32F413xx) || defined(STM32F423xx) || defined(STM32F427xx) || \
+    defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F446xx) || defined(STM32F469xx) || \
+    defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::dac> : rcc_bit_trait<0x40, 29> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || defined(STM32F412Cx) || \
+    defined(STM32F412Zx) || defined(STM32F412Rx) || defined(STM32F412Vx) || defined(STM32F413xx) || defined(STM32F423xx)
+
+template<> struct rcc_enable<peripheral::fsmc> : rcc_bit_trait<0x38, 0> { }; // AHB3ENR
+
+#endif
+
+#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || defined(STM32F412Cx) || \
+    defined(STM32F412Zx) || defined(STM32F412Rx) || defined(STM32F412Vx) || defined(STM32F413xx) || defined(STM32F423xx) || \
+    defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F446xx) || \
+    defined(STM32F469xx) || defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::can1> : rcc_bit_trait<0x40, 25> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::can2> : rcc_bit_trait<0x40, 26> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::gpiof> : rcc_bit_trait<0x30, 5> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::gpiog> : rcc_bit_trait<0x30, 6> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::tim12> : rcc_bit_trait<0x40, 6> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim13> : rcc_bit_trait<0x40, 7> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim14> : rcc_bit_trait<0x40, 8> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim7> : rcc_bit_trait<0x40, 5> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim8> : rcc_bit_trait<0x44, 1> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart3> : rcc_bit_trait<0x40, 18> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || defined(STM32F412Cx) || \
+    defined(STM32F412Zx) || defined(STM32F412Rx) || defined(STM32F412Vx) || defined(STM32F413xx) || defined(STM32F423xx) || \
+    defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F469xx) || \
+    defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::rng> : rcc_bit_trait<0x34, 6> { }; // AHB2ENR
+
+#endif
+
+#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || defined(STM32F413xx) || \
+    defined(STM32F423xx) || defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx) || \
+    defined(STM32F446xx) || defined(STM32F469xx) || defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::uart4> : rcc_bit_trait<0x40, 19> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::uart5> : rcc_bit_trait<0x40, 20> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || defined(STM32F427xx) || \
+    defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F446xx) || defined(STM32F469xx) || \
+    defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::adc2> : rcc_bit_trait<0x44, 9> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::adc3> : rcc_bit_trait<0x44, 10> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::bkpsram> : rcc_bit_trait<0x30, 18> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dcmi> : rcc_bit_trait<0x34, 0> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::otghs> : rcc_bit_trait<0x30, 29> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::otghsulpi> : rcc_bit_trait<0x30, 30> { }; // AHB1ENR
+
+#endif
+
+#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || defined(STM32F427xx) || \
+    defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F469xx) || defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::ccmdataram> : rcc_bit_trait<0x30, 20> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::ethmac> : rcc_bit_trait<0x30, 25> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::ethmacptp> : rcc_bit_trait<0x30, 28> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::ethmacrx> : rcc_bit_trait<0x30, 27> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::ethmactx> : rcc_bit_trait<0x30, 26> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::gpioi> : rcc_bit_trait<0x30, 8> { }; // AHB1ENR
+
+#endif
+
+#if defined(STM32F410Tx) || defined(STM32F410Cx) || defined(STM32F410Rx)
+
+template<> struct rcc_enable<peripheral::extit> : rcc_bit_trait<0x44, 15> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::rng> : rcc_bit_trait<0x30, 31> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::rtcapb> : rcc_bit_trait<0x40, 10> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F410Tx) || defined(STM32F410Cx) || defined(STM32F410Rx) || defined(STM32F412Cx) || defined(STM32F412Zx) || \
+    defined(STM32F412Rx) || defined(STM32F412Vx) || defined(STM32F413xx) || defined(STM32F423xx)
+
+template<> struct rcc_enable<peripheral::i2c4> : rcc_bit_trait<0x40, 24> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::spi5> : rcc_bit_trait<0x44, 20> { }; // APB2ENR
+
+#endif
+
+#if defined(STM32F410Tx) || defined(STM32F410Cx) || defined(STM32F410Rx) || defined(STM32F413xx) || defined(STM32F423xx)
+
+template<> struct rcc_enable<peripheral::lptim1> : rcc_bit_trait<0x40, 9> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F411xE) || defined(STM32F412Cx) || defined(STM32F412Zx) || defined(STM32F412Rx) || defined(STM32F412Vx) || \
+    defined(STM32F413xx) || defined(STM32F423xx)
+
+template<> struct rcc_enable<peripheral::spi4> : rcc_bit_trait<0x44, 13> { }; // APB2ENR
+
+#endif
+
+#if defined(STM32F412Cx) || defined(STM32F412Zx) || defined(STM32F412Rx) || defined(STM32F412Vx) || defined(STM32F413xx) || \
+    defined(STM32F423xx)
+
+template<> struct rcc_enable<peripheral::dfsdm1> : rcc_bit_trait<0x44, 24> { }; // APB2ENR
+
+#endif
+
+#if defined(STM32F412Cx) || defined(STM32F412Zx) || defined(STM32F412Rx) || defined(STM32F412Vx) || defined(STM32F413xx) || \
+    defined(STM32F423xx) || defined(STM32F446xx) || defined(STM32F469xx) || defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::qspi> : rcc_bit_trait<0x38, 1> { }; // AHB3ENR
+
+#endif
+
+#if defined(STM32F413xx) || defined(STM32F423xx)
+
+template<> struct rcc_enable<peripheral::can3> : rcc_bit_trait<0x40, 27> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::dfsdm2> : rcc_bit_trait<0x44, 25> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::uart7> : rcc_bit_trait<0x40, 30> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::uart8> : rcc_bit_trait<0x40, 31> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F413xx) || defined(STM32F423xx) || defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx) || \
+    defined(STM32F439xx) || defined(STM32F469xx) || defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::cryp> : rcc_bit_trait<0x34, 4> { }; // AHB2ENR
+
+#endif
+
+#if defined(STM32F413xx) || defined(STM32F423xx) || defined(STM32F446xx) || defined(STM32F469xx) || defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::sai1> : rcc_bit_trait<0x44, 22> { }; // APB2ENR
+
+#endif
+
+#if defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F446xx) || \
+    defined(STM32F469xx) || defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::fmc> : rcc_bit_trait<0x38, 0> { }; // AHB3ENR
+
+#endif
+
+#if defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F469xx) || \
+    defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::hash> : rcc_bit_trait<0x34, 5> { }; // AHB2ENR
+
+#endif
+
+#if defined(STM32F446xx)
+
+template<> struct rcc_enable<peripheral::fmpi2c1> : rcc_bit_trait<0x40, 24> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::sai2> : rcc_bit_trait<0x44, 23> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spdif> : rcc_bit_trait<0x40, 16> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32F469xx) || defined(STM32F479xx)
+
+template<> struct rcc_enable<peripheral::dma2d> : rcc_bit_trait<0x30, 23> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dsi> : rcc_bit_trait<0x44, 27> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::gpioj> : rcc_bit_trait<0x30, 9> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::gpiok> : rcc_bit_trait<0x30, 10> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::ltdc> : rcc_bit_trait<0x44, 26> { }; // APB2ENR
+
+#endif
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,236 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32g0xx.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @project    stm-utils
+ * @brief      Device traits for STM32G0xx devices (generated by scripts/generate_traits.py, do not edit)
+ *
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_STM32G0XX_H__
+#define __STM_UTILS_DEVICE_TRAITS_STM32G0XX_H__
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ============================================================= Types ============================================================ */
+
+/// Peripherals clocked through RCC enable bits (union over all devices of the family)
+enum class peripheral {
+    adc,
+    aes,
+    cec,
+    crc,
+    crs,
+    dac1,
+    dbg,
+    dma1,
+    dma2,
+    fdcan,
+    flash,
+    gpioa,
+    gpiob,
+    gpioc,
+    gpiod,
+    gpioe,
+    gpiof,
+    i2c1,
+    i2c2,
+    i2c3,
+    lptim1,
+    lptim2,
+    lpuart1,
+    lpuart2,
+    pwr,
+    rng,
+    rtcapb,
+    spi1,
+    spi2,
+    spi3,
+    syscfg,
+    tim1,
+    tim14,
+    tim15,
+    tim16,
+    tim17,
+    tim2,
+    tim3,
+    tim4,
+    tim6,
+    tim7,
+    ucpd1,
+    ucpd2,
+    usart1,
+    usart2,
+    usart3,
+    usart4,
+    usart5,
+    usart6,
+    usb,
+    wwdg
+};
+
+/* ============================================================ Traits ============================================================ */
+
+#if defined(STM32G030xx) || defined(STM32G031xx) || defined(STM32G041xx)
+
+template<> struct dma_stream<1, 4> : irqn_trait<11> { }; // DMA1_Ch4_5_DMAMUX1_OVR
+template<> struct dma_stream<1, 5> : irqn_trait<11> { }; // DMA1_Ch4_5_DMAMUX1_OVR
+
+#endif
+
+#if defined(STM32G030xx) || defined(STM32G031xx) || defined(STM32G041xx) || defined(STM32G050xx) || defined(STM32G070xx) || \
+    defined(STM32G071xx) || defined(STM32G081xx) || defined(STM32G0B0xx)
+
+template<> struct dma_stream<1, 1> : irqn_trait<9> { }; // DMA_Channel1
+template<> struct dma_stream<1, 2> : irqn_trait<10> { }; // DMA_Channel2_3
+template<> struct dma_stream<1, 3> : irqn_trait<10> { }; // DMA_Channel2_3
+
+#endif
+
+#if defined(STM32G030xx) || defined(STM32G031xx) || defined(STM32G041xx) || defined(STM32G050xx) || defined(STM32G070xx) || \
+    defined(STM32G071xx) || defined(STM32G081xx) || defined(STM32G0B0xx) || defined(STM32G0B1xx) || defined(STM32G0C1xx)
+
+template<> struct exti_line<0> : irqn_trait<5> { }; // EXTI0_1
+template<> struct exti_line<1> : irqn_trait<5> { }; // EXTI0_1
+template<> struct exti_line<2> : irqn_trait<6> { }; // EXTI2_3
+template<> struct exti_line<3> : irqn_trait<6> { }; // EXTI2_3
+template<> struct exti_line<4> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<5> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<6> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<7> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<8> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<9> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<10> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<11> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<12> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<13> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<14> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<15> : irqn_trait<7> { }; // EXTI4_15
+template<> struct rcc_enable<peripheral::adc> : rcc_bit_trait<0x40, 20> { }; // APBENR2
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0x38, 12> { }; // AHBENR
+template<> struct rcc_enable<peripheral::dbg> : rcc_bit_trait<0x3C, 27> { }; // APBENR1
+template<> struct rcc_enable<peripheral::dma1> : rcc_bit_trait<0x38, 0> { }; // AHBENR
+template<> struct rcc_enable<peripheral::flash> : rcc_bit_trait<0x38, 8> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioa> : rcc_bit_trait<0x34, 0> { }; // IOPENR
+template<> struct rcc_enable<peripheral::gpiob> : rcc_bit_trait<0x34, 1> { }; // IOPENR
+template<> struct rcc_enable<peripheral::gpioc> : rcc_bit_trait<0x34, 2> { }; // IOPENR
+template<> struct rcc_enable<peripheral::gpiod> : rcc_bit_trait<0x34, 3> { }; // IOPENR
+template<> struct rcc_enable<peripheral::gpiof> : rcc_bit_trait<0x34, 5> { }; // IOPENR
+template<> struct rcc_enable<peripheral::i2c1> : rcc_bit_trait<0x3C, 21> { }; // APBENR1
+template<> struct rcc_enable<peripheral::i2c2> : rcc_bit_trait<0x3C, 22> { }; // APBENR1
+template<> struct rcc_enable<peripheral::pwr> : rcc_bit_trait<0x3C, 28> { }; // APBENR1
+template<> struct rcc_enable<peripheral::rtcapb> : rcc_bit_trait<0x3C, 10> { }; // APBENR1
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0x40, 12> { }; // APBENR2
+template<> struct rcc_enable<peripheral::spi2> : rcc_bit_trait<0x3C, 14> { }; // APBENR1
+template<> struct rcc_enable<peripheral::syscfg> : rcc_bit_trait<0x40, 0> { }; // APBENR2
+template<> struct rcc_enable<peripheral::tim1> : rcc_bit_trait<0x40, 11> { }; // APBENR2
+template<> struct rcc_enable<peripheral::tim14> : rcc_bit_trait<0x40, 15> { }; // APBENR2
+template<> struct rcc_enable<peripheral::tim16> : rcc_bit_trait<0x40, 17> { }; // APBENR2
+template<> struct rcc_enable<peripheral::tim17> : rcc_bit_trait<0x40, 18> { }; // APBENR2
+template<> struct rcc_enable<peripheral::tim3> : rcc_bit_trait<0x3C, 1> { }; // APBENR1
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0x40, 14> { }; // APBENR2
+template<> struct rcc_enable<peripheral::usart2> : rcc_bit_trait<0x3C, 17> { }; // APBENR1
+template<> struct rcc_enable<peripheral::wwdg> : rcc_bit_trait<0x3C, 11> { }; // APBENR1
+
+#endif
+
+#if defined(STM32G030xx) || defined(STM32G050xx) || defined(STM32G070xx) || defined(STM32G071xx) || defined(STM32G081xx) || \
+    defined(STM32G0B0xx) || defined(STM32G0B1xx) || defined(STM32G0C1xx)
+
+template<> struct rcc_enable<peripheral::tim15> : rcc_bit_trait<0x40, 16> { }; // APBENR2
+template<> struct rcc_enable<peripheral::tim6> : rcc_bit_trait<0x3C, 4> { }; // APBENR1
+template<> struct rcc_enable<peripheral::tim7> : rcc_bit_trait<0x3C, 5> { }; // APBENR1
+template<> struct rcc_enable<peripheral::usart3> : rcc_bit_trait<0x3C, 18> { }; // APBENR1
+template<> struct rcc_enable<peripheral::usart4> : rcc_bit_trait<0x3C, 19> { }; // APBENR1
+
+#endif
+
+#if defined(STM32G030xx) || defined(STM32G050xx) || defined(STM32G070xx) || defined(STM32G0B0xx) || defined(STM32G0B1xx) || \
+    defined(STM32G0C1xx)
+
+template<> struct rcc_enable<peripheral::dma2> : rcc_bit_trait<0x38, 1> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioe> : rcc_bit_trait<0x34, 4> { }; // IOPENR
+template<> struct rcc_enable<peripheral::i2c3> : rcc_bit_trait<0x3C, 23> { }; // APBENR1
+template<> struct rcc_enable<peripheral::spi3> : rcc_bit_trait<0x3C, 15> { }; // APBENR1
+template<> struct rcc_enable<peripheral::tim4> : rcc_bit_trait<0x3C, 2> { }; // APBENR1
+template<> struct rcc_enable<peripheral::usart5> : rcc_bit_trait<0x3C, 8> { }; // APBENR1
+template<> struct rcc_enable<peripheral::usart6> : rcc_bit_trait<0x3C, 9> { }; // APBENR1
+template<> struct rcc_enable<peripheral::usb> : rcc_bit_trait<0x3C, 13> { }; // APBENR1
+
+#endif
+
+#if defined(STM32G031xx) || defined(STM32G041xx) || defined(STM32G071xx) || defined(STM32G081xx) || defined(STM32G0B1xx) || \
+    defined(STM32G0C1xx)
+
+template<> struct rcc_enable<peripheral::lptim1> : rcc_bit_trait<0x3C, 31> { }; // APBENR1
+template<> struct rcc_enable<peripheral::lptim2> : rcc_bit_trait<0x3C, 30> { }; // APBENR1
+template<> struct rcc_enable<peripheral::lpuart1> : rcc_bit_trait<0x3C, 20> { }; // APBENR1
+template<> struct rcc_enable<peripheral::tim2> : rcc_bit_trait<0x3C, 0> { }; // APBENR1
+
+#endif
+
+#if defined(STM32G041xx) || defined(STM32G071xx) || defined(STM32G081xx) || defined(STM32G0C1xx)
+
+template<> struct rcc_enable<peripheral::aes> : rcc_bit_trait<0x38, 16> { }; // AHBENR
+template<> struct rcc_enable<peripheral::rng> : rcc_bit_trait<0x38, 18> { }; // AHBENR
+
+#endif
+
+#if defined(STM32G050xx) || defined(STM32G051xx) || defined(STM32G061xx) || defined(STM32G070xx) || defined(STM32G071xx) || \
+    defined(STM32G081xx)
+
+template<> struct dma_stream<1, 4> : irqn_trait<11> { }; // DMA1_Ch4_7_DMAMUX1_OVR
+template<> struct dma_stream<1, 5> : irqn_trait<11> { }; // DMA1_Ch4_7_DMAMUX1_OVR
+template<> struct dma_stream<1, 6> : irqn_trait<11> { }; // DMA1_Ch4_7_DMAMUX1_OVR
+template<> struct dma_stream<1, 7> : irqn_trait<11> { }; // DMA1_Ch4_7_DMAMUX1_OVR
+
+#endif
+
+#if defined(STM32G051xx) || defined(STM32G061xx) || defined(STM32G0B1xx) || defined(STM32G0C1xx)
+
+template<> struct dma_stream<1, 1> : irqn_trait<9> { }; // DMA1_Channel1
+template<> struct dma_stream<1, 2> : irqn_trait<10> { }; // DMA1_Channel2_3
+template<> struct dma_stream<1, 3> : irqn_trait<10> { }; // DMA1_Channel2_3
+
+#endif
+
+#if defined(STM32G071xx) || defined(STM32G081xx) || defined(STM32G0B1xx) || defined(STM32G0C1xx)
+
+template<> struct rcc_enable<peripheral::cec> : rcc_bit_trait<0x3C, 24> { }; // APBENR1
+template<> struct rcc_enable<peripheral::dac1> : rcc_bit_trait<0x3C, 29> { }; // APBENR1
+template<> struct rcc_enable<peripheral::ucpd1> : rcc_bit_trait<0x3C, 25> { }; // APBENR1
+template<> struct rcc_enable<peripheral::ucpd2> : rcc_bit_trait<0x3C, 26> { }; // APBENR1
+
+#endif
+
+#if defined(STM32G0B0xx) || defined(STM32G0B1xx) || defined(STM32G0C1xx)
+
+template<> struct dma_stream<1, 4> : irqn_trait<11> { }; // DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR
+template<> struct dma_stream<1, 5> : irqn_trait<11> { }; // DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR
+template<> struct dma_stream<1, 6> : irqn_trait<11> { }; // DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR
+template<> struct dma_stream<1, 7> : irqn_trait<11> { }; // DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR
+template<> struct dma_stream<2, 1> : irqn_trait<11> { }; // DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR
+template<> struct dma_stream<2, 2> : irqn_trait<11> { }; // DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR
+template<> struct dma_stream<2, 3> : irqn_trait<11> { }; // DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR
+template<> struct dma_stream<2, 4> : irqn_trait<11> { }; // DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR
+template<> struct dma_stream<2, 5> : irqn_trait<11> { }; // DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR
+
+#endif
+
+#if defined(STM32G0B1xx) || defined(STM32G0C1xx)
+
+template<> struct rcc_enable<peripheral::crs> : rcc_bit_trait<0x3C, 16> { }; // APBENR1
+template<> struct rcc_enable<peripheral::fdcan> : rcc_bit_trait<0x3C, 12> { }; // APBENR1
+template<> struct rcc_enable<peripheral::lpuart2> : rcc_bit_trait<0x3C, 7> { }; // APBENR1
+
+#endif
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,298 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32h7xx.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @project    stm-utils
+ * @brief      Device traits for STM32H7xx devices (generated by scripts/generate_traits.py, do not edit)
+ *
+ * @note Devices not described by SVD files: STM32H7A3xx, STM32H7A3xxQ, STM32H7B3xx, STM32H7B3xxQ, STM32H7B0xx, STM32H7B0xxQ
+ *
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_STM32H7XX_H__
+#define __STM_UTILS_DEVICE_TRAITS_STM32H7XX_H__
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ============================================================= Types ============================================================ */
+
+/// Peripherals clocked through RCC enable bits (union over all devices of the family)
+enum class peripheral {
+    adc12,
+    adc3,
+    bdma,
+    bkpram,
+    camitf,
+    cec,
+    comp12,
+    crc,
+    crs,
+    cryp,
+    dac12,
+    dfsdm1,
+    dma1,
+    dma2,
+    dma2d,
+    eth1mac,
+    eth1rx,
+    eth1tx,
+    fdcan,
+    fmc,
+    gpioa,
+    gpiob,
+    gpioc,
+    gpiod,
+    gpioe,
+    gpiof,
+    gpiog,
+    gpioh,
+    gpioi,
+    gpioj,
+    gpiok,
+    hash,
+    hdmicec,
+    hrtim,
+    hsem,
+    i2c1,
+    i2c2,
+    i2c3,
+    i2c4,
+    jpgdec,
+    lptim1,
+    lptim2,
+    lptim3,
+    lptim4,
+    lptim5,
+    lpuart1,
+    ltdc,
+    mdios,
+    mdma,
+    opamp,
+    qspi,
+    rng,
+    rtcapb,
+    sai1,
+    sai2,
+    sai3,
+    sai4,
+    sdmmc1,
+    sdmmc2,
+    spdifrx,
+    spi1,
+    spi2,
+    spi3,
+    spi4,
+    spi5,
+    spi6,
+    sram1,
+    sram2,
+    sram3,
+    swp,
+    syscfg,
+    tim1,
+    tim12,
+    tim13,
+    tim14,
+    tim15,
+    tim16,
+    tim17,
+    tim2,
+    tim3,
+    tim4,
+    tim5,
+    tim6,
+    tim7,
+    tim8,
+    uart4,
+    uart5,
+    usart1,
+    usart2,
+    usart3,
+    usart6,
+    usart7,
+    usart8,
+    usb1otg,
+    usb1ulpi,
+    usb2otg,
+    usb2otghsulpi,
+    usb2ulpi,
+    vref,
+    wwdg1
+};
+
+/* ============================================================ Traits ============================================================ */
+
+#if defined(STM32H723xx) || defined(STM32H725xx) || defined(STM32H735xx) || defined(STM32H733xx) || defined(STM32H730xx) || \
+    defined(STM32H730xxQ) || defined(STM32H742xx) || defined(STM32H743xx) || defined(STM32H750xx) || \
+    (defined(STM32H745xx) && defined(CORE_CM4)) || (defined(STM32H745xx) && !defined(CORE_CM4)) || \
+    (defined(STM32H747xx) && defined(CORE_CM4)) || (defined(STM32H747xx) && !defined(CORE_CM4)) || defined(STM32H753xx) || \
+    (defined(STM32H755xx) && defined(CORE_CM4)) || (defined(STM32H755xx) && !defined(CORE_CM4)) || \
+    (defined(STM32H757xx) && defined(CORE_CM4)) || (defined(STM32H757xx) && !defined(CORE_CM4))
+
+template<> struct exti_line<0> : irqn_trait<6> { }; // EXTI0
+template<> struct exti_line<1> : irqn_trait<7> { }; // EXTI1
+template<> struct exti_line<2> : irqn_trait<8> { }; // EXTI2
+template<> struct exti_line<3> : irqn_trait<9> { }; // EXTI3
+template<> struct exti_line<4> : irqn_trait<10> { }; // EXTI4
+template<> struct exti_line<5> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<6> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<7> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<8> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<9> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<10> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<11> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<12> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<13> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<14> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<15> : irqn_trait<40> { }; // EXTI15_10
+template<> struct dma_stream<1, 0> : irqn_trait<11> { }; // DMA_STR0
+template<> struct dma_stream<1, 1> : irqn_trait<12> { }; // DMA_STR1
+template<> struct dma_stream<1, 2> : irqn_trait<13> { }; // DMA_STR2
+template<> struct dma_stream<1, 3> : irqn_trait<14> { }; // DMA_STR3
+template<> struct dma_stream<1, 4> : irqn_trait<15> { }; // DMA_STR4
+template<> struct dma_stream<1, 5> : irqn_trait<16> { }; // DMA_STR5
+template<> struct dma_stream<1, 6> : irqn_trait<17> { }; // DMA_STR6
+template<> struct dma_stream<1, 7> : irqn_trait<47> { }; // DMA1_STR7
+template<> struct dma_stream<2, 0> : irqn_trait<56> { }; // DMA2_STR0
+template<> struct dma_stream<2, 1> : irqn_trait<57> { }; // DMA2_STR1
+template<> struct dma_stream<2, 2> : irqn_trait<58> { }; // DMA2_STR2
+template<> struct dma_stream<2, 3> : irqn_trait<59> { }; // DMA2_STR3
+template<> struct dma_stream<2, 4> : irqn_trait<60> { }; // DMA2_STR4
+template<> struct dma_stream<2, 5> : irqn_trait<68> { }; // DMA2_STR5
+template<> struct dma_stream<2, 6> : irqn_trait<69> { }; // DMA2_STR6
+template<> struct dma_stream<2, 7> : irqn_trait<70> { }; // DMA2_STR7
+template<> struct rcc_enable<peripheral::adc12> : rcc_bit_trait<0xD8, 5> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::adc3> : rcc_bit_trait<0xE0, 24> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::bdma> : rcc_bit_trait<0xE0, 21> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::bkpram> : rcc_bit_trait<0xE0, 28> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::camitf> : rcc_bit_trait<0xDC, 0> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::comp12> : rcc_bit_trait<0xF4, 14> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0xE0, 19> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::crs> : rcc_bit_trait<0xEC, 1> { }; // APB1HENR
+template<> struct rcc_enable<peripheral::cryp> : rcc_bit_trait<0xDC, 4> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::dac12> : rcc_bit_trait<0xE8, 29> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::dfsdm1> : rcc_bit_trait<0xF0, 28> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::dma1> : rcc_bit_trait<0xD8, 0> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dma2> : rcc_bit_trait<0xD8, 1> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dma2d> : rcc_bit_trait<0xD4, 4> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::eth1mac> : rcc_bit_trait<0xD8, 15> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::eth1rx> : rcc_bit_trait<0xD8, 17> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::eth1tx> : rcc_bit_trait<0xD8, 16> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::fdcan> : rcc_bit_trait<0xEC, 8> { }; // APB1HENR
+template<> struct rcc_enable<peripheral::fmc> : rcc_bit_trait<0xD4, 12> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::gpioa> : rcc_bit_trait<0xE0, 0> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::gpiob> : rcc_bit_trait<0xE0, 1> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::gpioc> : rcc_bit_trait<0xE0, 2> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::gpiod> : rcc_bit_trait<0xE0, 3> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::gpioe> : rcc_bit_trait<0xE0, 4> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::gpiof> : rcc_bit_trait<0xE0, 5> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::gpiog> : rcc_bit_trait<0xE0, 6> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::gpioh> : rcc_bit_trait<0xE0, 7> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::gpioi> : rcc_bit_trait<0xE0, 8> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::gpioj> : rcc_bit_trait<0xE0, 9> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::gpiok> : rcc_bit_trait<0xE0, 10> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::hash> : rcc_bit_trait<0xDC, 5> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::hsem> : rcc_bit_trait<0xE0, 25> { }; // AHB4ENR
+template<> struct rcc_enable<peripheral::i2c1> : rcc_bit_trait<0xE8, 21> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::i2c2> : rcc_bit_trait<0xE8, 22> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::i2c3> : rcc_bit_trait<0xE8, 23> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::i2c4> : rcc_bit_trait<0xF4, 7> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::jpgdec> : rcc_bit_trait<0xD4, 5> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::lptim1> : rcc_bit_trait<0xE8, 9> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::lptim2> : rcc_bit_trait<0xF4, 9> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::lptim3> : rcc_bit_trait<0xF4, 10> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::lptim4> : rcc_bit_trait<0xF4, 11> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::lptim5> : rcc_bit_trait<0xF4, 12> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::lpuart1> : rcc_bit_trait<0xF4, 3> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::ltdc> : rcc_bit_trait<0xE4, 3> { }; // APB3ENR
+template<> struct rcc_enable<peripheral::mdios> : rcc_bit_trait<0xEC, 5> { }; // APB1HENR
+template<> struct rcc_enable<peripheral::mdma> : rcc_bit_trait<0xD4, 0> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::opamp> : rcc_bit_trait<0xEC, 4> { }; // APB1HENR
+template<> struct rcc_enable<peripheral::qspi> : rcc_bit_trait<0xD4, 14> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::rng> : rcc_bit_trait<0xDC, 6> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::rtcapb> : rcc_bit_trait<0xF4, 16> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::sai1> : rcc_bit_trait<0xF0, 22> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::sai2> : rcc_bit_trait<0xF0, 23> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::sai3> : rcc_bit_trait<0xF0, 24> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::sai4> : rcc_bit_trait<0xF4, 21> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::sdmmc1> : rcc_bit_trait<0xD4, 16> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::sdmmc2> : rcc_bit_trait<0xDC, 9> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::spdifrx> : rcc_bit_trait<0xE8, 16> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0xF0, 12> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi2> : rcc_bit_trait<0xE8, 14> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::spi3> : rcc_bit_trait<0xE8, 15> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::spi4> : rcc_bit_trait<0xF0, 13> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi5> : rcc_bit_trait<0xF0, 20> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi6> : rcc_bit_trait<0xF4, 5> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::sram1> : rcc_bit_trait<0xDC, 29> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::sram2> : rcc_bit_trait<0xDC, 30> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::sram3> : rcc_bit_trait<0xDC, 31> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::swp> : rcc_bit_trait<0xEC, 2> { }; // APB1HENR
+template<> struct rcc_enable<peripheral::syscfg> : rcc_bit_trait<0xF4, 1> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::tim1> : rcc_bit_trait<0xF0, 0> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim12> : rcc_bit_trait<0xE8, 6> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::tim13> : rcc_bit_trait<0xE8, 7> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::tim14> : rcc_bit_trait<0xE8, 8> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::tim15> : rcc_bit_trait<0xF0, 16> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim16> : rcc_bit_trait<0xF0, 17> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim17> : rcc_bit_trait<0xF0, 18> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim2> : rcc_bit_trait<0xE8, 0> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::tim3> : rcc_bit_trait<0xE8, 1> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::tim4> : rcc_bit_trait<0xE8, 2> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::tim5> : rcc_bit_trait<0xE8, 3> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::tim6> : rcc_bit_trait<0xE8, 4> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::tim7> : rcc_bit_trait<0xE8, 5> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::tim8> : rcc_bit_trait<0xF0, 1> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::uart4> : rcc_bit_trait<0xE8, 19> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::uart5> : rcc_bit_trait<0xE8, 20> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0xF0, 4> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart2> : rcc_bit_trait<0xE8, 17> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::usart3> : rcc_bit_trait<0xE8, 18> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::usart6> : rcc_bit_trait<0xF0, 5> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart7> : rcc_bit_trait<0xE8, 30> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::usart8> : rcc_bit_trait<0xE8, 31> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::usb1otg> : rcc_bit_trait<0xD8, 25> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::usb1ulpi> : rcc_bit_trait<0xD8, 26> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::usb2otg> : rcc_bit_trait<0xD8, 27> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::usb2ulpi> : rcc_bit_trait<0xD8, 28> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::vref> : rcc_bit_trait<0xF4, 15> { }; // APB4ENR
+template<> struct rcc_enable<peripheral::wwdg1> : rcc_bit_trait<0xE4, 6> { }; // APB3ENR
+
+#endif
+
+#if defined(STM32H723xx) || defined(STM32H725xx) || defined(STM32H735xx) || defined(STM32H733xx) || defined(STM32H730xx) || \
+    defined(STM32H730xxQ) || (defined(STM32H745xx) && defined(CORE_CM4)) || (defined(STM32H745xx) && !defined(CORE_CM4)) || \
+    (defined(STM32H747xx) && defined(CORE_CM4)) || (defined(STM32H747xx) && !defined(CORE_CM4)) || \
+    (defined(STM32H755xx) && defined(CORE_CM4)) || (defined(STM32H755xx) && !defined(CORE_CM4)) || \
+    (defined(STM32H757xx) && defined(CORE_CM4)) || (defined(STM32H757xx) && !defined(CORE_CM4))
+
+template<> struct rcc_enable<peripheral::hdmicec> : rcc_bit_trait<0xE8, 27> { }; // APB1LENR
+
+#endif
+
+#if defined(STM32H742xx) || defined(STM32H743xx) || defined(STM32H750xx) || (defined(STM32H745xx) && defined(CORE_CM4)) || \
+    (defined(STM32H745xx) && !defined(CORE_CM4)) || (defined(STM32H747xx) && defined(CORE_CM4)) || \
+    (defined(STM32H747xx) && !defined(CORE_CM4)) || defined(STM32H753xx) || (defined(STM32H755xx) && defined(CORE_CM4)) || \
+    (defined(STM32H755xx) && !defined(CORE_CM4)) || (defined(STM32H757xx) && defined(CORE_CM4)) || \
+    (defined(STM32H757xx) && !defined(CORE_CM4))
+
+template<> struct rcc_enable<peripheral::hrtim> : rcc_bit_trait<0xF0, 29> { }; // APB2ENR
+
+#endif
+
+#if defined(STM32H742xx) || defined(STM32H743xx) || defined(STM32H750xx) || defined(STM32H753xx)
+
+template<> struct rcc_enable<peripheral::cec> : rcc_bit_trait<0xE8, 27> { }; // APB1LENR
+template<> struct rcc_enable<peripheral::usb2otghsulpi> : rcc_bit_trait<0xD8, 18> { }; // AHB1ENR
+
+#endif
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
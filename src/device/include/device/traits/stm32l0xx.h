@@ -0,0 +1,147 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32l0xx.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @project    stm-utils
+ * @brief      Device traits for STM32L0xx devices (generated by scripts/generate_traits.py, do not edit)
+ *
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_STM32L0XX_H__
+#define __STM_UTILS_DEVICE_TRAITS_STM32L0XX_H__
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ============================================================= Types ============================================================ */
+
+/// Peripherals clocked through RCC enable bits (union over all devices of the family)
+enum class peripheral {
+    adc,
+    crc,
+    crs,
+    cryp,
+    dac,
+    dbg,
+    dma1,
+    fw,
+    gpioa,
+    gpiob,
+    gpioc,
+    gpiod,
+    gpioe,
+    gpioh,
+    i2c1,
+    i2c2,
+    i2c3,
+    lptim1,
+    lpuart1,
+    mif,
+    mifi,
+    pwr,
+    rng,
+    spi1,
+    spi2,
+    syscfg,
+    tim2,
+    tim21,
+    tim22,
+    tim3,
+    tim6,
+    tim7,
+    touch,
+    usart1,
+    usart2,
+    usart4,
+    usart5,
+    usb,
+    wwdg
+};
+
+/* ============================================================ Traits ============================================================ */
+
+template<> struct exti_line<0> : irqn_trait<5> { }; // EXTI0_1
+template<> struct exti_line<1> : irqn_trait<5> { }; // EXTI0_1
+template<> struct exti_line<2> : irqn_trait<6> { }; // EXTI2_3
+template<> struct exti_line<3> : irqn_trait<6> { }; // EXTI2_3
+template<> struct exti_line<4> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<5> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<6> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<7> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<8> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<9> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<10> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<11> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<12> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<13> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<14> : irqn_trait<7> { }; // EXTI4_15
+template<> struct exti_line<15> : irqn_trait<7> { }; // EXTI4_15
+template<> struct dma_stream<1, 1> : irqn_trait<9> { }; // DMA1_Channel1
+template<> struct dma_stream<1, 2> : irqn_trait<10> { }; // DMA1_Channel2_3
+template<> struct dma_stream<1, 3> : irqn_trait<10> { }; // DMA1_Channel2_3
+template<> struct dma_stream<1, 4> : irqn_trait<11> { }; // DMA1_Channel4_7
+template<> struct dma_stream<1, 5> : irqn_trait<11> { }; // DMA1_Channel4_7
+template<> struct dma_stream<1, 6> : irqn_trait<11> { }; // DMA1_Channel4_7
+template<> struct dma_stream<1, 7> : irqn_trait<11> { }; // DMA1_Channel4_7
+template<> struct rcc_enable<peripheral::adc> : rcc_bit_trait<0x34, 9> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0x30, 12> { }; // AHBENR
+template<> struct rcc_enable<peripheral::cryp> : rcc_bit_trait<0x30, 24> { }; // AHBENR
+template<> struct rcc_enable<peripheral::dbg> : rcc_bit_trait<0x34, 22> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::dma1> : rcc_bit_trait<0x30, 0> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioa> : rcc_bit_trait<0x2C, 0> { }; // IOPENR
+template<> struct rcc_enable<peripheral::gpiob> : rcc_bit_trait<0x2C, 1> { }; // IOPENR
+template<> struct rcc_enable<peripheral::gpioc> : rcc_bit_trait<0x2C, 2> { }; // IOPENR
+template<> struct rcc_enable<peripheral::gpiod> : rcc_bit_trait<0x2C, 3> { }; // IOPENR
+template<> struct rcc_enable<peripheral::gpioe> : rcc_bit_trait<0x2C, 4> { }; // IOPENR
+template<> struct rcc_enable<peripheral::gpioh> : rcc_bit_trait<0x2C, 7> { }; // IOPENR
+template<> struct rcc_enable<peripheral::i2c1> : rcc_bit_trait<0x38, 21> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::i2c2> : rcc_bit_trait<0x38, 22> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::i2c3> : rcc_bit_trait<0x38, 30> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::lptim1> : rcc_bit_trait<0x38, 31> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::lpuart1> : rcc_bit_trait<0x38, 18> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::mif> : rcc_bit_trait<0x30, 8> { }; // AHBENR
+template<> struct rcc_enable<peripheral::pwr> : rcc_bit_trait<0x38, 28> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0x34, 12> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi2> : rcc_bit_trait<0x38, 14> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::syscfg> : rcc_bit_trait<0x34, 0> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim2> : rcc_bit_trait<0x38, 0> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim21> : rcc_bit_trait<0x34, 2> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim22> : rcc_bit_trait<0x34, 5> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim6> : rcc_bit_trait<0x38, 4> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim7> : rcc_bit_trait<0x38, 5> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0x34, 14> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart2> : rcc_bit_trait<0x38, 17> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart4> : rcc_bit_trait<0x38, 19> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart5> : rcc_bit_trait<0x38, 20> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::wwdg> : rcc_bit_trait<0x38, 11> { }; // APB1ENR
+
+#if defined(STM32L052xx) || defined(STM32L053xx) || defined(STM32L062xx) || defined(STM32L063xx) || defined(STM32L072xx) || \
+    defined(STM32L082xx) || defined(STM32L073xx) || defined(STM32L083xx)
+
+template<> struct rcc_enable<peripheral::crs> : rcc_bit_trait<0x38, 27> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::dac> : rcc_bit_trait<0x38, 29> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::mifi> : rcc_bit_trait<0x34, 7> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::rng> : rcc_bit_trait<0x30, 20> { }; // AHBENR
+template<> struct rcc_enable<peripheral::tim3> : rcc_bit_trait<0x38, 1> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::touch> : rcc_bit_trait<0x30, 16> { }; // AHBENR
+template<> struct rcc_enable<peripheral::usb> : rcc_bit_trait<0x38, 23> { }; // APB1ENR
+
+#endif
+
+#if defined(STM32L010x4) || defined(STM32L010x6) || defined(STM32L010x8) || defined(STM32L010xB) || defined(STM32L011xx) || \
+    defined(STM32L021xx) || defined(STM32L031xx) || defined(STM32L041xx) || defined(STM32L051xx) || defined(STM32L071xx) || \
+    defined(STM32L081xx)
+
+template<> struct rcc_enable<peripheral::fw> : rcc_bit_trait<0x34, 7> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim3> : rcc_bit_trait<0x38, 2> { }; // APB1ENR
+
+#endif
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,142 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32l1xx.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @project    stm-utils
+ * @brief      Device traits for STM32L1xx devices (generated by scripts/generate_traits.py, do not edit)
+ *
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_STM32L1XX_H__
+#define __STM_UTILS_DEVICE_TRAITS_STM32L1XX_H__
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ============================================================= Types ============================================================ */
+
+/// Peripherals clocked through RCC enable bits (union over all devices of the family)
+enum class peripheral {
+    adc1,
+    comp,
+    crc,
+    dac,
+    dma1,
+    dma2,
+    flitf,
+    fsmc,
+    gpioa,
+    gpiob,
+    gpioc,
+    gpiod,
+    gpioe,
+    gpiof,
+    gpiog,
+    gpioh,
+    i2c1,
+    i2c2,
+    lcd,
+    pwr,
+    sdio,
+    spi1,
+    spi2,
+    spi3,
+    syscfg,
+    tim10,
+    tim11,
+    tim2,
+    tim3,
+    tim4,
+    tim5,
+    tim6,
+    tim7,
+    tim9,
+    usart1,
+    usart2,
+    usart3,
+    usart4,
+    usart5,
+    usb,
+    wwdg
+};
+
+/* ============================================================ Traits ============================================================ */
+
+template<> struct exti_line<0> : irqn_trait<6> { }; // EXTI0
+template<> struct exti_line<1> : irqn_trait<7> { }; // EXTI1
+template<> struct exti_line<2> : irqn_trait<8> { }; // EXTI2
+template<> struct exti_line<3> : irqn_trait<9> { }; // EXTI3
+template<> struct exti_line<4> : irqn_trait<10> { }; // EXTI4
+template<> struct exti_line<5> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<6> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<7> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<8> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<9> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<10> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<11> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<12> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<13> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<14> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<15> : irqn_trait<40> { }; // EXTI15_10
+template<> struct dma_stream<1, 1> : irqn_trait<11> { }; // DMA1_Channel1
+template<> struct dma_stream<1, 2> : irqn_trait<12> { }; // DMA1_Channel2
+template<> struct dma_stream<1, 3> : irqn_trait<13> { }; // DMA1_Channel3
+template<> struct dma_stream<1, 4> : irqn_trait<14> { }; // DMA1_Channel4
+template<> struct dma_stream<1, 5> : irqn_trait<15> { }; // DMA1_Channel5
+template<> struct dma_stream<1, 6> : irqn_trait<16> { }; // DMA1_Channel6
+template<> struct dma_stream<1, 7> : irqn_trait<17> { }; // DMA1_Channel7
+template<> struct dma_stream<2, 1> : irqn_trait<50> { }; // DMA2_CH1
+template<> struct dma_stream<2, 2> : irqn_trait<51> { }; // DMA2_CH2
+template<> struct dma_stream<2, 3> : irqn_trait<52> { }; // DMA2_CH3
+template<> struct dma_stream<2, 4> : irqn_trait<53> { }; // DMA2_CH4
+template<> struct dma_stream<2, 5> : irqn_trait<54> { }; // DMA2_CH5
+template<> struct rcc_enable<peripheral::adc1> : rcc_bit_trait<0x20, 9> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::comp> : rcc_bit_trait<0x24, 31> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0x1C, 12> { }; // AHBENR
+template<> struct rcc_enable<peripheral::dac> : rcc_bit_trait<0x24, 29> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::dma1> : rcc_bit_trait<0x1C, 24> { }; // AHBENR
+template<> struct rcc_enable<peripheral::dma2> : rcc_bit_trait<0x1C, 25> { }; // AHBENR
+template<> struct rcc_enable<peripheral::flitf> : rcc_bit_trait<0x1C, 15> { }; // AHBENR
+template<> struct rcc_enable<peripheral::fsmc> : rcc_bit_trait<0x1C, 30> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioa> : rcc_bit_trait<0x1C, 0> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpiob> : rcc_bit_trait<0x1C, 1> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioc> : rcc_bit_trait<0x1C, 2> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpiod> : rcc_bit_trait<0x1C, 3> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioe> : rcc_bit_trait<0x1C, 4> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpiof> : rcc_bit_trait<0x1C, 6> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpiog> : rcc_bit_trait<0x1C, 7> { }; // AHBENR
+template<> struct rcc_enable<peripheral::gpioh> : rcc_bit_trait<0x1C, 5> { }; // AHBENR
+template<> struct rcc_enable<peripheral::i2c1> : rcc_bit_trait<0x24, 21> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::i2c2> : rcc_bit_trait<0x24, 22> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::lcd> : rcc_bit_trait<0x24, 9> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::pwr> : rcc_bit_trait<0x24, 28> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::sdio> : rcc_bit_trait<0x20, 11> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0x20, 12> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi2> : rcc_bit_trait<0x24, 14> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::spi3> : rcc_bit_trait<0x24, 15> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::syscfg> : rcc_bit_trait<0x20, 0> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim10> : rcc_bit_trait<0x20, 3> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim11> : rcc_bit_trait<0x20, 4> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim2> : rcc_bit_trait<0x24, 0> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim3> : rcc_bit_trait<0x24, 1> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim4> : rcc_bit_trait<0x24, 2> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim5> : rcc_bit_trait<0x24, 3> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim6> : rcc_bit_trait<0x24, 4> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim7> : rcc_bit_trait<0x24, 5> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::tim9> : rcc_bit_trait<0x20, 2> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0x20, 14> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart2> : rcc_bit_trait<0x24, 17> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart3> : rcc_bit_trait<0x24, 18> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart4> : rcc_bit_trait<0x24, 19> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usart5> : rcc_bit_trait<0x24, 20> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::usb> : rcc_bit_trait<0x24, 23> { }; // APB1ENR
+template<> struct rcc_enable<peripheral::wwdg> : rcc_bit_trait<0x24, 11> { }; // APB1ENR
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,338 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32l4xx.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @project    stm-utils
+ * @brief      Device traits for STM32L4xx devices (generated by scripts/generate_traits.py, do not edit)
+ *
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_STM32L4XX_H__
+#define __STM_UTILS_DEVICE_TRAITS_STM32L4XX_H__
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ============================================================= Types ============================================================ */
+
+/// Peripherals clocked through RCC enable bits (union over all devices of the family)
+enum class peripheral {
+    adc,
+    aes,
+    can1,
+    can2,
+    crc,
+    crs,
+    dac1,
+    dcmi,
+    dfsdm1,
+    dma1,
+    dma2,
+    dma2d,
+    dmamux1,
+    dsi,
+    flash,
+    fmc,
+    fw,
+    gfxmmu,
+    gpioa,
+    gpiob,
+    gpioc,
+    gpiod,
+    gpioe,
+    gpiof,
+    gpiog,
+    gpioh,
+    gpioi,
+    hash,
+    i2c1,
+    i2c2,
+    i2c3,
+    i2c4,
+    lcd,
+    lptim1,
+    lptim2,
+    lpuart1,
+    ltdc,
+    opamp,
+    ospi2,
+    ospim,
+    otgfs,
+    pwr,
+    qspi,
+    rng,
+    rtcapb,
+    sai1,
+    sai2,
+    sdmmc1,
+    spi1,
+    spi2,
+    spi3,
+    swpmi1,
+    syscfg,
+    tim1,
+    tim15,
+    tim16,
+    tim17,
+    tim2,
+    tim3,
+    tim4,
+    tim5,
+    tim6,
+    tim7,
+    tim8,
+    tsc,
+    uart4,
+    uart5,
+    usart1,
+    usart2,
+    usart3,
+    wwdg
+};
+
+/* ============================================================ Traits ============================================================ */
+
+template<> struct exti_line<0> : irqn_trait<6> { }; // EXTI0
+template<> struct exti_line<1> : irqn_trait<7> { }; // EXTI1
+template<> struct exti_line<2> : irqn_trait<8> { }; // EXTI2
+template<> struct exti_line<3> : irqn_trait<9> { }; // EXTI3
+template<> struct exti_line<4> : irqn_trait<10> { }; // EXTI4
+template<> struct exti_line<5> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<6> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<7> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<8> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<9> : irqn_trait<23> { }; // EXTI9_5
+template<> struct exti_line<10> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<11> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<12> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<13> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<14> : irqn_trait<40> { }; // EXTI15_10
+template<> struct exti_line<15> : irqn_trait<40> { }; // EXTI15_10
+template<> struct rcc_enable<peripheral::adc> : rcc_bit_trait<0x4C, 13> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::dma1> : rcc_bit_trait<0x48, 0> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dma2> : rcc_bit_trait<0x48, 1> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::flash> : rcc_bit_trait<0x48, 8> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::fw> : rcc_bit_trait<0x60, 7> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::gpioa> : rcc_bit_trait<0x4C, 0> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpiob> : rcc_bit_trait<0x4C, 1> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpioc> : rcc_bit_trait<0x4C, 2> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpioh> : rcc_bit_trait<0x4C, 7> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::i2c1> : rcc_bit_trait<0x58, 21> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::i2c2> : rcc_bit_trait<0x58, 22> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::i2c3> : rcc_bit_trait<0x58, 23> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::lptim1> : rcc_bit_trait<0x58, 31> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::lptim2> : rcc_bit_trait<0x5C, 5> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::lpuart1> : rcc_bit_trait<0x5C, 0> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::opamp> : rcc_bit_trait<0x58, 30> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::pwr> : rcc_bit_trait<0x58, 28> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::rng> : rcc_bit_trait<0x4C, 18> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::syscfg> : rcc_bit_trait<0x60, 0> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim1> : rcc_bit_trait<0x60, 11> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim15> : rcc_bit_trait<0x60, 16> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim16> : rcc_bit_trait<0x60, 17> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim2> : rcc_bit_trait<0x58, 0> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::tim6> : rcc_bit_trait<0x58, 4> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::tsc> : rcc_bit_trait<0x48, 16> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::usart2> : rcc_bit_trait<0x58, 17> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::wwdg> : rcc_bit_trait<0x58, 11> { }; // APB1ENR1
+
+#if defined(STM32L412xx) || defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx) || \
+    defined(STM32L4P5xx) || defined(STM32L4Q5xx) || defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || \
+    defined(STM32L4S5xx) || defined(STM32L4S7xx) || defined(STM32L4S9xx) || defined(STM32L431xx) || defined(STM32L451xx) || \
+    defined(STM32L471xx) || defined(STM32L422xx) || defined(STM32L432xx) || defined(STM32L442xx) || defined(STM32L452xx) || \
+    defined(STM32L462xx)
+
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0x48, 12> { }; // AHB1ENR
+
+#endif
+
+#if defined(STM32L412xx) || defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx) || \
+    defined(STM32L4P5xx) || defined(STM32L4Q5xx) || defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || \
+    defined(STM32L4S5xx) || defined(STM32L4S7xx) || defined(STM32L4S9xx) || defined(STM32L431xx) || defined(STM32L451xx) || \
+    defined(STM32L471xx) || defined(STM32L422xx) || defined(STM32L432xx) || defined(STM32L442xx) || defined(STM32L452xx) || \
+    defined(STM32L462xx) || defined(STM32L433xx) || defined(STM32L443xx)
+
+template<> struct rcc_enable<peripheral::crs> : rcc_bit_trait<0x58, 24> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::rtcapb> : rcc_bit_trait<0x58, 10> { }; // APB1ENR1
+
+#endif
+
+#if defined(STM32L412xx) || defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx) || \
+    defined(STM32L4P5xx) || defined(STM32L4Q5xx) || defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || \
+    defined(STM32L4S5xx) || defined(STM32L4S7xx) || defined(STM32L4S9xx) || defined(STM32L433xx) || defined(STM32L443xx) || \
+    defined(STM32L475xx) || defined(STM32L485xx)
+
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0x60, 12> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi2> : rcc_bit_trait<0x58, 14> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0x60, 14> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart3> : rcc_bit_trait<0x58, 18> { }; // APB1ENR1
+
+#endif
+
+#if defined(STM32L412xx) || defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx) || \
+    defined(STM32L431xx) || defined(STM32L451xx) || defined(STM32L471xx) || defined(STM32L422xx) || defined(STM32L432xx) || \
+    defined(STM32L442xx) || defined(STM32L452xx) || defined(STM32L462xx) || defined(STM32L433xx) || defined(STM32L443xx) || \
+    defined(STM32L475xx) || defined(STM32L485xx)
+
+template<> struct rcc_enable<peripheral::qspi> : rcc_bit_trait<0x50, 8> { }; // AHB3ENR
+
+#endif
+
+#if defined(STM32L412xx) || defined(STM32L433xx) || defined(STM32L443xx) || defined(STM32L475xx) || defined(STM32L485xx)
+
+template<> struct dma_stream<1, 1> : irqn_trait<11> { }; // DMA1_Channel1
+template<> struct dma_stream<1, 2> : irqn_trait<12> { }; // DMA1_Channel2
+template<> struct dma_stream<1, 3> : irqn_trait<13> { }; // DMA1_Channel3
+template<> struct dma_stream<1, 4> : irqn_trait<14> { }; // DMA1_Channel4
+template<> struct dma_stream<1, 5> : irqn_trait<15> { }; // DMA1_Channel5
+template<> struct dma_stream<1, 6> : irqn_trait<16> { }; // DMA1_Channel6
+template<> struct dma_stream<1, 7> : irqn_trait<17> { }; // DMA1_Channel7
+template<> struct dma_stream<2, 1> : irqn_trait<56> { }; // DMA2_Channel1
+template<> struct dma_stream<2, 2> : irqn_trait<57> { }; // DMA2_Channel2
+template<> struct dma_stream<2, 3> : irqn_trait<58> { }; // DMA2_Channel3
+template<> struct dma_stream<2, 4> : irqn_trait<59> { }; // DMA2_Channel4
+template<> struct dma_stream<2, 5> : irqn_trait<60> { }; // DMA2_Channel5
+template<> struct dma_stream<2, 6> : irqn_trait<68> { }; // DMA2_Channel6
+template<> struct dma_stream<2, 7> : irqn_trait<69> { }; // DMA2_Channel7
+
+#endif
+
+#if defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx)
+
+template<> struct rcc_enable<peripheral::can2> : rcc_bit_trait<0x58, 26> { }; // APB1ENR1
+
+#endif
+
+#if defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx) || defined(STM32L4P5xx) || \
+    defined(STM32L4Q5xx) || defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || defined(STM32L4S5xx) || \
+    defined(STM32L4S7xx) || defined(STM32L4S9xx)
+
+template<> struct rcc_enable<peripheral::dcmi> : rcc_bit_trait<0x4C, 14> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::dma2d> : rcc_bit_trait<0x48, 17> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::gpioi> : rcc_bit_trait<0x4C, 8> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::hash> : rcc_bit_trait<0x4C, 17> { }; // AHB2ENR
+
+#endif
+
+#if defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx) || defined(STM32L4P5xx) || \
+    defined(STM32L4Q5xx) || defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || defined(STM32L4S5xx) || \
+    defined(STM32L4S7xx) || defined(STM32L4S9xx) || defined(STM32L431xx) || defined(STM32L451xx) || defined(STM32L471xx) || \
+    defined(STM32L422xx) || defined(STM32L432xx) || defined(STM32L442xx) || defined(STM32L452xx) || defined(STM32L462xx)
+
+template<> struct dma_stream<1, 1> : irqn_trait<11> { }; // DMA1_CH1
+template<> struct dma_stream<1, 2> : irqn_trait<12> { }; // DMA1_CH2
+template<> struct dma_stream<1, 3> : irqn_trait<13> { }; // DMA1_CH3
+template<> struct dma_stream<1, 4> : irqn_trait<14> { }; // DMA1_CH4
+template<> struct dma_stream<1, 5> : irqn_trait<15> { }; // DMA1_CH5
+template<> struct dma_stream<1, 6> : irqn_trait<16> { }; // DMA1_CH6
+template<> struct dma_stream<1, 7> : irqn_trait<17> { }; // DMA1_CH7
+template<> struct dma_stream<2, 1> : irqn_trait<56> { }; // DMA2_CH1
+template<> struct dma_stream<2, 2> : irqn_trait<57> { }; // DMA2_CH2
+template<> struct dma_stream<2, 3> : irqn_trait<58> { }; // DMA2_CH3
+template<> struct dma_stream<2, 4> : irqn_trait<59> { }; // DMA2_CH4
+template<> struct dma_stream<2, 5> : irqn_trait<60> { }; // DMA2_CH5
+template<> struct dma_stream<2, 6> : irqn_trait<68> { }; // DMA2_CH6
+template<> struct dma_stream<2, 7> : irqn_trait<69> { }; // DMA2_CH7
+template<> struct rcc_enable<peripheral::i2c4> : rcc_bit_trait<0x5C, 1> { }; // APB1ENR2
+
+#endif
+
+#if defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx) || defined(STM32L4P5xx) || \
+    defined(STM32L4Q5xx) || defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || defined(STM32L4S5xx) || \
+    defined(STM32L4S7xx) || defined(STM32L4S9xx) || defined(STM32L431xx) || defined(STM32L451xx) || defined(STM32L471xx) || \
+    defined(STM32L422xx) || defined(STM32L432xx) || defined(STM32L442xx) || defined(STM32L452xx) || defined(STM32L462xx) || \
+    defined(STM32L433xx) || defined(STM32L443xx) || defined(STM32L475xx) || defined(STM32L485xx)
+
+template<> struct rcc_enable<peripheral::aes> : rcc_bit_trait<0x4C, 16> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::can1> : rcc_bit_trait<0x58, 25> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::dac1> : rcc_bit_trait<0x58, 29> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::gpiod> : rcc_bit_trait<0x4C, 3> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpioe> : rcc_bit_trait<0x4C, 4> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::sai1> : rcc_bit_trait<0x60, 21> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi3> : rcc_bit_trait<0x58, 15> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::tim7> : rcc_bit_trait<0x58, 5> { }; // APB1ENR1
+
+#endif
+
+#if defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx) || defined(STM32L4P5xx) || \
+    defined(STM32L4Q5xx) || defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || defined(STM32L4S5xx) || \
+    defined(STM32L4S7xx) || defined(STM32L4S9xx) || defined(STM32L431xx) || defined(STM32L451xx) || defined(STM32L471xx) || \
+    defined(STM32L422xx) || defined(STM32L432xx) || defined(STM32L442xx) || defined(STM32L452xx) || defined(STM32L462xx) || \
+    defined(STM32L475xx) || defined(STM32L485xx)
+
+template<> struct rcc_enable<peripheral::tim3> : rcc_bit_trait<0x58, 1> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::uart4> : rcc_bit_trait<0x58, 19> { }; // APB1ENR1
+
+#endif
+
+#if defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx) || defined(STM32L4P5xx) || \
+    defined(STM32L4Q5xx) || defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || defined(STM32L4S5xx) || \
+    defined(STM32L4S7xx) || defined(STM32L4S9xx) || defined(STM32L475xx) || defined(STM32L485xx)
+
+template<> struct rcc_enable<peripheral::dfsdm1> : rcc_bit_trait<0x60, 24> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::fmc> : rcc_bit_trait<0x50, 0> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::gpiof> : rcc_bit_trait<0x4C, 5> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpiog> : rcc_bit_trait<0x4C, 6> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::otgfs> : rcc_bit_trait<0x4C, 12> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::sai2> : rcc_bit_trait<0x60, 22> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim17> : rcc_bit_trait<0x60, 18> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim4> : rcc_bit_trait<0x58, 2> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::tim5> : rcc_bit_trait<0x58, 3> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::tim8> : rcc_bit_trait<0x60, 13> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::uart5> : rcc_bit_trait<0x58, 20> { }; // APB1ENR1
+
+#endif
+
+#if defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx) || defined(STM32L431xx) || \
+    defined(STM32L451xx) || defined(STM32L471xx) || defined(STM32L422xx) || defined(STM32L432xx) || defined(STM32L442xx) || \
+    defined(STM32L452xx) || defined(STM32L462xx) || defined(STM32L433xx) || defined(STM32L443xx) || defined(STM32L475xx) || \
+    defined(STM32L485xx)
+
+template<> struct rcc_enable<peripheral::lcd> : rcc_bit_trait<0x58, 9> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::sdmmc1> : rcc_bit_trait<0x60, 10> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::swpmi1> : rcc_bit_trait<0x5C, 2> { }; // APB1ENR2
+
+#endif
+
+#if defined(STM32L4P5xx) || defined(STM32L4Q5xx) || defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || \
+    defined(STM32L4S5xx) || defined(STM32L4S7xx) || defined(STM32L4S9xx)
+
+template<> struct rcc_enable<peripheral::dmamux1> : rcc_bit_trait<0x48, 2> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dsi> : rcc_bit_trait<0x60, 27> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::ltdc> : rcc_bit_trait<0x60, 26> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::ospi2> : rcc_bit_trait<0x50, 9> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::ospim> : rcc_bit_trait<0x4C, 20> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::sdmmc1> : rcc_bit_trait<0x4C, 22> { }; // AHB2ENR
+
+#endif
+
+#if defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || defined(STM32L4S5xx) || defined(STM32L4S7xx) || \
+    defined(STM32L4S9xx)
+
+template<> struct rcc_enable<peripheral::gfxmmu> : rcc_bit_trait<0x48, 18> { }; // AHB1ENR
+
+#endif
+
+#if defined(STM32L431xx) || defined(STM32L451xx) || defined(STM32L471xx) || defined(STM32L422xx) || defined(STM32L432xx) || \
+    defined(STM32L442xx) || defined(STM32L452xx) || defined(STM32L462xx)
+
+template<> struct rcc_enable<peripheral::dfsdm1> : rcc_bit_trait<0x5C, 24> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0x58, 14> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0x58, 18> { }; // APB1ENR1
+
+#endif
+
+#if defined(STM32L433xx) || defined(STM32L443xx) || defined(STM32L475xx) || defined(STM32L485xx)
+
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0x48, 11> { }; // AHB1ENR
+
+#endif
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
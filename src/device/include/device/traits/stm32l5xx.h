@@ -0,0 +1,192 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32l5xx.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @project    stm-utils
+ * @brief      Device traits for STM32L5xx devices (generated by scripts/generate_traits.py, do not edit)
+ *
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_STM32L5XX_H__
+#define __STM_UTILS_DEVICE_TRAITS_STM32L5XX_H__
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ============================================================= Types ============================================================ */
+
+/// Peripherals clocked through RCC enable bits (union over all devices of the family)
+enum class peripheral {
+    adc,
+    aes,
+    crc,
+    crs,
+    dac1,
+    dfsdm1,
+    dma1,
+    dma2,
+    dmamux1,
+    fdcan1,
+    flash,
+    fmc,
+    gpioa,
+    gpiob,
+    gpioc,
+    gpiod,
+    gpioe,
+    gpiof,
+    gpiog,
+    gpioh,
+    gtzc,
+    hash,
+    i2c1,
+    i2c2,
+    i2c3,
+    i2c4,
+    lptim1,
+    lptim2,
+    lptim3,
+    lpuart1,
+    opamp,
+    ospi1,
+    otfdec1,
+    pka,
+    pwr,
+    rng,
+    rtcapb,
+    sai1,
+    sai2,
+    sdmmc1,
+    spi1,
+    spi2,
+    spi3,
+    syscfg,
+    tim1,
+    tim15,
+    tim16,
+    tim17,
+    tim2,
+    tim3,
+    tim4,
+    tim5,
+    tim6,
+    tim7,
+    tim8,
+    tsc,
+    uart4,
+    uart5,
+    ucpd1,
+    usart1,
+    usart2,
+    usart3,
+    usbfs,
+    wwdg
+};
+
+/* ============================================================ Traits ============================================================ */
+
+template<> struct exti_line<0> : irqn_trait<11> { }; // EXTI0
+template<> struct exti_line<1> : irqn_trait<12> { }; // EXTI1
+template<> struct exti_line<2> : irqn_trait<13> { }; // EXTI2
+template<> struct exti_line<3> : irqn_trait<14> { }; // EXTI3
+template<> struct exti_line<4> : irqn_trait<15> { }; // EXTI4
+template<> struct exti_line<5> : irqn_trait<16> { }; // EXTI5
+template<> struct exti_line<6> : irqn_trait<17> { }; // EXTI6
+template<> struct exti_line<7> : irqn_trait<18> { }; // EXTI7
+template<> struct exti_line<8> : irqn_trait<19> { }; // EXTI8
+template<> struct exti_line<9> : irqn_trait<20> { }; // EXTI9
+template<> struct exti_line<10> : irqn_trait<21> { }; // EXTI10
+template<> struct exti_line<11> : irqn_trait<22> { }; // EXTI11
+template<> struct exti_line<12> : irqn_trait<23> { }; // EXTI12
+template<> struct exti_line<13> : irqn_trait<24> { }; // EXTI13
+template<> struct exti_line<14> : irqn_trait<25> { }; // EXTI14
+template<> struct exti_line<15> : irqn_trait<26> { }; // EXTI15
+template<> struct dma_stream<1, 1> : irqn_trait<29> { }; // DMA1_Channel1
+template<> struct dma_stream<1, 2> : irqn_trait<30> { }; // DMA1_Channel2
+template<> struct dma_stream<1, 3> : irqn_trait<31> { }; // DMA1_Channel3
+template<> struct dma_stream<1, 4> : irqn_trait<32> { }; // DMA1_Channel4
+template<> struct dma_stream<1, 5> : irqn_trait<33> { }; // DMA1_Channel5
+template<> struct dma_stream<1, 6> : irqn_trait<34> { }; // DMA1_Channel6
+template<> struct dma_stream<1, 7> : irqn_trait<35> { }; // DMA1_Channel7
+template<> struct dma_stream<1, 8> : irqn_trait<36> { }; // DMA1_Channel8
+template<> struct dma_stream<2, 1> : irqn_trait<80> { }; // DMA2_CH1
+template<> struct dma_stream<2, 2> : irqn_trait<81> { }; // DMA2_CH2
+template<> struct dma_stream<2, 3> : irqn_trait<82> { }; // DMA2_CH3
+template<> struct dma_stream<2, 4> : irqn_trait<83> { }; // DMA2_CH4
+template<> struct dma_stream<2, 5> : irqn_trait<84> { }; // DMA2_CH5
+template<> struct dma_stream<2, 6> : irqn_trait<85> { }; // DMA2_CH6
+template<> struct dma_stream<2, 7> : irqn_trait<86> { }; // DMA2_CH7
+template<> struct dma_stream<2, 8> : irqn_trait<87> { }; // DMA2_CH8
+template<> struct rcc_enable<peripheral::adc> : rcc_bit_trait<0x4C, 13> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::aes> : rcc_bit_trait<0x4C, 16> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0x48, 12> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::crs> : rcc_bit_trait<0x58, 24> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::dac1> : rcc_bit_trait<0x58, 29> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::dfsdm1> : rcc_bit_trait<0x60, 24> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::dma1> : rcc_bit_trait<0x48, 0> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dma2> : rcc_bit_trait<0x48, 1> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dmamux1> : rcc_bit_trait<0x48, 2> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::fdcan1> : rcc_bit_trait<0x5C, 9> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::flash> : rcc_bit_trait<0x48, 8> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::fmc> : rcc_bit_trait<0x50, 0> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::gpioa> : rcc_bit_trait<0x4C, 0> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpiob> : rcc_bit_trait<0x4C, 1> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpioc> : rcc_bit_trait<0x4C, 2> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpiod> : rcc_bit_trait<0x4C, 3> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpioe> : rcc_bit_trait<0x4C, 4> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpiof> : rcc_bit_trait<0x4C, 5> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpiog> : rcc_bit_trait<0x4C, 6> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpioh> : rcc_bit_trait<0x4C, 7> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gtzc> : rcc_bit_trait<0x48, 22> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::hash> : rcc_bit_trait<0x4C, 17> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::i2c1> : rcc_bit_trait<0x58, 21> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::i2c2> : rcc_bit_trait<0x58, 22> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::i2c3> : rcc_bit_trait<0x58, 23> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::i2c4> : rcc_bit_trait<0x5C, 1> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::lptim1> : rcc_bit_trait<0x58, 31> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::lptim2> : rcc_bit_trait<0x5C, 5> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::lptim3> : rcc_bit_trait<0x5C, 6> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::lpuart1> : rcc_bit_trait<0x5C, 0> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::opamp> : rcc_bit_trait<0x58, 30> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::ospi1> : rcc_bit_trait<0x50, 8> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::otfdec1> : rcc_bit_trait<0x4C, 21> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::pka> : rcc_bit_trait<0x4C, 19> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::pwr> : rcc_bit_trait<0x58, 28> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::rng> : rcc_bit_trait<0x4C, 18> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::rtcapb> : rcc_bit_trait<0x58, 10> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::sai1> : rcc_bit_trait<0x60, 21> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::sai2> : rcc_bit_trait<0x60, 22> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::sdmmc1> : rcc_bit_trait<0x4C, 22> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0x60, 12> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi2> : rcc_bit_trait<0x58, 14> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::spi3> : rcc_bit_trait<0x58, 15> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::syscfg> : rcc_bit_trait<0x60, 0> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim1> : rcc_bit_trait<0x60, 11> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim15> : rcc_bit_trait<0x60, 16> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim16> : rcc_bit_trait<0x60, 17> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim17> : rcc_bit_trait<0x60, 18> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim2> : rcc_bit_trait<0x58, 0> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::tim3> : rcc_bit_trait<0x58, 1> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::tim4> : rcc_bit_trait<0x58, 2> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::tim5> : rcc_bit_trait<0x58, 3> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::tim6> : rcc_bit_trait<0x58, 4> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::tim7> : rcc_bit_trait<0x58, 5> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::tim8> : rcc_bit_trait<0x60, 13> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tsc> : rcc_bit_trait<0x48, 16> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::uart4> : rcc_bit_trait<0x58, 19> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::uart5> : rcc_bit_trait<0x58, 20> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::ucpd1> : rcc_bit_trait<0x5C, 23> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0x60, 14> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart2> : rcc_bit_trait<0x58, 17> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::usart3> : rcc_bit_trait<0x58, 18> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::usbfs> : rcc_bit_trait<0x5C, 21> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::wwdg> : rcc_bit_trait<0x58, 11> { }; // APB1ENR1
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,177 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32wlxx.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @project    stm-utils
+ * @brief      Device traits for STM32WLxx devices (generated by scripts/generate_traits.py, do not edit)
+ *
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_TRAITS_STM32WLXX_H__
+#define __STM_UTILS_DEVICE_TRAITS_STM32WLXX_H__
+
+/* =========================================================== Namespace ========================================================== */
+
+namespace device::traits {
+
+/* ============================================================= Types ============================================================ */
+
+/// Peripherals clocked through RCC enable bits (union over all devices of the family)
+enum class peripheral {
+    adc,
+    aes,
+    crc,
+    dac1,
+    dma1,
+    dma2,
+    dmamux1,
+    flash,
+    gpioa,
+    gpiob,
+    gpioc,
+    gpioh,
+    hsem,
+    i2c1,
+    i2c2,
+    i2c3,
+    ipcc,
+    lptim1,
+    lptim2,
+    lptim3,
+    lpuart1,
+    pka,
+    rng,
+    rtcapb,
+    spi1,
+    spi2,
+    subghzspi,
+    tim1,
+    tim16,
+    tim17,
+    tim2,
+    usart1,
+    usart2,
+    wwdg
+};
+
+/* ============================================================ Traits ============================================================ */
+
+template<> struct rcc_enable<peripheral::adc> : rcc_bit_trait<0x60, 9> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::aes> : rcc_bit_trait<0x50, 17> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::crc> : rcc_bit_trait<0x48, 12> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dac1> : rcc_bit_trait<0x58, 29> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::dma1> : rcc_bit_trait<0x48, 0> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dma2> : rcc_bit_trait<0x48, 1> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::dmamux1> : rcc_bit_trait<0x48, 2> { }; // AHB1ENR
+template<> struct rcc_enable<peripheral::flash> : rcc_bit_trait<0x50, 25> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::gpioa> : rcc_bit_trait<0x4C, 0> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpiob> : rcc_bit_trait<0x4C, 1> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpioc> : rcc_bit_trait<0x4C, 2> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::gpioh> : rcc_bit_trait<0x4C, 7> { }; // AHB2ENR
+template<> struct rcc_enable<peripheral::hsem> : rcc_bit_trait<0x50, 19> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::i2c1> : rcc_bit_trait<0x58, 21> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::i2c2> : rcc_bit_trait<0x58, 22> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::i2c3> : rcc_bit_trait<0x58, 23> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::lptim1> : rcc_bit_trait<0x58, 31> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::lptim2> : rcc_bit_trait<0x5C, 5> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::lptim3> : rcc_bit_trait<0x5C, 6> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::lpuart1> : rcc_bit_trait<0x5C, 0> { }; // APB1ENR2
+template<> struct rcc_enable<peripheral::pka> : rcc_bit_trait<0x50, 16> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::rng> : rcc_bit_trait<0x50, 18> { }; // AHB3ENR
+template<> struct rcc_enable<peripheral::rtcapb> : rcc_bit_trait<0x58, 10> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::spi1> : rcc_bit_trait<0x60, 12> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::spi2> : rcc_bit_trait<0x58, 14> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::subghzspi> : rcc_bit_trait<0x64, 0> { }; // APB3ENR
+template<> struct rcc_enable<peripheral::tim1> : rcc_bit_trait<0x60, 11> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim16> : rcc_bit_trait<0x60, 17> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim17> : rcc_bit_trait<0x60, 18> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::tim2> : rcc_bit_trait<0x58, 0> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::usart1> : rcc_bit_trait<0x60, 14> { }; // APB2ENR
+template<> struct rcc_enable<peripheral::usart2> : rcc_bit_trait<0x58, 17> { }; // APB1ENR1
+template<> struct rcc_enable<peripheral::wwdg> : rcc_bit_trait<0x58, 11> { }; // APB1ENR1
+
+#if (defined(STM32WL55xx) && defined(CORE_CM0PLUS)) || (defined(STM32WL54xx) && defined(CORE_CM0PLUS))
+
+template<> struct exti_line<0> : irqn_trait<4> { }; // EXTI1_0
+template<> struct exti_line<1> : irqn_trait<4> { }; // EXTI1_0
+template<> struct exti_line<2> : irqn_trait<5> { }; // EXTI3_2
+template<> struct exti_line<3> : irqn_trait<5> { }; // EXTI3_2
+template<> struct exti_line<4> : irqn_trait<6> { }; // EXTI15_4
+template<> struct exti_line<5> : irqn_trait<6> { }; // EXTI15_4
+template<> struct exti_line<6> : irqn_trait<6> { }; // EXTI15_4
+template<> struct exti_line<7> : irqn_trait<6> { }; // EXTI15_4
+template<> struct exti_line<8> : irqn_trait<6> { }; // EXTI15_4
+template<> struct exti_line<9> : irqn_trait<6> { }; // EXTI15_4
+template<> struct exti_line<10> : irqn_trait<6> { }; // EXTI15_4
+template<> struct exti_line<11> : irqn_trait<6> { }; // EXTI15_4
+template<> struct exti_line<12> : irqn_trait<6> { }; // EXTI15_4
+template<> struct exti_line<13> : irqn_trait<6> { }; // EXTI15_4
+template<> struct exti_line<14> : irqn_trait<6> { }; // EXTI15_4
+template<> struct exti_line<15> : irqn_trait<6> { }; // EXTI15_4
+template<> struct dma_stream<1, 1> : irqn_trait<8> { }; // DMA1_CH3_1
+template<> struct dma_stream<1, 2> : irqn_trait<8> { }; // DMA1_CH3_1
+template<> struct dma_stream<1, 3> : irqn_trait<8> { }; // DMA1_CH3_1
+template<> struct dma_stream<1, 4> : irqn_trait<9> { }; // DMA1_CH7_4
+template<> struct dma_stream<1, 5> : irqn_trait<9> { }; // DMA1_CH7_4
+template<> struct dma_stream<1, 6> : irqn_trait<9> { }; // DMA1_CH7_4
+template<> struct dma_stream<1, 7> : irqn_trait<9> { }; // DMA1_CH7_4
+template<> struct dma_stream<2, 1> : irqn_trait<10> { }; // DMA2_CH7_1_DMAMUX1_OVR
+template<> struct dma_stream<2, 2> : irqn_trait<10> { }; // DMA2_CH7_1_DMAMUX1_OVR
+template<> struct dma_stream<2, 3> : irqn_trait<10> { }; // DMA2_CH7_1_DMAMUX1_OVR
+template<> struct dma_stream<2, 4> : irqn_trait<10> { }; // DMA2_CH7_1_DMAMUX1_OVR
+template<> struct dma_stream<2, 5> : irqn_trait<10> { }; // DMA2_CH7_1_DMAMUX1_OVR
+template<> struct dma_stream<2, 6> : irqn_trait<10> { }; // DMA2_CH7_1_DMAMUX1_OVR
+template<> struct dma_stream<2, 7> : irqn_trait<10> { }; // DMA2_CH7_1_DMAMUX1_OVR
+
+#endif
+
+#if (defined(STM32WL55xx) && defined(CORE_CM0PLUS)) || (defined(STM32WL54xx) && defined(CORE_CM0PLUS)) || \
+    (defined(STM32WL55xx) && !defined(CORE_CM0PLUS)) || (defined(STM32WL54xx) && !defined(CORE_CM0PLUS))
+
+template<> struct rcc_enable<peripheral::ipcc> : rcc_bit_trait<0x50, 20> { }; // AHB3ENR
+
+#endif
+
+#if (defined(STM32WL55xx) && !defined(CORE_CM0PLUS)) || (defined(STM32WL54xx) && !defined(CORE_CM0PLUS)) || defined(STM32WLE5xx) || \
+    defined(STM32WLE4xx)
+
+template<> struct exti_line<0> : irqn_trait<6> { }; // EXTI0
+template<> struct exti_line<1> : irqn_trait<7> { }; // EXTI1
+template<> struct exti_line<2> : irqn_trait<8> { }; // EXTI2
+template<> struct exti_line<3> : irqn_trait<9> { }; // EXTI3
+template<> struct exti_line<4> : irqn_trait<10> { }; // EXTI4
+template<> struct exti_line<5> : irqn_trait<22> { }; // EXTI9_5
+template<> struct exti_line<6> : irqn_trait<22> { }; // EXTI9_5
+template<> struct exti_line<7> : irqn_trait<22> { }; // EXTI9_5
+template<> struct exti_line<8> : irqn_trait<22> { }; // EXTI9_5
+template<> struct exti_line<9> : irqn_trait<22> { }; // EXTI9_5
+template<> struct exti_line<10> : irqn_trait<41> { }; // EXTI15_10
+template<> struct exti_line<11> : irqn_trait<41> { }; // EXTI15_10
+template<> struct exti_line<12> : irqn_trait<41> { }; // EXTI15_10
+template<> struct exti_line<13> : irqn_trait<41> { }; // EXTI15_10
+template<> struct exti_line<14> : irqn_trait<41> { }; // EXTI15_10
+template<> struct exti_line<15> : irqn_trait<41> { }; // EXTI15_10
+template<> struct dma_stream<1, 1> : irqn_trait<11> { }; // DMA1_CH1
+template<> struct dma_stream<1, 2> : irqn_trait<12> { }; // DMA1_CH2
+template<> struct dma_stream<1, 3> : irqn_trait<13> { }; // DMA1_CH3
+template<> struct dma_stream<1, 4> : irqn_trait<14> { }; // DMA1_CH4
+template<> struct dma_stream<1, 5> : irqn_trait<15> { }; // DMA1_CH5
+template<> struct dma_stream<1, 6> : irqn_trait<16> { }; // DMA1_CH6
+template<> struct dma_stream<1, 7> : irqn_trait<17> { }; // DMA1_CH7
+template<> struct dma_stream<2, 1> : irqn_trait<54> { }; // DMA2_CH1
+template<> struct dma_stream<2, 2> : irqn_trait<55> { }; // DMA2_CH2
+template<> struct dma_stream<2, 3> : irqn_trait<56> { }; // DMA2_CH3
+template<> struct dma_stream<2, 4> : irqn_trait<57> { }; // DMA2_CH4
+template<> struct dma_stream<2, 5> : irqn_trait<58> { }; // DMA2_CH5
+template<> struct dma_stream<2, 6> : irqn_trait<59> { }; // DMA2_CH6
+template<> struct dma_stream<2, 7> : irqn_trait<60> { }; // DMA2_CH7
+
+#endif
+
+/* ================================================================================================================================ */
+
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,174 @@
+/* ============================================================================================================================= *//**
+ * @file       definitions.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Thursday, 15th July 2021 10:16:05 am
+ * @modified   Friday, 23rd July 2021 7:45:11 pm
+ * @project    stm-utils
+ * @brief      header file containing helper macros for ISR vectors' defining
+ *    
+ * @copyright Krzysztof Pierczyk © 2022
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_DEVICE_INTERRUPTS_DEFINITIONS_H__
+#define __STM_UTILS_DEVICE_INTERRUPTS_DEFINITIONS_H__
+
+/* ========================================================== C mangling ========================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================= Configuration ======================================================== */
+
+/**
+ * @brief Attributes of ISR functions
+ * @note With ISR_PLAIN_HANDLERS option ISRs are compiled as plain AAPCS functions. Cortex-M hardware stacks caller-saved
+ *    registers on exception entry and (with CCR.STKALIGN set, enforced by the startup code) keeps the stack 8-byte aligned,
+ *    so the stack realignment emitted by GCC for the `interrupt` attribute is redundant
+ */
+#ifdef STM_UTILS_ISR_PLAIN_HANDLERS
+#define ISR_ATTRIBUTES
+#else
+#define ISR_ATTRIBUTES __attribute__ ((interrupt))
+#endif
+
+/* ========================================================= Declarations ========================================================= */
+
+// Init value for the stack pointer. defined in linker script
+extern unsigned long _estack;
+
+// MCU's reset handler
+void reser_handler(void) ISR_ATTRIBUTES __attribute__((noreturn));
+
+/* ========================================================== Definitions ========================================================= */
+
+// Shortcut macro for defining weakly aliased interrupt handler
+#define ISR_VECTOR( handler_name ) void handler_name(void) ISR_ATTRIBUTES __attribute__ ((weak, alias("unused_vector")))
+
+// Externally defined vector
+#define ISR_VECTOR_EXTERN( handler_name ) extern void handler_name(void) ISR_ATTRIBUTES
+
+// Shortcut macro for defining forced interrupt handler (for separate handlers of EXTIx lines)
+#define ISR_VECTOR_FORCED( handler_name ) void handler_name(void) ISR_ATTRIBUTES
+
+// Shortcut macro for defining weak dispatcher of the shared interrupt (may be overridden to handle the interrupt directly)
+#define ISR_VECTOR_DISPATCHER( handler_name ) void handler_name(void) ISR_ATTRIBUTES __attribute__ ((weak))
+
+// Shortcut macro for declaring weak reference to the vector (evaluating to 0 if the vector is not defined by the application)
+#define ISR_VECTOR_WEAK_REF( handler_name ) extern void handler_name(void) ISR_ATTRIBUTES __attribute__ ((weak))
+
+// Shortcut macro for defining weak handler of the renamed vector that calls handler of the vector under its @p legacy_name
+// (so that handlers defined by applications under legacy names are still called)
+#define ISR_VECTOR_LEGACY( handler_name, legacy_name )                                      \
+    void handler_name(void) ISR_ATTRIBUTES __attribute__ ((weak));                          \
+    void handler_name(void) {                                                               \
+        legacy_name();                                                                      \
+    }
+
+// Helper macro checking whether EXTI line's interrupt is pending
+#define ExtiPends(flags, inp) ((flags) & (1<<(inp)))
+
+// Helper macro producing mask of EXTI lines in range [@p first, @p last]
+#define ExtiLines(first, last) ((2UL << (last)) - (1UL << (first)))
+
+// Helper macro producing mask of the @p dma's ISR flags of the channel @p index whose interrupts are enabled in the channel's
+// CCR register (TCIE, HTIE and TEIE bits are aligned with TCIF, HTIF and TEIF flags). Channel's registers are addressed
+// relative to the controller so that the macro can be used for channels not implemented on the device (reading as 0)
+#define DmaChannelEnabled(dma, index) \
+    ((((DMA_Channel_TypeDef *) ((unsigned long) (dma) + 0x08UL + 0x14UL * ((index) - 1)))->CCR & 0xEUL) << (4 * ((index) - 1)))
+
+// Helper macro checking whether any of the TIM interrupts selected by @p mask is pending and enabled (SR flags are aligned
+// with DIER enable bits in the lowest byte)
+#define TimPends(tim, mask) ((tim)->SR & (tim)->DIER & (mask) & 0xFFUL)
+
+// Helper macro checking whether DMA underrun interrupt of the DAC is pending and enabled (DMAUDRx flags are aligned with
+// DMAUDRIEx enable bits)
+#define DacPends(dac) ((dac)->SR & (dac)->CR & ((1UL << 13) | (1UL << 29)))
+
+// Helper macro producing default entry of the EXTI lines' handlers table (ISR_EXTIx pseudo-vector ignoring the context)
+#define EXTI_DEFAULT_LINE_HANDLER( line ) { (exti_line_handler_ptr) ISR_EXTI##line, 0 }
+
+// Shortcut macro for defining dispatcher of the EXTI line with a dedicated vector
+#define ISR_EXTI_LINE_DISPATCHER( line )                                                    \
+    void ISR_EXTI##line##_Dispatcher(void) {                                                \
+        exti_line_handlers[line].handler(exti_line_handlers[line].context);                 \
+    }
+
+/* ======================================================== Predefinitions ======================================================== */
+
+// Unused vector handler
+static ISR_ATTRIBUTES void unused_vector(void) { while(1); };
+
+/**
+ * @returns 
+ *    index of the lowest bit set in @p flags (@p flags must not be 0)
+ * 
+ * @note Lowest bit is found with RBIT + CLZ. ARMv6-M and ARMv8-M Baseline cores (no CLZ) isolate the lowest bit and look
+ *    its index up in the de Bruijn table instead
+ */
+static inline __attribute__((always_inline)) unsigned isr_lowest_flag(unsigned long flags) {
+
+    #if defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_8M_BASE__)
+        static const unsigned char debruijn_lookup[32] = {
+             0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+            31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+        };
+        return debruijn_lookup[(uint32_t) ((flags & -flags) * 0x077CB531UL) >> 27];
+    #else
+        return __CLZ(__RBIT(flags));
+    #endif
+}
+
+/**
+ * @brief Calls handlers of all EXTI lines set in @p flags (starting from the lowest line)
+ * 
+ * @param flags 
+ *    pending flags of the lines to be dispatched (masked with the group's lines and enabled lines)
+ * @param handlers 
+ *    handlers of the EXTI lines indexed by line number (i.e. exti_line_handlers)
+ */
+static inline __attribute__((always_inline)) void exti_dispatch(unsigned long flags, const exti_line_handler *handlers) {
+    while(flags) {
+
+        // Find the lowest pending line
+        unsigned line = isr_lowest_flag(flags);
+
+        // Clear the line and dispatch it
+        flags &= flags - 1;
+        handlers[line].handler(handlers[line].context);
+    }
+}
+
+/**
+ * @brief Calls pseudo-vectors of all sources of the shared interrupt that have any flag set in @p flags (starting from
+ *    the lowest source)
+ * 
+ * @param flags 
+ *    pending flags of the sources (masked with enabled interrupts)
+ * @param shift 
+ *    log2 of the number of flags per source (i.e. source of the flag n is n >> shift)
+ * @param vectors 
+ *    pseudo-vectors of sources indexed by source number
+ */
+static inline __attribute__((always_inline)) void isr_dispatch(unsigned long flags, unsigned shift, const vector_function_ptr *vectors) {
+    while(flags) {
+
+        // Find the lowest pending source
+        unsigned source = isr_lowest_flag(flags) >> shift;
+
+        // Clear all flags of the source and dispatch it
+        flags &= ~(((2UL << ((1U << shift) - 1)) - 1) << (source << shift));
+        vectors[source]();
+    }
+}
+
+/* ================================================================================================================================ */
+
+#ifdef __cplusplus
+}
+#endif
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,151 @@
+# ====================================================================================================================================
+# @file       boot_timing.py
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Saturday, 17th October 2026 11:24:40 am
+# @modified   Saturday, 17th October 2026 11:24:40 am
+# @project    stm-utils
+# @brief      Prints breakdown of boot phases recorded by the startup code (STARTUP_BOOT_TIMING option) from the RAM dump
+# @details    The dump can be either a raw binary image of RAM (e.g. produced with GDB's `dump binary memory` command) whose
+#    start address is given with --base option, or an ELF file (e.g. produced with GDB's `dump elf memory` or `gcore`)
+#    
+# @copyright Krzysztof Pierczyk © 2026
+# ====================================================================================================================================
+
+import sys
+import os
+
+# ========================================================== Configuration ========================================================= #
+
+# Path to the main project's dircetory
+PROJECT_HOME = os.path.join(os.path.dirname(os.path.realpath(__file__)), '../../..')
+
+# Add python module to the PATH containing links definitions
+sys.path.append(os.path.join(PROJECT_HOME, 'scripts'))
+
+# ============================================================= Imports ============================================================ #
+
+import argparse
+import struct
+import rich.console
+import rich.table
+import utils
+
+# ========================================================== Configuration ========================================================= #
+
+# Name of the boot timing record symbol
+RECORD_SYMBOL = 'startup_boot_timing_record'
+# Value of the `magic` field of the complete record (STARTUP_BOOT_TIMING_MAGIC)
+RECORD_MAGIC = 0x544F4F42
+
+# Names of subsequent phases (startup_boot_phase)
+PHASES = [
+    'early_cpu_setup',
+    '.data copy',
+    '.bss zeroing',
+    'startup_clock_end',
+    'startup_extension',
+    '.bss DMA wait',
+    '__libc_init_array',
+]
+
+# Names of counters (startup_boot_timing_counter)
+COUNTERS = [ 'DWT CYCCNT', 'SysTick' ]
+
+# ============================================================= Options ============================================================ #
+
+# Create parser
+parser = argparse.ArgumentParser(description='Prints breakdown of boot phases recorded by the startup code')
+
+# Application's ELF file (argument)
+parser.add_argument('elf', metavar='ELF', type=str,
+    help='ELF file of the application used to locate the boot timing record')
+# RAM dump (argument)
+parser.add_argument('dump', metavar='DUMP', type=str,
+    help='RAM dump (either raw binary or ELF file)')
+
+# Start address of the raw binary dump (option)
+parser.add_argument('-b', '--base', type=lambda x: int(x, 0), dest='base', default=0x20000000,
+    help='Start address of the raw binary dump (default: 0x20000000)')
+# Core clock frequency (option)
+parser.add_argument('-f', '--frequency', type=int, dest='frequency', default=None,
+    help='Core clock frequency [Hz] used during boot (default: frequency stored in the record)')
+
+# Parse options
+arguments = parser.parse_args()
+
+# ============================================================= Helpers ============================================================ #
+
+def read_dump(path, address, size):
+
+    """Reads @p size bytes at @p address from the RAM dump"""
+
+    # Read ELF dump
+    with open(path, 'rb') as f:
+        is_elf = (f.read(4) == b'\x7fELF')
+    if is_elf:
+        return utils.elf.ElfFile(path).read(address, size)
+
+    # Check if the address lies in the raw dump
+    if address < arguments.base:
+        return None
+
+    # Read raw dump
+    with open(path, 'rb') as f:
+        f.seek(address - arguments.base)
+        data = f.read(size)
+    
+    return data if (len(data) == size) else None
+
+# ============================================================== Script ============================================================ #
+
+# Locate the record
+symbols = utils.elf.ElfFile(arguments.elf).symbols()
+if RECORD_SYMBOL not in symbols:
+    utils.logger.error(f'No {RECORD_SYMBOL} symbol found in {arguments.elf} (is STARTUP_BOOT_TIMING option enabled?)')
+    exit(1)
+address, size = symbols[RECORD_SYMBOL]
+
+# Read the record
+data = read_dump(arguments.dump, address, size)
+if data is None:
+    utils.logger.error(f'Boot timing record (0x{address:08X}) is not contained in the dump')
+    exit(1)
+magic, frequency, counter, *timestamps = struct.unpack(f'<{size // 4}I', data)
+
+# Validate record
+if magic != RECORD_MAGIC:
+    utils.logger.error(f'Invalid magic of the boot timing record (0x{magic:08X}); the boot has not been completed')
+    exit(1)
+if arguments.frequency is not None:
+    frequency = arguments.frequency
+
+# Prepare table
+table = rich.table.Table(title=f'Boot timing ({COUNTERS[counter] if counter < len(COUNTERS) else "unknown counter"}, ' +
+                               f'{frequency / 1e6:g} MHz)')
+table.add_column('Phase')
+table.add_column('Cycles',    justify='right')
+table.add_column('Time [us]', justify='right')
+table.add_column('Share [%]', justify='right')
+table.add_column('End [us]',  justify='right')
+
+# Fill table
+total = timestamps[-1]
+previous = 0
+for i, timestamp in enumerate(timestamps):
+    cycles = timestamp - previous
+    table.add_row(
+        PHASES[i] if i < len(PHASES) else f'phase {i}',
+        f'{cycles}',
+        f'{cycles * 1e6 / frequency:.2f}',
+        f'{cycles * 100 / total:.1f}' if total else '-',
+        f'{timestamp * 1e6 / frequency:.2f}',
+    )
+    previous = timestamp
+
+# Print summary
+table.add_section()
+table.add_row('main() entry', f'{total}', f'{total * 1e6 / frequency:.2f}', '100.0', '')
+rich.console.Console().print(table)
+
+# ================================================================================================================================== #
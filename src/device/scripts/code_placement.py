@@ -0,0 +1,232 @@
+# ====================================================================================================================================
+# @file       code_placement.py
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Saturday, 17th October 2026 11:42:16 pm
+# @modified   Saturday, 17th October 2026 11:42:16 pm
+# @project    stm-utils
+# @brief      Generates code placement scripts included by the default linker script from the function-level profile
+#             of the application
+# @details    The profile is a text file holding either PC samples (`<address> [<count>]` lines, e.g. collected by the
+#    debugger or the DWT's PC sampling) or counters of functions (`<name> <count>` lines, e.g. collected with DWT probes).
+#    Samples are attributed to functions of the profiled ELF file (built with `-ffunction-sections` and the default,
+#    empty placement). The hottest functions (by samples per byte) are moved to ITCM, CCM RAM and main RAM (in this order)
+#    up to the given budgets and the remaining sampled functions are clustered at the start of `.text` ordered by their
+#    samples count, so that the warm code shares ART/I-cache lines instead of being scattered over the flash.
+#    Functions executed before the startup code copies the code to RAM are never moved
+#
+# @copyright Krzysztof Pierczyk © 2026
+# ====================================================================================================================================
+
+import sys
+import os
+
+# ========================================================== Configuration ========================================================= #
+
+# Path to the main project's dircetory
+PROJECT_HOME = os.path.join(os.path.dirname(os.path.realpath(__file__)), '../../..')
+
+# Add python module to the PATH containing links definitions
+sys.path.append(os.path.join(PROJECT_HOME, 'scripts'))
+
+# ============================================================= Imports ============================================================ #
+
+import argparse
+import bisect
+import utils
+
+# ========================================================== Configuration ========================================================= #
+
+# Functions executed by the reset handler before the code is copied to RAM (never moved)
+STARTUP_FUNCTIONS = [
+    'reser_handler',
+    'ecc_init',
+    'boot_timing_start',
+    'boot_timing_record',
+    'early_cpu_setup',
+    'vectors_relocate',
+    'warm_boot_detect',
+    'startup_clock_begin',
+    'memory_copy',
+    'memory_decompress',
+    'code_sync',
+    'stub_function',
+    'SystemInit',
+]
+
+# Bytes reserved for each moved function (alignment and long-call veneers inserted by the linker)
+FUNCTION_OVERHEAD = 8
+
+# Placement scripts (region's option name, file name, section)
+PLACEMENTS = [
+    ('itcm',   'placement_itcm.ld',   '.itcm_text'),
+    ('ccmram', 'placement_ccmram.ld', '.ccmram_text'),
+    ('ram',    'placement_ram.ld',    '.ramfunc'),
+]
+
+# Script clustering warm code
+TEXT_PLACEMENT = 'placement_text.ld'
+
+# ============================================================= Options ============================================================ #
+
+# Create parser
+parser = argparse.ArgumentParser(description='Generates code placement scripts from the function-level profile of the application')
+
+# Profiled ELF file (argument)
+parser.add_argument('elf', metavar='ELF', type=str,
+    help='ELF file of the profiled application (linked with the default placement)')
+# Profile (argument)
+parser.add_argument('profile', metavar='PROFILE', type=str,
+    help='Profile of the application (PC samples or counters of functions)')
+
+# Output directory (option)
+parser.add_argument('-o', '--output', type=str, dest='output', default='.',
+    help='Directory where placement scripts are generated (default: current directory)')
+# Budgets of regions (options)
+parser.add_argument('--itcm-budget', type=lambda x: int(x, 0), dest='itcm', default=0,
+    help='Size of code [B] moved to ITCM RAM (default: 0)')
+parser.add_argument('--ccmram-budget', type=lambda x: int(x, 0), dest='ccmram', default=0,
+    help='Size of code [B] moved to CCM RAM (default: 0, CCM RAM of F4 devices cannot hold code)')
+parser.add_argument('--ram-budget', type=lambda x: int(x, 0), dest='ram', default=0,
+    help='Size of code [B] moved to main RAM (default: 0)')
+# Minimal share of samples of moved functions (option)
+parser.add_argument('--min-share', type=float, dest='min_share', default=0.001,
+    help='Minimal share of all samples of the function to be moved to RAM (default: 0.001)')
+# Additional functions not to be moved (option)
+parser.add_argument('-x', '--exclude', type=str, dest='exclude', nargs='*', default=[ ],
+    help='Functions that must not be moved to RAM (in addition to the ones called by the startup code before the copy)')
+
+# Parse options
+arguments = parser.parse_args()
+
+# ============================================================= Helpers ============================================================ #
+
+def read_profile(path, functions):
+
+    """Reads the profile at @p path and returns dictionary mapping names of @p functions to their samples counts"""
+
+    # Sort functions by address to resolve PC samples
+    ordered   = sorted((address, size, name) for name, (address, size) in functions.items() if size > 0)
+    addresses = [ address for address, _, _ in ordered ]
+
+    samples = { }
+    unresolved = 0
+
+    with open(path, 'r') as f:
+        for number, line in enumerate(f, 1):
+
+            # Skip comments and empty lines
+            fields = line.split('#')[0].split()
+            if len(fields) == 0:
+                continue
+
+            # Parse the line
+            try:
+                count = int(fields[1], 0) if len(fields) > 1 else 1
+            except ValueError:
+                utils.logger.warning(f'{path}:{number}: invalid count "{fields[1]}"')
+                continue
+
+            # Resolve function by its name
+            if fields[0] in functions:
+                samples[fields[0]] = samples.get(fields[0], 0) + count
+                continue
+
+            # Resolve function by the PC sample
+            try:
+                pc = int(fields[0], 16) & ~1
+            except ValueError:
+                utils.logger.warning(f'{path}:{number}: unknown function "{fields[0]}"')
+                continue
+            i = bisect.bisect_right(addresses, pc) - 1
+            if i >= 0 and pc < ordered[i][0] + ordered[i][1]:
+                samples[ordered[i][2]] = samples.get(ordered[i][2], 0) + count
+            else:
+                unresolved += count
+
+    if unresolved > 0:
+        utils.logger.warning(f'{unresolved} samples could not be attributed to any function')
+
+    return samples
+
+
+def placement_script(name, brief, functions):
+
+    """Formats placement script @p name listing sections of @p functions"""
+
+    content = utils.codegen.file_header(name,
+        f'{brief} (generated by scripts/code_placement.py, do not edit)',
+        [ 'Included by config/linker/link.ld' ]
+    ) + [
+        '',
+        utils.codegen.banner('Placement'),
+        '',
+    ]
+
+    # List sections of functions
+    content += [ f'*(.text.{function})' for function in functions ]
+
+    content += [
+        '',
+        utils.codegen.banner(),
+        '',
+    ]
+
+    return '\n'.join(content)
+
+# ============================================================== Script ============================================================ #
+
+# Load functions placed in the .text section of the profiled application
+elf = utils.elf.ElfFile(arguments.elf)
+text = elf.section('.text')
+if text is None:
+    utils.logger.error(f'No .text section found in {arguments.elf}')
+    exit(1)
+functions = {
+    name: (address, size) for name, (address, size) in elf.functions().items()
+        if text['addr'] <= address < text['addr'] + text['size']
+}
+
+# Attribute samples to functions
+samples = read_profile(arguments.profile, functions)
+total = sum(samples.values())
+if total == 0:
+    utils.logger.warning(f'No samples found in {arguments.profile}')
+
+# Order profiled functions by their density (samples per byte of code)
+excluded = set(STARTUP_FUNCTIONS + arguments.exclude)
+candidates = sorted(
+    (name for name in samples if name not in excluded and samples[name] >= arguments.min_share * total),
+    key=lambda name: samples[name] / max(functions[name][1], 1), reverse=True)
+
+# Fill regions with the hottest functions
+placed = set()
+for option, name, section in PLACEMENTS:
+
+    budget = getattr(arguments, option)
+    moved  = [ ]
+
+    for function in candidates:
+        size = functions[function][1] + FUNCTION_OVERHEAD
+        if function not in placed and size <= budget:
+            moved.append(function)
+            placed.add(function)
+            budget -= size
+
+    share = sum(samples[function] for function in moved) / total if total > 0 else 0
+    if len(moved) > 0:
+        utils.logger.info(f'{section}: {len(moved)} functions, {getattr(arguments, option) - budget} bytes, {share:.1%} of samples')
+
+    # Write the script
+    with open(os.path.join(arguments.output, name), 'w') as f:
+        f.write(placement_script(name, f'Functions moved to the {section} section', moved))
+
+# Cluster remaining sampled functions (hottest first)
+warm = sorted((name for name in samples if name not in placed), key=lambda name: samples[name], reverse=True)
+utils.logger.info(f'.text: {len(warm)} functions clustered, {sum(functions[name][1] for name in warm)} bytes')
+
+# Write the script
+with open(os.path.join(arguments.output, TEXT_PLACEMENT), 'w') as f:
+    f.write(placement_script(TEXT_PLACEMENT, 'Functions clustered at the start of the .text section', warm))
+
+# ================================================================================================================================== #
@@ -0,0 +1,269 @@
+# ====================================================================================================================================
+# @file       compress_data.py
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Saturday, 17th October 2026 2:21:47 pm
+# @modified   Saturday, 17th October 2026 2:21:47 pm
+# @project    stm-utils
+# @brief      Post-link step generating flash image (.bin/.hex) with compressed initializers of data sections
+# @details    Initializers of data sections listed in the copy table (see config/linker/link.ld) are compressed with the
+#    LZ scheme expanded by the startup code (STARTUP_COMPRESSED_DATA option) and packed at the place of the original
+#    load images. Source addresses of the compressed entries are patched in the copy table and marked with the LSB set.
+#    Load images following the code (`_etext`) are required to be placed at the end of the flash image (what is
+#    guaranteed by the default linker script). Load images of code executed from RAM precede `.text` and are kept plain.
+#    The ELF file itself is not modified (when flashed from the ELF, initializers are copied as usual)
+#
+# @copyright Krzysztof Pierczyk © 2026
+# ====================================================================================================================================
+
+import sys
+import os
+
+# ========================================================== Configuration ========================================================= #
+
+# Path to the main project's dircetory
+PROJECT_HOME = os.path.join(os.path.dirname(os.path.realpath(__file__)), '../../..')
+
+# Add python module to the PATH containing links definitions
+sys.path.append(os.path.join(PROJECT_HOME, 'scripts'))
+
+# ============================================================= Imports ============================================================ #
+
+import argparse
+import struct
+import utils
+
+# ========================================================== Configuration ========================================================= #
+
+# Minimal length of the match
+MIN_MATCH = 4
+# Maximal offset of the match
+MAX_OFFSET = 0xFFFF
+# Number of candidates checked for each position
+MAX_CANDIDATES = 16
+
+# Symbol marking support for compressed initializers in the startup code
+DECOMPRESSOR_SYMBOL = 'memory_decompress'
+
+# ============================================================= Options ============================================================ #
+
+# Create parser
+parser = argparse.ArgumentParser(description='Generates flash image with compressed initializers of data sections')
+
+# Application's ELF file (argument)
+parser.add_argument('elf', metavar='ELF', type=str,
+    help='ELF file of the application')
+
+# Output binary file (option)
+parser.add_argument('-o', '--output', type=str, dest='output', required=True,
+    help='Output binary file')
+# Output hex file (option)
+parser.add_argument('-x', '--hex', type=str, dest='hex', default=None,
+    help='Output Intel HEX file (optional)')
+# Whether to skip check of the decompressor's presence (option)
+parser.add_argument('-f', '--force', dest='force', action='store_true', default=False,
+    help='If given, presence of the decompressor in the application is not verified')
+
+# Parse options
+arguments = parser.parse_args()
+
+# ============================================================= Helpers ============================================================ #
+
+def compress(data):
+
+    """Compresses @p data with the LZ scheme expanded by the startup code (see memory_decompress() in startup.c)"""
+
+    output = bytearray()
+
+    # Auxiliary function writing length extension bytes
+    def write_extension(length):
+        while length >= 255:
+            output.append(255)
+            length -= 255
+        output.append(length)
+
+    # Auxiliary function writing a block
+    def write_block(literals, offset=None, length=0):
+
+        literals_nibble = min(len(literals), 15)
+        match_nibble    = min(length - MIN_MATCH, 15) if offset is not None else 0
+
+        # Write token and literals
+        output.append((literals_nibble << 4) | match_nibble)
+        if literals_nibble == 15:
+            write_extension(len(literals) - 15)
+        output.extend(literals)
+
+        # Write match
+        if offset is not None:
+            output.extend(struct.pack('<H', offset))
+            if match_nibble == 15:
+                write_extension(length - MIN_MATCH - 15)
+
+    # Positions of 4-byte sequences seen so far
+    chains = {}
+    # Start of pending literals
+    anchor = 0
+
+    position = 0
+    while position + MIN_MATCH <= len(data):
+
+        key = bytes(data[position : position + MIN_MATCH])
+
+        # Find the longest match among recent candidates
+        best_length, best_offset = 0, 0
+        for candidate in reversed(chains.get(key, [])[-MAX_CANDIDATES:]):
+            if position - candidate > MAX_OFFSET:
+                break
+            length = MIN_MATCH
+            while position + length < len(data) and data[candidate + length] == data[position + length]:
+                length += 1
+            if length > best_length:
+                best_length, best_offset = length, position - candidate
+
+        # Register the position
+        chains.setdefault(key, []).append(position)
+
+        # Emit block on match
+        if best_length >= MIN_MATCH:
+            write_block(data[anchor : position], best_offset, best_length)
+            for i in range(position + 1, min(position + best_length, len(data) - MIN_MATCH + 1)):
+                chains.setdefault(bytes(data[i : i + MIN_MATCH]), []).append(i)
+            position += best_length
+            anchor = position
+        else:
+            position += 1
+
+    # Emit trailing literals
+    if anchor < len(data):
+        write_block(data[anchor:])
+
+    return bytes(output)
+
+
+def decompress(stream, size):
+
+    """Reference decompressor used to verify output of compress()"""
+
+    output = bytearray()
+    src = 0
+
+    # Auxiliary function reading length extension bytes
+    def read_extension(length):
+        nonlocal src
+        if length == 15:
+            while True:
+                extension = stream[src]
+                src += 1
+                length += extension
+                if extension != 255:
+                    break
+        return length
+
+    while len(output) < size:
+        token = stream[src]
+        src += 1
+        length = read_extension(token >> 4)
+        output.extend(stream[src : src + length])
+        src += length
+        if len(output) >= size:
+            break
+        offset = stream[src] | (stream[src + 1] << 8)
+        src += 2
+        length = read_extension(token & 0xF) + MIN_MATCH
+        for _ in range(length):
+            output.append(output[-offset])
+
+    return bytes(output)
+
+
+def write_hex(path, base, image):
+
+    """Writes @p image placed at @p base address to the Intel HEX file at @p path"""
+
+    # Auxiliary function formatting a record
+    def record(type, address, data):
+        content = bytes([len(data), (address >> 8) & 0xFF, address & 0xFF, type]) + data
+        return ':' + content.hex().upper() + f'{(-sum(content)) & 0xFF:02X}\n'
+
+    with open(path, 'w') as f:
+        segment = None
+        for offset in range(0, len(image), 16):
+            address = base + offset
+            # Emit extended linear address record if needed
+            if (address >> 16) != segment:
+                segment = address >> 16
+                f.write(record(4, 0, struct.pack('>H', segment)))
+            f.write(record(0, address & 0xFFFF, image[offset : offset + 16]))
+        f.write(record(1, 0, b''))
+
+# ============================================================== Script ============================================================ #
+
+elf = utils.elf.ElfFile(arguments.elf)
+symbols = elf.symbols()
+
+# Verify that the startup code is able to expand compressed initializers
+if not arguments.force and not any(name.startswith(DECOMPRESSOR_SYMBOL) for name in symbols):
+    utils.logger.error(f'No {DECOMPRESSOR_SYMBOL} found in {arguments.elf} (is STARTUP_COMPRESSED_DATA option enabled?)')
+    exit(1)
+
+# Build flash image (as produced by `objcopy -O binary`)
+segments = [ s for s in elf.segments if s['type'] == utils.elf.PT_LOAD and s['filesz'] > 0 ]
+base = min(s['paddr'] for s in segments)
+image = bytearray(max(s['paddr'] + s['filesz'] for s in segments) - base)
+for segment in segments:
+    image[segment['paddr'] - base : segment['paddr'] - base + segment['filesz']] = \
+        elf.data[segment['offset'] : segment['offset'] + segment['filesz']]
+
+# Parse the copy table
+table_start = symbols['__copy_table_start'][0]
+table_end   = symbols['__copy_table_end'][0]
+entries = []
+for address in range(table_start, table_end, 12):
+    src, dst, end = struct.unpack_from('<3I', image, address - base)
+    if end > dst and src >= symbols['_etext'][0]:
+        entries.append(dict(address=address, src=src, size=end - dst))
+
+# Check if there is anything to do
+if len(entries) == 0:
+    utils.logger.info('No initializers to be compressed')
+    compressed_image = image
+else:
+
+    # Verify that load images occupy the end of the flash image
+    entries.sort(key=lambda e: e['src'])
+    load_start = entries[0]['src']
+    if max(e['src'] + e['size'] for e in entries) - base != len(image):
+        utils.logger.error('Load images of data sections are not placed at the end of the flash image')
+        exit(1)
+
+    # Pack (compressed) load images
+    compressed_image = image[: load_start - base]
+    for entry in entries:
+
+        # Align the stream to 8 bytes (required by the plain copy)
+        compressed_image += bytes((-len(compressed_image)) % 8)
+        address = base + len(compressed_image)
+
+        # Compress the load image (keep it plain if compression does not pay off)
+        data = bytes(image[entry['src'] - base : entry['src'] - base + entry['size']])
+        stream = compress(data)
+        assert decompress(stream, len(data)) == data
+        if len(stream) < len(data):
+            compressed_image += stream
+            struct.pack_into('<I', compressed_image, entry['address'] - base, address | 1)
+        else:
+            compressed_image += data
+            struct.pack_into('<I', compressed_image, entry['address'] - base, address)
+
+        utils.logger.info(f'Load image at 0x{entry["src"]:08X}: {len(data)} -> {min(len(stream), len(data))} bytes')
+
+    utils.logger.info(f'Flash image: {len(image)} -> {len(compressed_image)} bytes')
+
+# Write output
+with open(arguments.output, 'wb') as f:
+    f.write(compressed_image)
+if arguments.hex is not None:
+    write_hex(arguments.hex, base, bytes(compressed_image))
+
+# ================================================================================================================================== #
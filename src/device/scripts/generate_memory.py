@@ -0,0 +1,170 @@
+# ====================================================================================================================================
+# @file       generate_memory.py
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Saturday, 17th October 2026 10:58:37 pm
+# @modified   Saturday, 17th October 2026 10:58:37 pm
+# @project    stm-utils
+# @brief      Generates linker scripts defining memory regions of supported devices (config/linker/memory/<DEVICE>.ld)
+# @details    Regions are taken from the hand-maintained memory database (scripts/utils/memory.py) and cross-checked with
+#    SVD files and CMSIS headers of the device (if these have been downloaded, see update.py). Regions of the default
+#    linker script that are not present on the device are aliased to `RAM`. Memories seen by secondary cores of dual-core
+#    devices are described by <DEVICE>_<CORE>.ld scripts. Generated scripts are used as the default LINKER_MEMORY_FILE
+#
+# @copyright Krzysztof Pierczyk © 2026
+# ====================================================================================================================================
+
+import sys
+import os
+
+# ========================================================== Configuration ========================================================= #
+
+# Path to the main project's dircetory
+PROJECT_HOME = os.path.join(os.path.dirname(os.path.realpath(__file__)), '../../..')
+
+# Add python module to the PATH containing links definitions
+sys.path.append(os.path.join(PROJECT_HOME, 'scripts'))
+
+# ============================================================= Imports ============================================================ #
+
+import argparse
+import re
+import utils
+
+# ========================================================== Configuration ========================================================= #
+
+# Output directory
+OUTPUT_HOME = os.path.join(PROJECT_HOME, 'config/linker/memory')
+
+# Attributes of regions
+REGION_ATTRIBUTES = {
+    'FLASH':   'rx',
+    'BKPSRAM': 'rw',
+}
+
+# Regions not connected to the instruction bus of the CPU per family (symbols checked by the default linker script)
+NON_EXECUTABLE_REGIONS = {
+    'f4': { 'CCMRAM': 'ccmram_executable' },
+}
+
+# ============================================================= Options ============================================================ #
+
+# Create parser
+parser = argparse.ArgumentParser(description='Generates linker scripts defining memory regions of supported devices')
+
+# Families to be generated (argument)
+parser.add_argument('families', metavar='FAMILY', type=str, nargs='*', default=[ 'all' ],
+    help='Families to generate memory regions for (all by default)')
+
+# Parse options
+arguments = parser.parse_args()
+
+# ============================================================= Helpers ============================================================ #
+
+def size(value):
+
+    """Formats size of the region"""
+
+    if value % (1024 * 1024) == 0:
+        return f'{value // (1024 * 1024)}M'
+    if value % 1024 == 0:
+        return f'{value // 1024}K'
+    return f'0x{value:X}'
+
+
+def memory_script(name, device, regions, aliases, banks, non_executable):
+
+    """Formats linker script @p name defining memory @p regions of the @p device"""
+
+    content = utils.codegen.file_header(f'{name}.ld',
+        f'Memory regions of {device} devices (generated by scripts/generate_memory.py, do not edit)',
+        [ 'Size of the flash corresponds to the largest variant of the device line' ]
+    ) + [
+        '',
+        utils.codegen.banner('Memory'),
+        '',
+        'MEMORY',
+        '{',
+    ]
+
+    # Define regions
+    width = max(len(name) for name in regions)
+    for name in utils.memory.LINKER_REGIONS + sorted(set(regions) - set(utils.memory.LINKER_REGIONS)):
+        if name in regions:
+            origin, length = regions[name]
+            attributes = REGION_ATTRIBUTES.get(name, 'xrw')
+            content.append(f'    {name:<{width}} ({attributes:<3}) : ORIGIN = 0x{origin:08X}, LENGTH = {size(length)}')
+    content.append('}')
+
+    # Alias missing regions
+    missing = [ name for name in utils.memory.LINKER_REGIONS if name not in regions ]
+    if len(missing) > 0:
+        content += [ '', utils.codegen.banner('Aliases'), '' ]
+        content += [ f'REGION_ALIAS("{name}", {aliases.get(name, "RAM")});' for name in missing ]
+
+    # Mark regions that cannot hold code
+    flags = [ symbol for region, symbol in non_executable.items() if region in regions ]
+    if len(flags) > 0:
+        content += [ '', utils.codegen.banner('Code placement'), '' ]
+        content += [ '/* Regions connected to the data bus only (code placed there cannot be fetched) */' ]
+        content += [ f'{symbol} = 0;' for symbol in flags ]
+
+    # Describe flash banks
+    flash_origin, flash_length = regions['FLASH']
+    content += [
+        '',
+        utils.codegen.banner('Flash banks'),
+        '',
+        '/* Number and size of flash banks (banks follow each other) */',
+        f'flash_banks     = {banks};',
+        f'flash_bank_size = 0x{flash_length // banks:08X};',
+        '',
+        utils.codegen.banner(),
+        '',
+    ]
+
+    return '\n'.join(content)
+
+# ============================================================== Script ============================================================ #
+
+# Check if all families are to be generated
+if 'all' in arguments.families:
+    arguments.families = utils.config.SUPPORTED_FAMILIES
+
+# Generate scripts
+os.makedirs(OUTPUT_HOME, exist_ok=True)
+for family in arguments.families:
+
+    utils.logger.info(f'Generating memory regions for {family.capitalize()} family...')
+
+    # Map devices (and their secondary cores) to SVD files
+    svd_files = { }
+    for path, conditions in utils.svd.family_svd_files(family)[0]:
+        for condition in conditions:
+            device = re.match(r'\(?defined\((\w+)\)', condition).group(1)
+            cores = [ core for core, macro in utils.svd.CORE_MACROS.items() if f' defined({macro})' in condition ]
+            svd_files[(device, cores[0] if len(cores) > 0 else None)] = path
+
+    for device in utils.svd.family_devices(family):
+        for core in [ None ] + utils.memory.device_cores(device):
+
+            name = device if core is None else f'{device}_{core}'
+
+            # Find memories of the device
+            regions, aliases, banks = utils.memory.device_memory(device, core)
+            if regions is None:
+                utils.logger.warning(f'No memory description found for {device}')
+                continue
+
+            # Cross-check with CMSIS headers and the SVD file
+            mismatches = utils.memory.cmsis_check(family, device, regions) or [ ]
+            if (device, core) in svd_files:
+                mismatches += utils.memory.svd_check(utils.svd.SvdDevice(svd_files[(device, core)]), regions)
+            for mismatch in mismatches:
+                utils.logger.warning(f'{name}: {mismatch}')
+
+            # Write the file
+            with open(os.path.join(OUTPUT_HOME, f'{name}.ld'), 'w') as f:
+                f.write(memory_script(name, device, regions, aliases, banks, NON_EXECUTABLE_REGIONS.get(family, { })))
+
+# ================================================================================================================================== #
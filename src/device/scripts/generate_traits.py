@@ -0,0 +1,254 @@
+# ====================================================================================================================================
+# @file       generate_traits.py
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Saturday, 17th October 2026 4:52:40 pm
+# @modified   Saturday, 17th October 2026 4:52:40 pm
+# @project    stm-utils
+# @brief      Generates family-specific headers of the device traits (include/device/traits/stm32xxxx.h) from SVD files
+# @details    Traits map EXTI lines and DMA streams (channels) to IRQ numbers and peripherals to their enable bits in RCC
+#    registers. Devices of the family that are described by the same data share a single preprocessor block
+#
+# @copyright Krzysztof Pierczyk © 2026
+# ====================================================================================================================================
+
+import sys
+import os
+
+# ========================================================== Configuration ========================================================= #
+
+# Path to the main project's dircetory
+PROJECT_HOME = os.path.join(os.path.dirname(os.path.realpath(__file__)), '../../..')
+
+# Add python module to the PATH containing links definitions
+sys.path.append(os.path.join(PROJECT_HOME, 'scripts'))
+
+# ============================================================= Imports ============================================================ #
+
+import re
+import argparse
+import utils
+
+# ========================================================== Configuration ========================================================= #
+
+# Output directory
+OUTPUT_HOME = os.path.join(PROJECT_HOME, 'src/device/include/device/traits')
+
+# Names of RCC registers holding enable bits of peripherals (low-power and secondary-core registers are skipped)
+RCC_ENABLE_REGISTER = re.compile(r'^(?:AHB\d*|APB\d*[LH]?|IOP)ENR\d*$')
+
+# Names of peripherals given by SVD files that differ from the ones used by CMSIS headers (SVD name -> CMSIS name)
+PERIPHERAL_ALIASES = {
+    'crypt':    'cryp',
+    'dfsdm':    'dfsdm1',
+    'dma':      'dma1',
+    'dmamux':   'dmamux1',
+    'firewall': 'fw',
+    'hash1':    'hash',
+    'i2cfmp1':  'fmpi2c1',
+    'lptimer1': 'lptim1',
+    'lptmi1':   'lptim1',
+    'sdmmc':    'sdmmc1',
+    'sp3':      'spi3',
+    'spi2s2':   'spi2',
+}
+
+# Enable bits missing in SVD files (name of the device -> { peripheral: (register offset, bit, register name) })
+RCC_ENABLE_FIXES = {
+    'STM32F405': { 'ccmdataram': (0x30, 20, 'AHB1ENR') },
+    'STM32F407': { 'ccmdataram': (0x30, 20, 'AHB1ENR') },
+    'STM32F427': { 'ccmdataram': (0x30, 20, 'AHB1ENR') },
+}
+
+# Words that cannot be used as names of peripherals
+RESERVED_NAMES = { 'and', 'or', 'not', 'xor', 'compl', 'bitand', 'bitor', 'register', 'default', 'delete', 'new' }
+
+# ============================================================= Options ============================================================ #
+
+# Create parser
+parser = argparse.ArgumentParser(description='Generates family-specific headers of the device traits from SVD files')
+
+# Families to be generated (argument)
+parser.add_argument('families', metavar='FAMILY', type=str, nargs='*', default=[ 'all' ],
+    help='Families to generate traits for (all by default)')
+
+# Parse options
+arguments = parser.parse_args()
+
+# ============================================================= Helpers ============================================================ #
+
+def exti_lines(device):
+
+    """Returns map of EXTI lines to (IRQ number, IRQ name) pairs"""
+
+    lines = { }
+    for number, names in sorted(device.interrupts.items()):
+        for name in names:
+            # Lines are given either as a single line or as a range in any order (e.g. EXTI9_5, EXTI1_0, EXTI4_15) optionally
+            # followed by other sources of the interrupt (e.g. EXTI2_TSC)
+            match = re.match(r'^EXTI(\d+)(?:_(\d+))?(?:_[A-Za-z]\w*)?$', name)
+            if match is None:
+                continue
+            first, last = sorted(int(n) for n in match.groups(match.group(1)))
+            for line in range(first, min(last, 15) + 1):
+                lines.setdefault(line, (number, name))
+    return lines
+
+
+def dma_streams(device):
+
+    """Returns map of (DMA, stream) pairs to (IRQ number, IRQ name) pairs"""
+
+    streams = { }
+    for number, names in sorted(device.interrupts.items()):
+        for name in names:
+
+            if not name.startswith('DMA'):
+                continue
+
+            # Parse groups of streams (e.g. DMA1_Stream0, DMA_STR0, DMA1_CH3_1, DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR,
+            # DMA1_Channel4_5_6_7_DMAMUX_DMA2_Channel1_2_3_4_5)
+            groups, dma = [ ], None
+            for token in name.split('_'):
+                if re.match(r'^DMA\d*$', token):
+                    dma = int(token[3:] or '1')
+                elif dma is not None and re.match(r'^(?:STR|Stream|Channel|CH|Ch)\d+$', token):
+                    groups.append((dma, [ int(re.search(r'\d+$', token).group(0)) ]))
+                elif len(groups) > 0 and token.isdigit():
+                    groups[-1][1].append(int(token))
+                else:
+                    dma = None
+
+            # Two numbers denote range of streams (in any order), more numbers denote list of streams
+            for dma, indices in groups:
+                if len(indices) == 2:
+                    indices = range(min(indices), max(indices) + 1)
+                for index in indices:
+                    streams.setdefault((dma, index), (number, name))
+
+    return streams
+
+
+def rcc_enable_bits(device):
+
+    """Returns map of peripherals to (register offset, bit, register name) tuples"""
+
+    bits = { }
+    for register in device.peripherals.get('RCC', [ ]):
+        # Skip prefix used in some SVD files (e.g. RCC_AHB1ENR)
+        register_name = re.sub(r'^RCC_', '', register['name'])
+        if not RCC_ENABLE_REGISTER.match(register_name):
+            continue
+        for field in sorted(register['fields'], key=lambda f: f['offset']):
+            name = field['name'].lower()
+            if field['width'] != 1 or not name.endswith('en'):
+                continue
+            # Unify names of GPIO ports (e.g. IOPAEN, GPIOPAEN)
+            name = re.sub(r'^(?:gp)?iop([a-z])$', r'gpio\1', name[:-2])
+            name = PERIPHERAL_ALIASES.get(name, name)
+            if not re.match(r'^[a-z_][a-z0-9_]*$', name) or name in RESERVED_NAMES:
+                continue
+            bits.setdefault(name, (register['offset'], field['offset'], register_name))
+    for name, bit in RCC_ENABLE_FIXES.get(device.name, { }).items():
+        bits.setdefault(name, bit)
+    return bits
+
+
+# ============================================================== Script ============================================================ #
+
+# Check if all families are to be generated
+if 'all' in arguments.families:
+    arguments.families = utils.config.SUPPORTED_FAMILIES
+
+# Iterate over families
+for family in arguments.families:
+
+    utils.logger.info(f'Generating traits for {family.capitalize()} family...')
+
+    # Map devices to SVD files
+    files, unsupported = utils.svd.family_svd_files(family)
+    if len(files) == 0:
+        utils.logger.error(f'No SVD files found for {family.capitalize()} family')
+        continue
+
+    # Produce specializations of traits for each SVD file (specialization -> list of files)
+    specializations = { }
+    peripherals = set()
+    for index, (path, _) in enumerate(files):
+
+        device = utils.svd.SvdDevice(path)
+
+        entries = [ ]
+        for line, (number, name) in sorted(exti_lines(device).items()):
+            entries.append(f'template<> struct exti_line<{line}> : irqn_trait<{number}> {{ }}; // {name}')
+        for (dma, stream), (number, name) in sorted(dma_streams(device).items()):
+            entries.append(f'template<> struct dma_stream<{dma}, {stream}> : irqn_trait<{number}> {{ }}; // {name}')
+        for peripheral, (offset, bit, register) in sorted(rcc_enable_bits(device).items()):
+            peripherals.add(peripheral)
+            entries.append(
+                f'template<> struct rcc_enable<peripheral::{peripheral}> : rcc_bit_trait<0x{offset:X}, {bit}> {{ }}; // {register}')
+
+        for entry in entries:
+            specializations.setdefault(entry, [ ]).append(index)
+
+    # Group specializations shared by the same set of devices (keeping the order of first appearance)
+    groups = { }
+    for entry, indices in specializations.items():
+        groups.setdefault(tuple(indices), [ ]).append(entry)
+
+    # Prepare content of the file
+    header = f'stm32{family}xx.h'
+    guard = f'__STM_UTILS_DEVICE_TRAITS_STM32{family.upper()}XX_H__'
+    content = utils.codegen.file_header(header,
+        f'Device traits for STM32{family.upper()}xx devices (generated by scripts/generate_traits.py, do not edit)',
+        [ f'Devices not described by SVD files: {", ".join(unsupported)}' ] if len(unsupported) > 0 else [ ]
+    ) + [
+        '',
+        f'#ifndef {guard}',
+        f'#define {guard}',
+        '',
+        utils.codegen.banner('Namespace'),
+        '',
+        'namespace device::traits {',
+        '',
+        utils.codegen.banner('Types'),
+        '',
+        '/// Peripherals clocked through RCC enable bits (union over all devices of the family)',
+        'enum class peripheral {',
+        ',\n'.join(f'    {p}' for p in sorted(peripherals)),
+        '};',
+        '',
+        utils.codegen.banner('Traits'),
+    ]
+
+    # Write groups of specializations
+    all_devices = tuple(range(len(files)))
+    for indices, entries in sorted(groups.items(), key=lambda g: (g[0] != all_devices, g[0])):
+        guarded = (indices != all_devices) or len(unsupported) > 0
+        content.append('')
+        if guarded:
+            content.append(utils.codegen.condition([ c for i in indices for c in files[i][1] ]))
+            content.append('')
+        content.extend(entries)
+        if guarded:
+            content.append('')
+            content.append('#endif')
+
+    content += [
+        '',
+        utils.codegen.banner(),
+        '',
+        '}',
+        '',
+        utils.codegen.banner(),
+        '',
+        '#endif',
+        '',
+    ]
+
+    # Write the file
+    os.makedirs(OUTPUT_HOME, exist_ok=True)
+    with open(os.path.join(OUTPUT_HOME, header), 'w') as f:
+        f.write('\n'.join(content))
+
+# ================================================================================================================================== #
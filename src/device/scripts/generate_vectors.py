@@ -0,0 +1,957 @@
+# ====================================================================================================================================
+# @file       generate_vectors.py
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Saturday, 17th October 2026 6:14:31 pm
+# @modified   Saturday, 17th October 2026 6:14:31 pm
+# @project    stm-utils
+# @brief      Generates family-specific definitions of interrupt vectors (src/interrupts/vectors/stm32xxxx.c) from SVD files
+# @details    For each family the script emits weak aliases of all interrupt vectors, ISR vectors tables of all devices
+#    (devices with the same table share a single preprocessor block) and dispatchers of shared interrupts. Interrupts
+#    shared by EXTI lines are dispatched to the exti_line_handlers table, interrupts shared by DMA channels and by
+#    different peripherals (e.g. TIM1_BRK_TIM9, TIM6_DAC) call pseudo-vectors of sources with pending flags
+#
+# @copyright Krzysztof Pierczyk © 2026
+# ====================================================================================================================================
+
+import sys
+import os
+
+# ========================================================== Configuration ========================================================= #
+
+# Path to the main project's dircetory
+PROJECT_HOME = os.path.join(os.path.dirname(os.path.realpath(__file__)), '../../..')
+
+# Add python module to the PATH containing links definitions
+sys.path.append(os.path.join(PROJECT_HOME, 'scripts'))
+
+# ============================================================= Imports ============================================================ #
+
+import re
+import argparse
+import utils
+
+# ========================================================== Configuration ========================================================= #
+
+# Output directory
+OUTPUT_HOME = os.path.join(PROJECT_HOME, 'src/device/src/interrupts/vectors')
+
+# Cores of families' devices (SVD files of dual-core devices give the core in the name, e.g. STM32H745_CM4.svd)
+FAMILY_CORES = {
+    'f0': 'CM0',
+    'f1': 'CM3',
+    'f2': 'CM3',
+    'f3': 'CM4',
+    'f4': 'CM4',
+    'f7': 'CM7',
+    'g0': 'CM0P',
+    'g4': 'CM4',
+    'h7': 'CM7',
+    'l0': 'CM0P',
+    'l1': 'CM3',
+    'l4': 'CM4',
+    'l5': 'CM33',
+    'wb': 'CM4',
+    'wl': 'CM4',
+}
+
+# Definitions of the EXTI_PENDING macro (pending flags of EXTI lines enabled for the current core)
+EXTI_PENDING = {
+    'g0': [ '#define EXTI_PENDING ((EXTI->RPR1 | EXTI->FPR1) & EXTI->IMR1)' ],
+    'g4': [ '#define EXTI_PENDING (EXTI->PR1 & EXTI->IMR1)' ],
+    'h7': [
+        '#if defined(CORE_CM4)',
+        '#define EXTI_PENDING (EXTI_D2->PR1 & EXTI_D2->IMR1)',
+        '#else',
+        '#define EXTI_PENDING (EXTI_D1->PR1 & EXTI_D1->IMR1)',
+        '#endif',
+    ],
+    'l4': [ '#define EXTI_PENDING (EXTI->PR1 & EXTI->IMR1)' ],
+    'l5': [ '#define EXTI_PENDING ((EXTI->RPR1 | EXTI->FPR1) & EXTI->IMR1)' ],
+    'wb': [ '#define EXTI_PENDING (EXTI->PR1 & EXTI->IMR1)' ],
+    'wl': [
+        '#if defined(CORE_CM0PLUS)',
+        '#define EXTI_PENDING (EXTI->PR1 & EXTI->C2IMR1)',
+        '#else',
+        '#define EXTI_PENDING (EXTI->PR1 & EXTI->IMR1)',
+        '#endif',
+    ],
+}
+
+# Default definition of the EXTI_PENDING macro
+EXTI_PENDING_DEFAULT = [ '#define EXTI_PENDING (EXTI->PR & EXTI->IMR)' ]
+
+# Names of interrupts misspelled in SVD files or given differently for devices of the same family (mapped to CMSIS names)
+VECTOR_ALIASES = {
+    'CORDIC_IT':             'CORDIC',
+    'Cordic':                'CORDIC',
+    'DMAMUX_OVR':            'DMAMUX1_OVR',
+    'DMAMUX1_OV':            'DMAMUX1_OVR',
+    'DSIHSOT':               'DSIHOST',
+    'EXTI2_TS':              'EXTI2_TSC',
+    'EXTI5_9':               'EXTI9_5',
+    'EXTI10_15':             'EXTI15_10',
+    'HRTIM_Master':          'HRTIM1_Master',
+    'HRTIM_TIMA':            'HRTIM1_TIMA',
+    'HRTIM_TIMB':            'HRTIM1_TIMB',
+    'HRTIM_TIMC':            'HRTIM1_TIMC',
+    'HRTIM_TIMD':            'HRTIM1_TIMD',
+    'HRTIM_TIME':            'HRTIM1_TIME',
+    'HRTIM_TIMF':            'HRTIM1_TIMF',
+    'HRTIM_TIM_FLT':         'HRTIM1_FLT',
+    'IPCC_C1_RX_IT':         'IPCC_C1_RX',
+    'IPCC_C1_TX_IT':         'IPCC_C1_TX',
+    'LCD_TFT':               'LTDC',
+    'LCD_TFT_1':             'LTDC_ER',
+    'LCD_TFT_ER':            'LTDC_ER',
+    'LP_Timer1':             'LPTIM1',
+    'LPTimer1':              'LPTIM1',
+    'LPUART':                'LPUART1',
+    'lptim1_OR_it_eit_23':   'LPTIM1',
+    'Quad_SP':               'QUADSPI',
+    'QuadSPI':               'QUADSPI',
+    'RNG_HASH':              'HASH_RNG',
+    'RTCAlarm':              'RTC_Alarm',
+    'RTC_ALARM':             'RTC_Alarm',
+    'RTC_ALARM_IT':          'RTC_Alarm',
+    'TIM1_BRK_UP_TRG_COMP':  'TIM1_BRK_UP_TRG_COM',
+    'TIM6_DAC1':             'TIM6_DAC',
+    'TIM6_DACUNDER':         'TIM6_DAC',
+    'True_RNG':              'RNG',
+    'USBWakeUP':             'USBWakeUp',
+}
+
+# Names of interrupts specific to the family (applied before VECTOR_ALIASES, mapped to CMSIS names)
+FAMILY_VECTOR_ALIASES = {
+    'f0': {
+        'DMA1_CH2_3':                              'DMA1_Channel2_3',
+        'DMA1_CH2_3_DMA2_CH1_2':                   'DMA1_Ch2_3_DMA2_Ch1_2',
+        'DMA1_CH4_5':                              'DMA1_Channel4_5',
+        'DMA1_CH4_5_6_7':                          'DMA1_Channel4_5_6_7',
+        'DMA1_CH4_5_6_7_DMA2_CH3_4_5':             'DMA1_Ch4_7_DMA2_Ch3_5',
+        'USART3_4_5_6_7_8':                        'USART3_8',
+    },
+    'f1': {
+        'CAN_RX1':                                 'CAN1_RX1',
+        'CAN_SCE':                                 'CAN1_SCE',
+        'RTC_WKUP':                                'RTC',
+        'TAMPER_STAMP':                            'TAMPER',
+        'USBWakeup':                               'USBWakeUp',
+    },
+    'f3': {
+        'ADC_SD1':                                 'SDADC1',
+        'ADC_SD2':                                 'SDADC2',
+        'ADC_SD3':                                 'SDADC3',
+        'CAN_RXD':                                 'CAN_RX0',
+        'CAN_RXI':                                 'CAN_RX1',
+        'COMP123':                                 'COMP1_2_3',
+        'COMP456':                                 'COMP4_5_6',
+        'EXTI2_RI':                                'EXTI2_TSC',
+        'I2C1_EV_EXTI23':                          'I2C1_EV',
+        'I2C2_EV_EXTI24':                          'I2C2_EV',
+        'I2C3_EV_EXTI27':                          'I2C3_EV',
+        'TAMP':                                    'TAMP_STAMP',
+        'TIM18_DAC':                               'TIM18_DAC2',
+        'TIM18_DAC3':                              'TIM18_DAC2',
+        'UART4_EXTI34':                            'UART4',
+        'UART5_EXTI35':                            'UART5',
+        'USART1_EXTI25':                           'USART1',
+        'USART2_EXTI26':                           'USART2',
+        'USART3_EXTI28':                           'USART3',
+        'USB_WAKEUP':                              'USBWakeUp',
+        'USB_WKUP':                                'USBWakeUp',
+        'USB_WKUP_EXTI':                           'USBWakeUp_RMP',
+    },
+    'f4': {
+        'CRYPTO':                                  'AES',
+        'DFSDM2_FILTER1':                          'DFSDM2_FLT0',
+        'DFSDM2_FILTER2':                          'DFSDM2_FLT1',
+        'DFSDM2_FILTER3':                          'DFSDM2_FLT2',
+        'DFSDM2_FILTER4':                          'DFSDM2_FLT3',
+        'EXTI16_PVD':                              'PVD',
+        'EXTI17_RTC_Alarm':                        'RTC_Alarm',
+        'EXTI18_OTG_FS_WKUP':                      'OTG_FS_WKUP',
+        'EXTI22_RTC_WKUP':                         'RTC_WKUP',
+        'FMPI2C1':                                 'FMPI2C1_EV',
+        'FMPI2C1_error':                           'FMPI2C1_ER',
+        'HDMI_CEC':                                'CEC',
+        'I2C1_ERR':                                'I2C1_ER',
+        'I2C1_EVT':                                'I2C1_EV',
+        'I2C2_ERR':                                'I2C2_ER',
+        'I2C2_EVT':                                'I2C2_EV',
+        'I2C4_ER':                                 'FMPI2C1_ER',
+        'I2C4_EV':                                 'FMPI2C1_EV',
+        'I2CFMP1_error':                           'FMPI2C1_ER',
+        'I2CFMP1_event':                           'FMPI2C1_EV',
+        'I2CFMP1error':                            'FMPI2C1_ER',
+        'I2CFMP1event':                            'FMPI2C1_EV',
+        'SPDIF_Rx':                                'SPDIF_RX',
+        'TIM6_GLB_IT_DAC1_DAC2':                   'TIM6_DAC',
+        'USART4':                                  'UART4',
+        'USART7':                                  'UART7',
+        'USART8':                                  'UART8',
+    },
+    'f7': {
+        'FSMC':                                    'FMC',
+    },
+    'g0': {
+        'ADC':                                     'ADC1',
+        'ADC_COMP':                                'ADC1_COMP',
+        'I2C2_I2C3':                               'I2C2_3',
+        'RTC_STAMP':                               'RTC_TAMP',
+        'SPI2_SPI3':                               'SPI2_3',
+        'UCPD1_UCPD2':                             'UCPD1_2',
+        'UCPD1_UCPD2_USB':                         'USB_UCPD1_2',
+        'USART3_USART4_LPUART1':                   'USART3_4_LPUART1',
+        'USART3_USART4_USART5_USART6_LPUART1':     'USART3_4_5_6_LPUART1',
+    },
+    'g4': {
+        'RTC_TAMP_CSS_LSE':                        'RTC_TAMP_LSECSS',
+        'SAI':                                     'SAI1',
+    },
+    'h7': {
+        'BDMA_CH1':                                'BDMA_Channel0',
+        'BDMA_CH2':                                'BDMA_Channel1',
+        'BDMA_CH3':                                'BDMA_Channel2',
+        'BDMA_CH4':                                'BDMA_Channel3',
+        'BDMA_CH5':                                'BDMA_Channel4',
+        'BDMA_CH6':                                'BDMA_Channel5',
+        'BDMA_CH7':                                'BDMA_Channel6',
+        'BDMA_CH8':                                'BDMA_Channel7',
+        'RTC_TAMP_STAMP_CSS_LSE':                  'TAMP_STAMP',
+        'SDMMC':                                   'SDMMC2',
+        'SPDIF':                                   'SPDIF_RX',
+        'TIM_CC':                                  'TIM1_CC',
+        'WKUP':                                    'WAKEUP_PIN',
+        'HSEM0':                                   'HSEM1',
+        'HSEM1':                                   'HSEM2',
+        'cm4_sev_it':                              'CM4_SEV',
+        'cm7_sev_it':                              'CM7_SEV',
+        'WWDG1':                                   'WWDG',
+        'WWDG2':                                   'WWDG',
+        'WWDG1_RST':                               'WWDG_RST',
+        'WWDG2_RST':                               'WWDG_RST',
+    },
+    'l0': {
+        'DMA1_Channel4_7':                         'DMA1_Channel4_5_6_7',
+        'USART4_USART5':                           'USART4_5',
+    },
+    'l1': {
+        'COMP_CA':                                 'COMP',
+        'USART4':                                  'UART4',
+        'USART5':                                  'UART5',
+    },
+    'l4': {
+        'PVD':                                     'PVD_PVM',
+        'RTC_TAMP_STAMP':                          'TAMP_STAMP',
+        'RTC_TAMP_STAMP_CSS_LSE':                  'TAMP_STAMP',
+        'SDMMC':                                   'SDMMC1',
+        'TIM8':                                    'TIM8_UP',
+        'TIM15':                                   'TIM1_BRK_TIM15',
+        'TIM16':                                   'TIM1_UP_TIM16',
+        'USB_FS':                                  'USB',
+    },
+    'wb': {
+        'C2SEV':                                   'C2SEV_PWR_C2H',
+        'CRS_IT':                                  'CRS',
+        'PWR_SOTF':                                'PWR_SOTF_BLEACT_802ACT_RFPHASE',
+        'RTC_TAMP':                                'TAMP_STAMP_LSECSS',
+    },
+    'wl': {
+        'DMA1_CH3_1':                              'DMA1_Channel1_2_3',
+        'DMA1_CH7_4':                              'DMA1_Channel4_5_6_7',
+        'DMA2_CH7_1_DMAMUX1_OVR':                  'DMA2_DMAMUX1_OVR',
+        'FLASH_RCC_C1SEV':                         'RCC_FLASH_C1SEV',
+        'I2C1_EV_I2C1_ER':                         'I2C1',
+        'I2C2_EV_I2C2_ER':                         'I2C2',
+        'I2C3_EV_I2C3_ER':                         'I2C3',
+        'IPCC_C2_RX_IT_IPCC_C2_TX_IT':             'IPCC_C2_RX_C2_TX',
+        'PVD_PVM_3':                               'PVD_PVM',
+        'PWR_C2H_C2SEV':                           'C2SEV_PWR_C2H',
+        'Radio_IRQ_Busy':                          'SUBGHZ_Radio',
+        'SPI2S2':                                  'SPI2',
+        'TAMP_RTCSTAMP_LSECSS_RTCALARM_RTCSSRU_RTCWKUP': 'RTC_LSECSS',
+        'TAMP_RTCSTAMP_LSECSS_RTCSSRU':            'TAMP_STAMP_LSECSS_SSRU',
+        'TIM1_BRK_TIM1_UP_TIM1_TRG_COM_TIM1_CC':   'TIM1',
+    },
+}
+
+# Vectors renamed since handwritten tables of the family (legacy name -> current name, None keeps the legacy vector defined
+# only). Default handlers of renamed vectors call handlers defined by the application under legacy names
+LEGACY_VECTORS = {
+    'f4': {
+        'ISR_Cryp':                 'ISR_CRYP',
+        'ISR_DCMI_isr_vector':      'ISR_DCMI',
+        'ISR_ETH_Wakeup':           'ISR_ETH_WKUP',
+        'ISR_Hash_RNG':             'ISR_HASH_RNG',
+        'ISR_OTG_HS_EP1_Out':       'ISR_OTG_HS_EP1_OUT',
+        'ISR_OTG_HS_Wakeup':        'ISR_OTG_HS_WKUP',
+        'ISR_RTC_Wakeup':           'ISR_RTC_WKUP',
+        'ISR_Tamper':               'ISR_TAMP_STAMP',
+        'ISR_TIM1_Break_TIM9':      'ISR_TIM1_BRK_TIM9',
+        'ISR_TIM1_Update_TIM10':    'ISR_TIM1_UP_TIM10',
+        'ISR_TIM8_Break_TIM12':     'ISR_TIM8_BRK_TIM12',
+        'ISR_TIM8_Update_TIM13':    'ISR_TIM8_UP_TIM13',
+        'ISR_USART4':               'ISR_UART4',
+        'ISR_USART5':               'ISR_UART5',
+        'ISR_USB_Wakeup':           'ISR_OTG_FS_WKUP',
+    },
+    'g0': {
+        'EXC_MemoryManagement':     None,
+    },
+    'wl': {
+        'DebugMon_Handler':         'EXC_DebugMonitor',
+        'EXC_UageFault':            'EXC_UsageFault',
+    },
+}
+
+# Flags of the TIM's SR register corresponding to events of interrupts shared by a single timer (e.g. TIM1_BRK_TIM9)
+TIM_EVENTS = {
+    'BRK': 'TIM_SR_BIF',
+    'UP':  'TIM_SR_UIF',
+    'TRG': 'TIM_SR_TIF',
+    'COM': 'TIM_SR_COMIF',
+    'CC':  'TIM_SR_CC1IF | TIM_SR_CC2IF | TIM_SR_CC3IF | TIM_SR_CC4IF',
+}
+
+# ============================================================= Options ============================================================ #
+
+# Create parser
+parser = argparse.ArgumentParser(description='Generates family-specific definitions of interrupt vectors from SVD files')
+
+# Families to be generated (argument)
+parser.add_argument('families', metavar='FAMILY', type=str, nargs='*', default=[ 'all' ],
+    help='Families to generate vectors for (all by default)')
+
+# Parse options
+arguments = parser.parse_args()
+
+# ============================================================= Helpers ============================================================ #
+
+def vector_name(family, name):
+
+    """Unifies @p name of the interrupt of the @p family device given in the SVD file (e.g. DMA1_CH1_IRQ -> DMA1_Channel1)"""
+
+    name = re.sub(r'_IRQn?$', '', name)
+    name = FAMILY_VECTOR_ALIASES.get(family, { }).get(name, name)
+    name = VECTOR_ALIASES.get(name, name)
+
+    # Unify names of DMA controllers (e.g. DMA_Channel2_3)
+    name = re.sub(r'^DMA_', 'DMA1_', name)
+
+    # Unify names of DMA channels and streams
+    match = re.match(r'^DMA(\d*)_(CH|Ch|Channel|STR|Stream)(\d+)$', name)
+    if match is not None:
+        kind = 'Stream' if match.group(2) in [ 'STR', 'Stream' ] else 'Channel'
+        return f'DMA{match.group(1) or 1}_{kind}{match.group(3)}'
+
+    return name
+
+
+def exceptions(core):
+
+    """Returns list of exception vectors (without stack pointer and reset handler) of the @p core"""
+
+    # ARMv6-M (and ARMv8-M Baseline) cores
+    if core.startswith('CM0'):
+        return [ 'EXC_NMI', 'EXC_HardFault' ] + [ None ] * 7 + [ 'SVC_Handler' ] + [ None ] * 2 + [ 'PendSV_Handler', 'SysTick_Handler' ]
+
+    # ARMv7-M and ARMv8-M Mainline cores
+    return [
+        'EXC_NMI',
+        'EXC_HardFault',
+        'EXC_MemoryManagement',
+        'EXC_BusFault',
+        'EXC_UsageFault',
+        'EXC_SecureFault' if core == 'CM33' else None,
+        None,
+        None,
+        None,
+        'SVC_Handler',
+        'EXC_DebugMonitor',
+        None,
+        'PendSV_Handler',
+        'SysTick_Handler',
+    ]
+
+
+def sources(name):
+
+    """
+    Parses sources of the shared interrupt from its @p name
+
+    Returns
+    -------
+    sources
+        list of (kind, peripheral, details) tuples or None if any of sources is not known
+    """
+
+    tokens, result = name.split('_'), [ ]
+
+    i = 0
+    while i < len(tokens):
+
+        token = tokens[i]
+        i += 1
+
+        # EXTI lines given as a single line or a range in any order (e.g. EXTI9_5, EXTI4_15)
+        if re.match(r'^EXTI\d+$', token):
+            lines = [ int(token[4:]) ]
+            if i < len(tokens) and tokens[i].isdigit():
+                lines.append(int(tokens[i]))
+                i += 1
+            if max(lines) > 15:
+                return None
+            result.append(('exti', 'EXTI', (min(lines), max(lines))))
+
+        # DMA channels given as a range (two numbers in any order), a list (e.g. DMA1_CH3_1, DMA1_Channel4_5_6_7) or all
+        # channels of the controller (e.g. DMA2_DMAMUX1_OVR)
+        elif re.match(r'^DMA\d*$', token):
+            if i == len(tokens) or re.match(r'^DMAMUX\d*$', tokens[i]):
+                result.append(('dma', f'DMA{token[3:] or 1}', tuple(range(1, 8))))
+                continue
+            if not re.match(r'^(?:CH|Ch|Channel)\d+$', tokens[i]):
+                return None
+            channels = [ int(re.search(r'\d+$', tokens[i]).group(0)) ]
+            i += 1
+            while i < len(tokens) and tokens[i].isdigit():
+                channels.append(int(tokens[i]))
+                i += 1
+            if len(channels) == 2:
+                channels = list(range(min(channels), max(channels) + 1))
+            result.append(('dma', f'DMA{token[3:] or 1}', tuple(sorted(channels))))
+
+        # Overrun of the DMA request multiplexer (e.g. DMAMUX1_OVR, DMAMUX)
+        elif re.match(r'^DMAMUX\d*$', token):
+            if i < len(tokens) and tokens[i] in [ 'OVR', 'OV' ]:
+                i += 1
+            result.append(('dmamux', f'DMAMUX{token[6:] or 1}', None))
+
+        # Timer with optional list of events (e.g. TIM1_BRK, TIM1_TRG_COM, TIM9)
+        elif re.match(r'^TIM\d+$', token):
+            events = [ ]
+            while i < len(tokens) and tokens[i] in TIM_EVENTS:
+                events.append(tokens[i])
+                i += 1
+            result.append(('tim', token, tuple(events)))
+
+        # Low-power timer
+        elif re.match(r'^LPTIM\d+$', token):
+            result.append(('lptim', token, None))
+
+        # DMA underrun of the DAC (shared with TIM6 on all families)
+        elif re.match(r'^DAC1?$|^DACUNDER$', token) and len(result) > 0 and result[-1][1] == 'TIM6':
+            result.append(('dac', 'DAC1', None))
+
+        # Touch sensing controller
+        elif token in [ 'TS', 'TSC' ]:
+            result.append(('tsc', 'TSC', None))
+
+        else:
+            return None
+
+    return result
+
+
+def dispatched(name):
+
+    """Checks whether interrupt @p name requires a dispatcher (returns list of its sources if so)"""
+
+    parsed = sources(name)
+    if parsed is None:
+        return None
+
+    # Interrupts of EXTI lines (besides dedicated lines), DMA channels and of different peripherals are dispatched
+    if any(kind == 'exti' for kind, _, _ in parsed):
+        return parsed
+    if any(kind == 'dma' and len(channels) > 1 for kind, _, channels in parsed):
+        return parsed
+    if len(set(peripheral for _, peripheral, _ in parsed)) > 1:
+        return parsed
+
+    return None
+
+
+def dedicated_exti_line(name):
+
+    """Returns EXTI line handled by the dedicated interrupt @p name (None if interrupt is not dedicated to a single line)"""
+
+    parsed = sources(name)
+    if parsed is None or len(parsed) != 1 or parsed[0][0] != 'exti':
+        return None
+    first, last = parsed[0][2]
+    return first if first == last else None
+
+
+def pseudo_vectors(parsed):
+
+    """Returns names of pseudo-vectors called by the dispatcher of interrupt with @p parsed sources"""
+
+    result = [ ]
+    for kind, peripheral, details in parsed:
+        if kind == 'dma':
+            result += [ f'{peripheral}_Channel{channel}' for channel in details ]
+        elif kind == 'dmamux':
+            result.append(f'{peripheral}_OVR')
+        elif kind == 'tim':
+            result.append('_'.join((peripheral,) + details))
+        elif kind == 'dac':
+            result.append('DAC')
+        elif kind in [ 'lptim', 'tsc' ]:
+            result.append(peripheral)
+    return result
+
+
+def dispatcher(name, parsed, legacy=None):
+
+    """Formats dispatcher of the interrupt @p name with @p parsed sources (calling @p legacy handler instead if defined)"""
+
+    # Dispatchers of EXTI-only interrupts are kept in the format of handwritten ones
+    if all(kind == 'exti' for kind, _, _ in parsed):
+        first, last = parsed[0][2]
+        return [
+            f'// Dispatcher of the EXTI {first}-{last} lines',
+            f'void ISR_{name}(void) {{',
+            '',
+            '    // Get pending flags of the enabled lines',
+            '    unsigned long flags = EXTI_PENDING;',
+            '',
+            '    // Dispatch lines',
+            f'    exti_dispatch(flags & ExtiLines({first}, {last}), exti_line_handlers);',
+            '}',
+        ]
+
+    body = [ ]
+    for kind, peripheral, details in parsed:
+
+        # EXTI lines
+        if kind == 'exti':
+            first, last = details
+            body += [
+                '',
+                f'// Dispatch pending EXTI lines',
+                f'exti_dispatch(EXTI_PENDING & ExtiLines({first}, {last}), exti_line_handlers);',
+            ]
+
+        # DMA channels (bit-scan over flags of channels with enabled interrupts)
+        elif kind == 'dma':
+            flags = f'{peripheral.lower()}_flags'
+            vectors = [ (f'ISR_{peripheral}_Channel{c}' if c in details else '0') for c in range(1, max(details) + 1) ]
+            body += [ '', f'#if defined({peripheral})', [
+                f'// Get pending flags of the {peripheral} channels with enabled interrupts',
+                f'unsigned long {flags} = {peripheral}->ISR & (',
+            ] + [
+                f'    DmaChannelEnabled({peripheral}, {c})' + (' |' if c != details[-1] else '')
+                for c in details
+            ] + [
+                ');',
+                f'// Dispatch channels (4 flags per channel)',
+                f'static const vector_function_ptr {peripheral.lower()}_vectors[] = {{ {", ".join(vectors)} }};',
+                f'isr_dispatch({flags}, 2, {peripheral.lower()}_vectors);',
+            ], '#endif' ]
+
+        # Overrun of the DMA request multiplexer
+        elif kind == 'dmamux':
+            body += [ '', f'#if defined({peripheral}_ChannelStatus)', [
+                f'// Dispatch overrun of the {peripheral}',
+                f'if({peripheral}_ChannelStatus->CSR | {peripheral}_RequestGenStatus->RGSR)',
+                f'    ISR_{peripheral}_OVR();',
+            ], '#endif' ]
+
+        # Timer (or selected events of the timer)
+        elif kind == 'tim':
+            mask = ' | '.join(TIM_EVENTS[event] for event in details) if len(details) > 0 else '0xFFUL'
+            events = ' '.join(details) + ' events of ' if len(details) > 0 else ''
+            body += [ '', f'#if defined({peripheral})', [
+                f'// Dispatch {events}{peripheral}',
+                f'if(TimPends({peripheral}, {mask}))',
+                f'    ISR_{"_".join((peripheral,) + details)}();',
+            ], '#endif' ]
+
+        # Low-power timer and touch sensing controller
+        elif kind in [ 'lptim', 'tsc' ]:
+            body += [ '', f'#if defined({peripheral})', [
+                f'// Dispatch {peripheral}',
+                f'if({peripheral}->ISR & {peripheral}->IER)',
+                f'    ISR_{peripheral}();',
+            ], '#endif' ]
+
+        # DMA underrun of the DAC (named either DAC1 or DAC depending on the device)
+        elif kind == 'dac':
+            body += [ '', '#if defined(DAC1)', [
+                f'// Dispatch DMA underrun of the DAC',
+                f'if(DacPends(DAC1))',
+                f'    ISR_DAC();',
+            ], '#elif defined(DAC)', [
+                f'// Dispatch DMA underrun of the DAC',
+                f'if(DacPends(DAC))',
+                f'    ISR_DAC();',
+            ], '#endif' ]
+
+    # Indent body (code of sources referring to peripherals is nested in preprocessor blocks as SVD files happen to list
+    # interrupts of peripherals that are not present on the device)
+    lines = [ ]
+    for entry in body:
+        if isinstance(entry, list):
+            lines += [ '        ' + line for line in entry ]
+        else:
+            lines.append(('    ' + entry) if entry else '')
+
+    # Handler of the legacy vector defined by the application replaces the dispatcher
+    if legacy is not None:
+        lines = [
+            '',
+            f'    // Call handler defined under the legacy name',
+            f'    if({legacy}) {{',
+            f'        {legacy}();',
+            f'        return;',
+            f'    }}',
+        ] + lines
+
+    return [
+        f'// Dispatcher of the {name} interrupt',
+        f'void ISR_{name}(void) {{',
+    ] + lines + [
+        '}',
+    ]
+
+
+def cmsis_mismatches(family, device, vectors):
+
+    """
+    Cross-checks @p vectors table of the @p device against IRQn_Type enumeration of its CMSIS header (if downloaded)
+
+    Returns
+    -------
+    (errors, warnings)
+        lists of interrupts given under other name or number than in the CMSIS header (errors) and interrupts given only
+        by one of sources (warnings, SVD files happen to describe the whole line of devices); None if the header is not
+        available
+    """
+
+    path = os.path.join(utils.memory.CMSIS_HOME, f'stm32{family}xx', f'{device.lower()}.h')
+    if not os.path.exists(path):
+        return None
+
+    # Parse interrupts (headers of dual-core devices list interrupts of all cores)
+    with open(path) as f:
+        cmsis = { }
+        for name, number in re.findall(r'^\s*(\w+)_IRQn\s*=\s*(\d+)', f.read(), re.M):
+            cmsis.setdefault(int(number), set()).add(name)
+
+    errors, warnings = [ ], [ ]
+    for number, name in enumerate(vectors):
+        if name is None and number in cmsis:
+            warnings.append(f'{device}: IRQ {number} ({"/".join(sorted(cmsis[number]))}) not given by the SVD file')
+        elif name is not None and number not in cmsis:
+            warnings.append(f'{device}: IRQ {number} ({name}) not given by the CMSIS header')
+        elif name is not None and name not in cmsis[number]:
+            errors.append(f'{device}: IRQ {number} named {name} while CMSIS names it {"/".join(sorted(cmsis[number]))}')
+    for number, names in cmsis.items():
+        for name in names:
+            if name in vectors and vectors.index(name) != number:
+                errors.append(f'{device}: {name} placed at IRQ {vectors.index(name)} while CMSIS places it at IRQ {number}')
+
+    return errors, warnings
+
+
+def declarations(names, macro):
+
+    """Formats declarations of vectors @p names with the @p macro"""
+
+    return [ f'{macro.ljust(len("ISR_VECTOR_DISPATCHER"))}({name});' for name in names ]
+
+
+def guarded(content, indices, groups):
+
+    """Wraps @p content in the preprocessor block selecting devices of @p groups with given @p indices"""
+
+    if len(indices) == len(groups):
+        return content
+    return [ utils.codegen.condition([ c for i in indices for c in groups[i]['conditions'] ]), '' ] + content + [ '', '#endif' ]
+
+# ============================================================== Script ============================================================ #
+
+# Check if all families are to be generated
+if 'all' in arguments.families:
+    arguments.families = utils.config.SUPPORTED_FAMILIES
+
+# Families whose tables failed checks
+failed = [ ]
+
+# Iterate over families
+for family in arguments.families:
+
+    utils.logger.info(f'Generating vectors for {family.capitalize()} family...')
+
+    # Map devices to SVD files
+    files, unsupported = utils.svd.family_svd_files(family)
+    if len(files) == 0:
+        utils.logger.error(f'No SVD files found for {family.capitalize()} family')
+        continue
+
+    # Group devices with the same vectors tables
+    groups, errors, warnings = [ ], [ ], [ ]
+    for path, conditions in files:
+
+        device = utils.svd.SvdDevice(path)
+
+        # Get core of the device
+        match = re.search(r'_(CM\w+)\.svd$', path)
+        core = match.group(1) if match is not None else FAMILY_CORES[family]
+
+        # Prepare vectors (the longest name is taken if interrupt is given under many names)
+        vectors = [ None ] * (max(device.interrupts) + 1)
+        for number, names in device.interrupts.items():
+            vectors[number] = vector_name(family, max(names, key=len))
+
+        # Check that names of vectors are unique
+        for name in sorted(set(name for name in vectors if name is not None and vectors.count(name) > 1)):
+            errors.append(f'{device.name}: {name} given for IRQs {", ".join(str(n) for n, v in enumerate(vectors) if v == name)}')
+
+        # Check vectors against CMSIS headers of devices
+        for condition in conditions:
+            result = cmsis_mismatches(family, re.search(r'defined\((STM32\w+)\)', condition).group(1), vectors)
+            if result is not None:
+                errors   += result[0]
+                warnings += result[1]
+
+        # Append device to the group
+        table = (tuple(exceptions(core)), tuple(vectors))
+        for group in groups:
+            if group['table'] == table:
+                group['conditions'] += conditions
+                break
+        else:
+            groups.append(dict(table=table, conditions=list(conditions)))
+
+    # Vectors given at different IRQs by devices of the family with the same core (valid for a few interrupts, e.g. I2C4_EV
+    # of STM32L4)
+    numbers = { }
+    for group in groups:
+        for number, name in enumerate(group['table'][1]):
+            if name is not None:
+                numbers.setdefault((group['table'][0], name), set()).add(number)
+    for (_, name), found in numbers.items():
+        if len(found) > 1:
+            warnings.append(f'{name} given for IRQs {", ".join(str(n) for n in sorted(found))} by devices of the family')
+
+    # Collect vectors (name -> indices of groups using the vector)
+    exception_vectors, interrupt_vectors = { }, { }
+    for index, group in enumerate(groups):
+        for name in group['table'][0]:
+            if name is not None:
+                exception_vectors.setdefault(name, [ ]).append(index)
+        for name in group['table'][1]:
+            if name is not None and index not in interrupt_vectors.setdefault(name, [ ]):
+                interrupt_vectors[name].append(index)
+
+    # Classify interrupt vectors
+    plain, exti_lines, exti_dispatchers, dispatchers, pseudo = [ ], { }, [ ], [ ], [ f'EXTI{line}' for line in range(16) ]
+    for name in interrupt_vectors:
+        line, parsed = dedicated_exti_line(name), dispatched(name)
+        if line is not None:
+            exti_lines[name] = line
+        elif parsed is None:
+            plain.append(name)
+        else:
+            if all(kind == 'exti' for kind, _, _ in parsed):
+                exti_dispatchers.append((name, parsed))
+            else:
+                dispatchers.append((name, parsed))
+            pseudo += [ vector for vector in pseudo_vectors(parsed) if vector not in pseudo ]
+
+    # Pseudo-vectors that are not real vectors of any device
+    pseudo = [ name for name in pseudo if name not in plain ]
+
+    # Check legacy vectors (only plain vectors and dispatchers of non-EXTI interrupts can be renamed)
+    legacy = LEGACY_VECTORS.get(family, { })
+    renamable = list(exception_vectors) + [ f'ISR_{name}' for name in plain ] + [ f'ISR_{name}' for name, _ in dispatchers ]
+    for old, new in legacy.items():
+        if old in exception_vectors or old[4:] in interrupt_vectors or old[4:] in pseudo:
+            errors.append(f'Legacy vector {old} is a vector of the family')
+        if new is not None and new not in renamable:
+            errors.append(f'Legacy vector {old} renamed to {new} that is not a plain vector nor a dispatcher of the family')
+        if new is not None and list(legacy.values()).count(new) > 1:
+            errors.append(f'Many legacy vectors renamed to {new}')
+
+    # Report problems (the file is not generated if any of checks failed)
+    for warning in warnings:
+        utils.logger.warning(warning)
+    for error in sorted(set(errors), key=errors.index):
+        utils.logger.error(error)
+    if len(errors) > 0:
+        utils.logger.error(f'Vectors for {family.capitalize()} family not generated')
+        failed.append(family)
+        continue
+
+    # Legacy names of vectors (current name -> legacy name)
+    renamed = { new: old for old, new in legacy.items() if new is not None }
+
+    # Name of the vector in the table
+    def table_entry(name):
+        if name is None:
+            return '0'
+        if name in exti_lines:
+            return f'ISR_EXTI{exti_lines[name]}_Dispatcher'
+        return f'ISR_{name}'
+
+    # Prepare content of the file (header is prepended once the content is known)
+    content = [
+        '',
+        utils.codegen.banner('Includes'),
+        '',
+        '#include "device.h"',
+        '#include "interrupts/definitions.h"',
+        '',
+        utils.codegen.banner('Definitions'),
+        '',
+        '/**',
+        ' * @note Names for SVC_Handler, PendSV_Handler and SysTick_Handler interrupt',
+        ' *    handlers was set differently to fit RTX-RTOSv5 naming scheme',
+        ' */',
+        '',
+        '// Exception vector\'s definitions',
+    ]
+    content += declarations([ name for name in exceptions('CM33') if name in exception_vectors and name not in renamed ], 'ISR_VECTOR')
+    content += [ '', '// ISR Vector\'s definitions' ]
+    content += declarations([ f'ISR_EXTI{line}_Dispatcher' for line in sorted(set(exti_lines.values())) ], 'ISR_VECTOR_FORCED')
+    content += declarations([ f'ISR_{name}' for name, _ in exti_dispatchers ], 'ISR_VECTOR_FORCED')
+    content += declarations([ f'ISR_{name}' for name, _ in dispatchers ], 'ISR_VECTOR_DISPATCHER')
+    content += declarations([ f'ISR_{name}' for name in plain if f'ISR_{name}' not in renamed ], 'ISR_VECTOR')
+
+    # Add legacy vectors
+    if len(legacy) > 0:
+        dispatched_names = [ f'ISR_{name}' for name, _ in dispatchers ]
+        content += [
+            '',
+            utils.codegen.banner('Legacy vectors'),
+            '',
+            '// Vectors under legacy names (handlers defined by the application under these names are called by default',
+            '// handlers of renamed vectors and replace dispatchers of renamed shared interrupts)',
+        ]
+        content += declarations([ old for old, new in legacy.items() if new not in dispatched_names ], 'ISR_VECTOR')
+        content += declarations([ old for old, new in legacy.items() if new in dispatched_names ], 'ISR_VECTOR_WEAK_REF')
+        content += [ '', '// Renamed vectors' ]
+        content += [ f'ISR_VECTOR_LEGACY({new}, {old})' for old, new in legacy.items() if new is not None and new not in dispatched_names ]
+
+    # Add pseudo-vectors
+    content += [
+        '',
+        utils.codegen.banner('Pseud-vectors'),
+        '',
+        '// Pseudo-ISR vectors',
+    ]
+    content += declarations([ f'ISR_{name}' for name in pseudo ], 'ISR_VECTOR')
+
+    # Add EXTI handlers
+    content += [
+        '',
+        utils.codegen.banner('Emulated vectors definitions'),
+        '',
+    ] + ([
+        '// Pending flags of the EXTI lines enabled for the current core',
+    ] + EXTI_PENDING.get(family, EXTI_PENDING_DEFAULT) + [
+        '',
+    ] if any(kind == 'exti' for _, parsed in exti_dispatchers + dispatchers for kind, _, _ in parsed) else [ ]) + [
+        '// Default handlers of the EXTI lines (indexed by line number)',
+        'const vector_function_ptr exti_default_handlers[16] = {',
+        ',\n'.join(f'    ISR_EXTI{line}' for line in range(16)),
+        '};',
+        '',
+        '// Handlers of the EXTI lines called by dispatchers (indexed by line number)',
+        'exti_line_handler exti_line_handlers[16] = {',
+        ',\n'.join(f'    EXTI_DEFAULT_LINE_HANDLER({line})' for line in range(16)),
+        '};',
+    ]
+
+    # Group dispatchers by devices using them (keeping the order of first appearance)
+    blocks = { }
+    for line in sorted(set(exti_lines.values())):
+        indices = sorted(set(i for name, l in exti_lines.items() if l == line for i in interrupt_vectors[name]))
+        blocks.setdefault(tuple(indices), [ ]).append(('line', line))
+    for name, parsed in exti_dispatchers + dispatchers:
+        blocks.setdefault(tuple(interrupt_vectors[name]), [ ]).append(('dispatcher', (name, parsed)))
+
+    # Add dispatchers
+    for indices, entries in blocks.items():
+        block = [ ]
+        lines = [ line for kind, line in entries if kind == 'line' ]
+        if len(lines) > 0:
+            block += [ '// Dispatchers of the EXTI lines with dedicated vectors' ]
+            block += [ f'ISR_EXTI_LINE_DISPATCHER({line})' for line in lines ]
+        for kind, entry in entries:
+            if kind == 'dispatcher':
+                block += ([ '' ] if len(block) > 0 else [ ]) + dispatcher(*entry, renamed.get(f'ISR_{entry[0]}'))
+        content += [ '' ] + guarded(block, indices, groups)
+
+    # Add vectors' tables
+    content += [
+        '',
+        utils.codegen.banner('Vectors\' table'),
+    ]
+    for index, group in enumerate(groups):
+
+        exceptions_table, interrupts_table = group['table']
+
+        # Open preprocessor block
+        content.append('')
+        if len(groups) > 1 or len(unsupported) > 0:
+            content += [ utils.codegen.condition(group['conditions'], '#if' if index == 0 else '#elif'), '' ]
+
+        content += [
+            'const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {',
+            '',
+            '    // Stack pointer',
+            '    (vector_function_ptr) (long) &_estack,',
+            '    // Reset handler',
+            '    reser_handler,',
+            '',
+            '    /* ----------------------------- Exception vectors ----------------------------- */',
+            '',
+        ] + [
+            f'    {name or 0},' for name in exceptions_table
+        ] + [
+            '',
+            '    /* ----------------------------- Interrupt vectors ----------------------------- */',
+            '',
+        ] + [
+            f'    {table_entry(name)},' for name in interrupts_table
+        ]
+        content[-1] = content[-1].rstrip(',')
+        content += [ '};' ]
+
+    # Close preprocessor block
+    if len(groups) > 1 or len(unsupported) > 0:
+        content += [
+            '',
+            '#else',
+            '#error "ISR vectors table is not defined for the target device"',
+            '#endif',
+        ]
+
+    content += [
+        '',
+        utils.codegen.banner(),
+        '',
+    ]
+
+    # Prepend the header (keeping dates of the existing file if its content has not changed)
+    path = os.path.join(OUTPUT_HOME, f'stm32{family}xx.c')
+    body = '\n'.join(content)
+    header = utils.codegen.file_header(f'stm32{family}xx.c',
+        f'Definitions of interrupt vectors for STM32{family.upper()}xx devices',
+        [ 'Generated by scripts/generate_vectors.py, do not edit' ] +
+        ([ f'Devices not described by SVD files: {", ".join(unsupported)}' ] if len(unsupported) > 0 else [ ]),
+        utils.codegen.header_dates(path, body)
+    )
+
+    # Write the file
+    with open(path, 'w') as f:
+        f.write('\n'.join(header) + '\n' + body)
+
+# Fail if tables of any family failed checks
+if len(failed) > 0:
+    exit(1)
+
+# ================================================================================================================================== #
@@ -0,0 +1,159 @@
+# ====================================================================================================================================
+# @file       isr_profiling.py
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Saturday, 17th October 2026 7:40:18 pm
+# @modified   Saturday, 17th October 2026 7:40:18 pm
+# @project    stm-utils
+# @brief      Prints statistics of interrupt handlers collected by the profiling trampoline (ISR_PROFILING option) from the
+#             RAM dump
+# @details    The dump can be either a raw binary image of RAM (e.g. produced with GDB's `dump binary memory` command) whose
+#    start address is given with --base option, or an ELF file (e.g. produced with GDB's `dump elf memory` or `gcore`).
+#    Durations are printed both as measured and with the trampoline's overhead (measured at startup) subtracted
+#
+# @copyright Krzysztof Pierczyk © 2026
+# ====================================================================================================================================
+
+import sys
+import os
+
+# ========================================================== Configuration ========================================================= #
+
+# Path to the main project's dircetory
+PROJECT_HOME = os.path.join(os.path.dirname(os.path.realpath(__file__)), '../../..')
+
+# Add python module to the PATH containing links definitions
+sys.path.append(os.path.join(PROJECT_HOME, 'scripts'))
+
+# ============================================================= Imports ============================================================ #
+
+import argparse
+import struct
+import rich.console
+import rich.table
+import utils
+
+# ========================================================== Configuration ========================================================= #
+
+# Names of symbols delimiting the profiling table
+TABLE_START_SYMBOL = '__isr_profiling_start'
+TABLE_END_SYMBOL   = '__isr_profiling_end'
+# Name of the symbol holding overhead of the trampoline
+OVERHEAD_SYMBOL = 'interrupts_profiling_overhead'
+
+# Layout of the table's entry (isr_profiling_entry)
+ENTRY_FORMAT = '<IIIIQ'
+
+# ============================================================= Options ============================================================ #
+
+# Create parser
+parser = argparse.ArgumentParser(description='Prints statistics of interrupt handlers collected by the profiling trampoline')
+
+# Application's ELF file (argument)
+parser.add_argument('elf', metavar='ELF', type=str,
+    help='ELF file of the application used to locate the profiling table')
+# RAM dump (argument)
+parser.add_argument('dump', metavar='DUMP', type=str,
+    help='RAM dump (either raw binary or ELF file)')
+
+# Start address of the raw binary dump (option)
+parser.add_argument('-b', '--base', type=lambda x: int(x, 0), dest='base', default=0x20000000,
+    help='Start address of the raw binary dump (default: 0x20000000)')
+# Core clock frequency (option)
+parser.add_argument('-f', '--frequency', type=int, dest='frequency', default=None,
+    help='Core clock frequency [Hz] used to convert cycles to time (default: cycles only)')
+# Whether to print vectors that have not been entered (option)
+parser.add_argument('-a', '--all', action='store_true', dest='all',
+    help='Print also vectors that have not been entered')
+
+# Parse options
+arguments = parser.parse_args()
+
+# ============================================================= Helpers ============================================================ #
+
+def read_dump(path, address, size):
+
+    """Reads @p size bytes at @p address from the RAM dump"""
+
+    # Read ELF dump
+    with open(path, 'rb') as f:
+        is_elf = (f.read(4) == b'\x7fELF')
+    if is_elf:
+        return utils.elf.ElfFile(path).read(address, size)
+
+    # Check if the address lies in the raw dump
+    if address < arguments.base:
+        return None
+
+    # Read raw dump
+    with open(path, 'rb') as f:
+        f.seek(address - arguments.base)
+        data = f.read(size)
+
+    return data if (len(data) == size) else None
+
+
+def cycles(value):
+
+    """Formats @p value given in cycles (along with the time if frequency is given)"""
+
+    if arguments.frequency is None:
+        return f'{value}'
+    return f'{value} ({value * 1e6 / arguments.frequency:.2f} us)'
+
+# ============================================================== Script ============================================================ #
+
+# Locate the table
+symbols = utils.elf.ElfFile(arguments.elf).symbols()
+if TABLE_START_SYMBOL not in symbols or symbols[TABLE_START_SYMBOL][0] == symbols[TABLE_END_SYMBOL][0]:
+    utils.logger.error(f'No profiling table found in {arguments.elf} (is ISR_PROFILING option enabled?)')
+    exit(1)
+start, end = symbols[TABLE_START_SYMBOL][0], symbols[TABLE_END_SYMBOL][0]
+
+# Read the table and the overhead
+data = read_dump(arguments.dump, start, end - start)
+overhead = read_dump(arguments.dump, symbols[OVERHEAD_SYMBOL][0], 4)
+if data is None or overhead is None:
+    utils.logger.error(f'Profiling table (0x{start:08X}) is not contained in the dump')
+    exit(1)
+overhead = struct.unpack('<I', overhead)[0]
+
+# Map addresses of functions to their names (Thumb bit cleared)
+functions = { address & ~1: name for name, (address, size) in symbols.items() if size > 0 }
+
+# Parse entries
+entries = [ ]
+for irqn, (handler, count, minimum, maximum, total) in enumerate(struct.iter_unpack(ENTRY_FORMAT, data)):
+    if handler != 0 and (count > 0 or arguments.all):
+        entries.append((irqn, functions.get(handler & ~1, f'0x{handler:08X}'), count, minimum, maximum, total))
+
+# Prepare table
+table = rich.table.Table(title=f'Interrupts\' statistics (trampoline overhead: {overhead} cycles)')
+table.add_column('IRQn',     justify='right')
+table.add_column('Handler')
+table.add_column('Entries',  justify='right')
+table.add_column('Min',      justify='right')
+table.add_column('Avg',      justify='right')
+table.add_column('Max',      justify='right')
+table.add_column('Total',    justify='right')
+table.add_column('Net total', justify='right')
+table.add_column('Share [%]', justify='right')
+
+# Fill table (the most expensive handlers first)
+grand_total = sum(entry[5] for entry in entries)
+for irqn, name, count, minimum, maximum, total in sorted(entries, key=lambda e: e[5], reverse=True):
+    table.add_row(
+        f'{irqn}',
+        name,
+        f'{count}',
+        cycles(minimum),
+        cycles(total // count) if count else '-',
+        cycles(maximum),
+        cycles(total),
+        cycles(max(total - count * overhead, 0)),
+        f'{total * 100 / grand_total:.1f}' if grand_total else '-',
+    )
+
+rich.console.Console().print(table)
+
+# ================================================================================================================================== #
@@ -0,0 +1,182 @@
+/* ============================================================================================================================= *//**
+ * @file       deferred.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 8:57:22 pm
+ * @modified   Saturday, 17th October 2026 8:57:22 pm
+ * @project    stm-utils
+ * @brief      Queue of work deferred by ISRs to the lowest-priority context (DEFERRED_WORK option)
+ * @details    Posted items are pushed onto a singly linked stack with exclusive accesses (LDREX/STREX) so that producers
+ *    never block each other. The consumer detaches the whole stack at once and reverses it to restore the posting order.
+ *    ARMv6-M cores lack exclusive accesses and use short critical sections instead.
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "device.h"
+#include "device/deferred.h"
+#include "interrupts/definitions.h"
+
+/* ========================================================= Configuration ======================================================== */
+
+// Exclusive accesses are available on ARMv7-M and ARMv8-M cores
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8M_BASE__)
+#define DEFERRED_WORK_EXCLUSIVE
+#endif
+
+/* ======================================================= Static variables ======================================================= */
+
+// Top of the stack of posted items (the most recently posted one)
+static deferred_work *volatile posted = 0;
+
+/* ====================================================== Static definitions ====================================================== */
+
+/**
+ * @brief Marks @p work as pending
+ * @returns
+ *    false if @p work has been pending already
+ */
+static inline bool work_claim(deferred_work *work) {
+
+    #ifdef DEFERRED_WORK_EXCLUSIVE
+
+        do {
+            if(__LDREXW((volatile uint32_t *) &work->pending) != 0) {
+                __CLREX();
+                return false;
+            }
+        } while(__STREXW(1, (volatile uint32_t *) &work->pending) != 0);
+        return true;
+
+    #else
+
+        unsigned long primask = __get_PRIMASK();
+        __disable_irq();
+        bool claimed = (work->pending == 0);
+        work->pending = 1;
+        __set_PRIMASK(primask);
+        return claimed;
+
+    #endif
+}
+
+
+/**
+ * @brief Pushes @p work onto the stack of posted items
+ */
+static inline void work_push(deferred_work *work) {
+
+    #ifdef DEFERRED_WORK_EXCLUSIVE
+
+        do {
+            work->next = (deferred_work *) __LDREXW((volatile uint32_t *) &posted);
+        } while(__STREXW((uint32_t) work, (volatile uint32_t *) &posted) != 0);
+
+    #else
+
+        unsigned long primask = __get_PRIMASK();
+        __disable_irq();
+        work->next = posted;
+        posted = work;
+        __set_PRIMASK(primask);
+
+    #endif
+}
+
+
+/**
+ * @brief Detaches all posted items
+ * @returns
+ *    top of the stack of posted items (the most recently posted one)
+ */
+static inline deferred_work *work_take(void) {
+
+    #ifdef DEFERRED_WORK_EXCLUSIVE
+
+        deferred_work *top;
+        do {
+            top = (deferred_work *) __LDREXW((volatile uint32_t *) &posted);
+        } while(__STREXW(0, (volatile uint32_t *) &posted) != 0);
+        return top;
+
+    #else
+
+        unsigned long primask = __get_PRIMASK();
+        __disable_irq();
+        deferred_work *top = posted;
+        posted = 0;
+        __set_PRIMASK(primask);
+        return top;
+
+    #endif
+}
+
+/* ========================================================== Definitions ========================================================= */
+
+bool deferred_work_post(deferred_work *work) {
+
+    // Coalesce posts of the pending item
+    if(!work_claim(work))
+        return false;
+
+    work_push(work);
+
+    // Request draining
+    #ifdef STM_UTILS_DEFERRED_WORK_RTOS
+        deferred_work_notify();
+    #else
+        SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    #endif
+
+    return true;
+}
+
+
+void deferred_work_drain(void) {
+
+    deferred_work *top;
+    while((top = work_take()) != 0) {
+
+        // Reverse the stack to execute items in the posting order
+        deferred_work *queue = 0;
+        while(top != 0) {
+            deferred_work *next = top->next;
+            top->next = queue;
+            queue = top;
+            top = next;
+        }
+
+        // Execute items (item is released before its handler is called so that it can be posted again meanwhile)
+        while(queue != 0) {
+            deferred_work *work = queue;
+            queue = work->next;
+            work->pending = 0;
+            work->handler(work->context);
+        }
+    }
+}
+
+
+__attribute__((weak)) void deferred_work_notify(void) { }
+
+#ifndef STM_UTILS_DEFERRED_WORK_RTOS
+
+/**
+ * @brief Sets PendSV to the lowest priority so that deferred work never delays other interrupts
+ */
+void deferred_work_init(void) {
+    NVIC_SetPriority(PendSV_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL);
+}
+
+
+// PendSV handler (overrides the weak vector of the family)
+ISR_VECTOR_FORCED(PendSV_Handler);
+void PendSV_Handler(void) {
+    deferred_work_drain();
+}
+
+#endif
+
+/* ================================================================================================================================ */
@@ -0,0 +1,44 @@
+/* ============================================================================================================================= *//**
+ * @file       exti.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 3:48:30 pm
+ * @modified   Saturday, 17th October 2026 3:48:30 pm
+ * @project    stm-utils
+ * @brief      Runtime registration of the EXTI lines' handlers called by EXTI dispatchers
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "device.h"
+
+/* ========================================================= Declarations ========================================================= */
+
+// Default handlers of the EXTI lines (defined along with EXTI dispatchers of the device family)
+extern const vector_function_ptr exti_default_handlers[16];
+
+/* ========================================================== Definitions ========================================================= */
+
+void exti_register_line_handler(unsigned line, exti_line_handler_ptr handler, void *context) {
+
+    // Reject lines that are not dispatched
+    if(line >= 16)
+        return;
+
+    // Restore default handler if none given
+    if(handler == 0) {
+        handler = (exti_line_handler_ptr) exti_default_handlers[line];
+        context = 0;
+    }
+
+    // Replace the entry atomically with respect to dispatchers
+    unsigned long primask = __get_PRIMASK();
+    __disable_irq();
+    exti_line_handlers[line].handler = handler;
+    exti_line_handlers[line].context = context;
+    __set_PRIMASK(primask);
+}
+
+/* ================================================================================================================================ */
@@ -1,46 +1,48 @@
 /* ============================================================================================================================= *//**
- * @file       stm32g0xx.cpp
+ * @file       interrupts.cpp
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
- * @date       Tuesday, 6th July 2021 1:51:11 pm
- * @modified   Tuesday, 6th July 2021 1:51:11 pm
+ * @date       Saturday, 17th October 2026 5:24:03 pm
+ * @modified   Saturday, 17th October 2026 5:24:03 pm
  * @project    stm-utils
- * @brief      Interrupt vectors' definitions for STMG0xx devices
- *    
- * @copyright Krzysztof Pierczyk © 2022
+ * @brief      Runtime lookups of interrupt lines built on top of the device traits
+ *
+ * @copyright Krzysztof Pierczyk © 2026
  * /// ============================================================================================================================ */
 
 /* =========================================================== Includes =========================================================== */
 
+// Standard includes
+#include <array>
+#include <utility>
 // System includes
 #include "device/interrupts.h"
 
 /* ======================================================= Helper functions ======================================================= */
 
+namespace {
+
+/// Marker of the EXTI line not present on the device
+constexpr IRQn_Type INVALID_IRQN = static_cast<IRQn_Type>(0xFFFFFFFF);
+
+/// Builds table of interrupt lines used by EXTI lines
+template<std::size_t... lines>
+constexpr std::array<IRQn_Type, sizeof...(lines)> make_exti_lines_table(std::index_sequence<lines...>) {
+    return {{ [] {
+        if constexpr (device::traits::exti_line<lines>::valid)
+            return device::traits::exti_line<lines>::irqn;
+        else
+            return INVALID_IRQN;
+    }()... }};
+}
+
+/// Interrupt lines used by EXTI lines
+constexpr auto exti_lines_irqn = make_exti_lines_table(std::make_index_sequence<16>{ });
+
+}
+
 extern "C" IRQn_Type get_exti_line_irqn(unsigned index) {
-    switch(index) {
-        case 0:
-        case 1:
-            return EXTI0_1_IRQn;
-        case 2:
-        case 3:
-            return EXTI2_3_IRQn;
-        case 4:
-        case 5:
-        case 6:
-        case 7:
-        case 8:
-        case 9:
-        case 10:
-        case 11:
-        case 12:
-        case 13:
-        case 14:
-        case 15:
-            return EXTI15_4_IRQn;
-        default:
-            return (IRQn_Type) 0xFFFFFFFF;
-    }
+    return (index < exti_lines_irqn.size()) ? exti_lines_irqn[index] : INVALID_IRQN;
 }
 
 /* =========================================================== Namespace ========================================================== */
@@ -50,29 +52,9 @@ namespace device {
 /* ======================================================= Helper functions ======================================================= */
 
 std::optional<IRQn_Type> get_exti_line_irqn(unsigned index) {
-    switch(index) {
-        case 0:
-        case 1:
-            return EXTI0_1_IRQn;
-        case 2:
-        case 3:
-            return EXTI2_3_IRQn;
-        case 4:
-        case 5:
-        case 6:
-        case 7:
-        case 8:
-        case 9:
-        case 10:
-        case 11:
-        case 12:
-        case 13:
-        case 14:
-        case 15:
-            return EXTI4_15_IRQn;
-        default:
-            return std::optional<IRQn_Type>{ };
-    }
+    if(index >= exti_lines_irqn.size() || exti_lines_irqn[index] == INVALID_IRQN)
+        return std::optional<IRQn_Type>{ };
+    return exti_lines_irqn[index];
 }
 
 /* ================================================================================================================================ */
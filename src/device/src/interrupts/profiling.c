@@ -0,0 +1,177 @@
+/* ============================================================================================================================= *//**
+ * @file       profiling.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 7:12:44 pm
+ * @modified   Saturday, 17th October 2026 7:12:44 pm
+ * @project    stm-utils
+ * @brief      Per-vector statistics of interrupt handlers (ISR_PROFILING option)
+ * @details    All interrupt entries of the RAM copy of the ISR vectors table are redirected to a common trampoline which
+ *    resolves the active vector from IPSR, calls the original handler and updates the vector's entry of the profiling
+ *    table (`__isr_profiling_start` to `__isr_profiling_end`, reserved by the linker script). System exceptions are not
+ *    profiled as RTOS handlers (SVC, PendSV) depend on the exception frame seen at entry.
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "device.h"
+#include "ram_vectors.h"
+
+/* ========================================================= Configuration ======================================================== */
+
+// Cycles are counted with DWT where available and with SysTick otherwise (valid for handlers shorter than the SysTick period)
+#if defined(DWT_CTRL_CYCCNTENA_Msk) && defined(CoreDebug_DEMCR_TRCENA_Msk)
+#define ISR_PROFILING_DWT
+#endif
+
+// Size of the entry is used by the linker script to reserve the table
+_Static_assert(sizeof(isr_profiling_entry) == 24, "Size of isr_profiling_entry does not match isr_profiling_entry_size (link.ld)");
+
+/* ========================================================= Declarations ========================================================= */
+
+// Start of the profiling table (defined in linker script)
+extern isr_profiling_entry __isr_profiling_start[];
+// End of the profiling table (defined in linker script)
+extern isr_profiling_entry __isr_profiling_end[];
+
+/* ======================================================= Global variables ======================================================= */
+
+unsigned long interrupts_profiling_overhead;
+
+/* ====================================================== Static definitions ====================================================== */
+
+/**
+ * @returns
+ *    current value of the cycles counter
+ */
+static inline __attribute__((always_inline)) unsigned long profiling_counter(void) {
+    #ifdef ISR_PROFILING_DWT
+        return DWT->CYCCNT;
+    #else
+        return SysTick->VAL;
+    #endif
+}
+
+
+/**
+ * @returns
+ *    number of cycles elapsed since the @p start value of the counter
+ */
+static inline __attribute__((always_inline)) unsigned long profiling_elapsed(unsigned long start) {
+    #ifdef ISR_PROFILING_DWT
+        return DWT->CYCCNT - start;
+    #else
+        unsigned long now = SysTick->VAL;
+        return (start >= now) ? (start - now) : (start + SysTick->LOAD + 1 - now);
+    #endif
+}
+
+
+/**
+ * @brief Calls handler of the @p entry and accounts its duration
+ */
+static inline __attribute__((always_inline)) void profiling_call(isr_profiling_entry *entry) {
+
+    // Run the handler
+    unsigned long start = profiling_counter();
+    entry->handler();
+    unsigned long cycles = profiling_elapsed(start);
+
+    // Update statistics (entry is never updated concurrently as the vector cannot preempt itself)
+    if(entry->count++ == 0 || cycles < entry->min)
+        entry->min = cycles;
+    if(cycles > entry->max)
+        entry->max = cycles;
+    entry->total += cycles;
+}
+
+
+/**
+ * @brief Common handler of all profiled interrupt vectors
+ */
+static void profiling_trampoline(void) {
+    profiling_call(&__isr_profiling_start[__get_IPSR() - 16]);
+}
+
+
+/**
+ * @brief Empty handler used to measure overhead of the profiling
+ */
+static void __attribute__((noinline)) profiling_calibration_handler(void) {
+    __asm volatile("");
+}
+
+/* ========================================================== Definitions ========================================================= */
+
+void interrupts_profiling_init(void) {
+
+    // Enable DWT cycles counter (if not started by the boot timing)
+    #ifdef ISR_PROFILING_DWT
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        #if (__CORTEX_M == 7U)
+            DWT->LAR = 0xC5ACCE55UL;
+        #endif
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    #endif
+
+    // Measure cost of the accounting around an empty handler (dispatch of the trampoline precedes the measured window and
+    // so it is not included)
+    isr_profiling_entry calibration = { .handler = profiling_calibration_handler };
+    profiling_call(&calibration);
+    interrupts_profiling_overhead = calibration.min;
+
+    // Move handlers of interrupts to the profiling table and redirect vectors to the trampoline
+    vector_function_ptr *vector = &__ram_vectors_start[16];
+    for(isr_profiling_entry *entry = __isr_profiling_start; entry < __isr_profiling_end; ++entry, ++vector) {
+        *entry = (isr_profiling_entry) { .handler = *vector };
+        if(*vector != 0)
+            *vector = profiling_trampoline;
+    }
+
+    // Make sure that the table is written before the next vector fetch
+    __DSB();
+}
+
+
+vector_function_ptr interrupts_profiling_install_handler(IRQn_Type irqn, vector_function_ptr handler) {
+
+    // Reject interrupts that are not present in the tables
+    if(!ram_vectors_contain(irqn) || (int) irqn < 0 || &__isr_profiling_start[irqn] >= __isr_profiling_end)
+        return 0;
+
+    // Swap handlers
+    vector_function_ptr previous = __isr_profiling_start[irqn].handler;
+    __isr_profiling_start[irqn].handler = handler;
+
+    // Route vector through the trampoline (the entry could have been empty so far)
+    __ram_vectors_start[16 + (int) irqn] = profiling_trampoline;
+    __DSB();
+
+    return previous;
+}
+
+
+const isr_profiling_entry *interrupts_profiling_entry(IRQn_Type irqn) {
+    if((int) irqn < 0 || &__isr_profiling_start[irqn] >= __isr_profiling_end)
+        return 0;
+    return &__isr_profiling_start[irqn];
+}
+
+
+void interrupts_profiling_reset(void) {
+    for(isr_profiling_entry *entry = __isr_profiling_start; entry < __isr_profiling_end; ++entry) {
+
+        // Clear statistics atomically with respect to the trampoline
+        unsigned long primask = __get_PRIMASK();
+        __disable_irq();
+        entry->count = 0;
+        entry->min   = 0;
+        entry->max   = 0;
+        entry->total = 0;
+        __set_PRIMASK(primask);
+    }
+}
+
+/* ================================================================================================================================ */
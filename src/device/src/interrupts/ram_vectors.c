@@ -0,0 +1,45 @@
+/* ============================================================================================================================= *//**
+ * @file       ram_vectors.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 3:05:12 pm
+ * @modified   Saturday, 17th October 2026 3:05:12 pm
+ * @project    stm-utils
+ * @brief      Runtime registration of interrupt handlers in the RAM copy of the ISR vectors table (RAM_VECTOR_TABLE option)
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "device.h"
+#include "ram_vectors.h"
+
+/* ========================================================== Definitions ========================================================= */
+
+vector_function_ptr interrupts_install_handler(IRQn_Type irqn, vector_function_ptr handler) {
+
+    // Reject vectors that are not present in the table
+    if(!ram_vectors_contain(irqn))
+        return 0;
+
+    // Profiled interrupts are called by the trampoline
+    #ifdef STM_UTILS_ISR_PROFILING
+        if((int) irqn >= 0)
+            return interrupts_profiling_install_handler(irqn, handler);
+    #endif
+
+    // Get the vector's entry (interrupt vectors follow 16 entries of the system exceptions)
+    vector_function_ptr *entry = &__ram_vectors_start[16 + (int) irqn];
+
+    // Swap handlers
+    vector_function_ptr previous = *entry;
+    *entry = handler;
+
+    // Make sure that the entry is written before the next vector fetch
+    __DSB();
+
+    return previous;
+}
+
+/* ================================================================================================================================ */
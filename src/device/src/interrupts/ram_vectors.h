@@ -0,0 +1,44 @@
+/* ============================================================================================================================= *//**
+ * @file       ram_vectors.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 3:05:12 pm
+ * @modified   Saturday, 17th October 2026 3:05:12 pm
+ * @project    stm-utils
+ * @brief      Private declarations of the RAM copy of the ISR vectors table (RAM_VECTOR_TABLE and ISR_PROFILING options)
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_INTERRUPTS_RAM_VECTORS_H__
+#define __STM_UTILS_INTERRUPTS_RAM_VECTORS_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include <stdbool.h>
+#include "device.h"
+
+/* ========================================================= Declarations ========================================================= */
+
+// Start of the RAM copy of the ISR vectors table (defined in linker script)
+extern vector_function_ptr __ram_vectors_start[];
+// End of the RAM copy of the ISR vectors table (defined in linker script)
+extern vector_function_ptr __ram_vectors_end[];
+
+// Installs handler called by the profiling trampoline (ISR_PROFILING option)
+extern vector_function_ptr interrupts_profiling_install_handler(IRQn_Type irqn, vector_function_ptr handler);
+
+/* ========================================================== Definitions ========================================================= */
+
+/**
+ * @returns 
+ *    @c true if the @p irqn has its entry in the RAM copy of the ISR vectors table \n
+ *    @c false otherwise
+ */
+static inline bool ram_vectors_contain(IRQn_Type irqn) {
+    return ((int) irqn >= -16) && ((int) irqn < (__ram_vectors_end - __ram_vectors_start) - 16);
+}
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,224 @@
+/* ============================================================================================================================= *//**
+ * @file       throttle.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 9:48:05 pm
+ * @modified   Saturday, 17th October 2026 9:48:05 pm
+ * @project    stm-utils
+ * @brief      Rate bounding of interrupt sources (ISR_THROTTLING option)
+ * @details    Each throttled source handles at most `budget` events per window. The event exhausting the budget masks the
+ *    source (EXTI line in the EXTI's mask register, other interrupts in NVIC) and the source is re-armed when the window
+ *    is closed by interrupts_throttle_tick(). Events arriving in the meantime stay pending in the peripheral and so they
+ *    are coalesced into a single interrupt after re-arming, which bounds the worst-case load of the storming source.
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "device.h"
+
+/* ========================================================= Configuration ======================================================== */
+
+// Mask and pending registers of the EXTI lines of the current core
+#if defined(STM32MCU_MAJOR_TYPE_G0) || defined(STM32MCU_MAJOR_TYPE_L5)
+#define EXTI_MASK    (EXTI->IMR1)
+#define EXTI_PENDING (EXTI->RPR1 | EXTI->FPR1)
+#elif defined(STM32MCU_MAJOR_TYPE_G4) || defined(STM32MCU_MAJOR_TYPE_L4)
+#define EXTI_MASK    (EXTI->IMR1)
+#define EXTI_PENDING (EXTI->PR1)
+#elif defined(STM32MCU_MAJOR_TYPE_H7) && defined(CORE_CM4)
+#define EXTI_MASK    (EXTI_D2->IMR1)
+#define EXTI_PENDING (EXTI_D2->PR1)
+#elif defined(STM32MCU_MAJOR_TYPE_H7)
+#define EXTI_MASK    (EXTI_D1->IMR1)
+#define EXTI_PENDING (EXTI_D1->PR1)
+#elif defined(STM32MCU_MAJOR_TYPE_WL) && defined(CORE_CM0PLUS)
+#define EXTI_MASK    (EXTI->C2IMR1)
+#define EXTI_PENDING (EXTI->PR1)
+#elif defined(STM32MCU_MAJOR_TYPE_WB) || defined(STM32MCU_MAJOR_TYPE_WL)
+#define EXTI_MASK    (EXTI->IMR1)
+#define EXTI_PENDING (EXTI->PR1)
+#else
+#define EXTI_MASK    (EXTI->IMR)
+#define EXTI_PENDING (EXTI->PR)
+#endif
+
+/* ======================================================= Static variables ======================================================= */
+
+// List of attached throttles
+static isr_throttle *throttles = 0;
+
+/* ====================================================== Static definitions ====================================================== */
+
+/**
+ * @brief Masks source of the @p throttle
+ */
+static inline void throttle_mask(isr_throttle *throttle) {
+    if(throttle->exti)
+        EXTI_MASK &= ~(1UL << throttle->source);
+    else
+        NVIC_DisableIRQ((IRQn_Type) throttle->source);
+}
+
+
+/**
+ * @brief Unmasks source of the @p throttle
+ * @returns
+ *    true if an event is pending on the source
+ */
+static inline bool throttle_unmask(isr_throttle *throttle) {
+
+    bool pending;
+
+    if(throttle->exti) {
+        pending = (EXTI_PENDING & (1UL << throttle->source)) != 0;
+        EXTI_MASK |= (1UL << throttle->source);
+    } else {
+        pending = NVIC_GetPendingIRQ((IRQn_Type) throttle->source) != 0;
+        NVIC_EnableIRQ((IRQn_Type) throttle->source);
+    }
+
+    return pending;
+}
+
+
+/**
+ * @brief Adds @p throttle to the list of attached throttles (if not attached yet) and resets its state
+ * @note Has to be called with interrupts disabled
+ */
+static inline void throttle_link(isr_throttle *throttle) {
+
+    // Check whether the throttle is attached already
+    isr_throttle *current = throttles;
+    while(current != 0 && current != throttle)
+        current = current->next;
+
+    // Link the throttle
+    if(current == 0) {
+        throttle->next = throttles;
+        throttles = throttle;
+    }
+
+    // Reset state
+    throttle->masked    = 0;
+    throttle->events    = 0;
+    throttle->handled   = 0;
+    throttle->throttled = 0;
+    throttle->coalesced = 0;
+}
+
+
+/**
+ * @brief Handler of the throttled EXTI line (called by EXTI dispatchers)
+ */
+static void throttle_exti_handler(void *context) {
+
+    isr_throttle *throttle = (isr_throttle *) context;
+
+    throttle->line.handler(throttle->line.context);
+    interrupts_throttle_event(throttle);
+}
+
+/* ========================================================== Definitions ========================================================= */
+
+void exti_register_throttled_line_handler(unsigned line, exti_line_handler_ptr handler, void *context, isr_throttle *throttle) {
+
+    // Reject lines that are not dispatched
+    if(line >= 16)
+        return;
+
+    unsigned long primask = __get_PRIMASK();
+    __disable_irq();
+
+    // Attach the throttle
+    throttle->source       = (int16_t) line;
+    throttle->exti         = 1;
+    throttle->line.handler = handler;
+    throttle->line.context = context;
+    throttle_link(throttle);
+
+    // Route the line through the throttle
+    exti_line_handlers[line].handler = throttle_exti_handler;
+    exti_line_handlers[line].context = throttle;
+
+    __set_PRIMASK(primask);
+}
+
+
+void interrupts_throttle_attach(IRQn_Type irqn, isr_throttle *throttle) {
+
+    unsigned long primask = __get_PRIMASK();
+    __disable_irq();
+
+    // Attach the throttle
+    throttle->source = (int16_t) irqn;
+    throttle->exti   = 0;
+    throttle_link(throttle);
+
+    __set_PRIMASK(primask);
+}
+
+
+void interrupts_throttle_detach(isr_throttle *throttle) {
+
+    unsigned long primask = __get_PRIMASK();
+    __disable_irq();
+
+    // Unlink the throttle
+    isr_throttle **current = &throttles;
+    while(*current != 0 && *current != throttle)
+        current = &(*current)->next;
+    if(*current != 0)
+        *current = throttle->next;
+
+    // Re-arm the source
+    if(throttle->masked) {
+        throttle->masked = 0;
+        throttle_unmask(throttle);
+    }
+
+    __set_PRIMASK(primask);
+}
+
+
+void interrupts_throttle_event(isr_throttle *throttle) {
+
+    unsigned long primask = __get_PRIMASK();
+    __disable_irq();
+
+    throttle->handled++;
+
+    // Mask the source if the budget is exhausted
+    if(++throttle->events >= throttle->budget && !throttle->masked) {
+        throttle->masked = 1;
+        throttle->throttled++;
+        throttle_mask(throttle);
+    }
+
+    __set_PRIMASK(primask);
+}
+
+
+void interrupts_throttle_tick(void) {
+
+    for(isr_throttle *throttle = throttles; throttle != 0; throttle = throttle->next) {
+
+        unsigned long primask = __get_PRIMASK();
+        __disable_irq();
+
+        // Open the new window
+        throttle->events = 0;
+
+        // Re-arm the source (events pending since masking are handled once)
+        if(throttle->masked) {
+            throttle->masked = 0;
+            if(throttle_unmask(throttle))
+                throttle->coalesced++;
+        }
+
+        __set_PRIMASK(primask);
+    }
+}
+
+/* ================================================================================================================================ */
@@ -2,12 +2,14 @@
  * @file       stm32f0xx.c
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
- * @date       Thursday, 15th July 2021 10:14:58 am
- * @modified   Thursday, 15th July 2021 10:36:56 am
+ * @date       Saturday, 17th October 2026 9:58:22 pm
+ * @modified   Saturday, 17th October 2026 9:58:22 pm
  * @project    stm-utils
- * @brief      Definitions of interrupt vectors for STMF0xx devices
- *    
- * @copyright Krzysztof Pierczyk © 2022
+ * @brief      Definitions of interrupt vectors for STM32F0xx devices
+ *
+ * @note Generated by scripts/generate_vectors.py, do not edit
+ *
+ * @copyright Krzysztof Pierczyk © 2026
  * /// ============================================================================================================================ */
 
 /* =========================================================== Includes =========================================================== */
@@ -17,6 +19,504 @@
 
 /* ========================================================== Definitions ========================================================= */
 
+/**
+ * @note Names for SVC_Handler, PendSV_Handler and SysTick_Handler interrupt
+ *    handlers was set differently to fit RTX-RTOSv5 naming scheme
+ */
 
+// Exception vector's definitions
+ISR_VECTOR           (EXC_NMI);
+ISR_VECTOR           (EXC_HardFault);
+ISR_VECTOR           (SVC_Handler);
+ISR_VECTOR           (PendSV_Handler);
+ISR_VECTOR           (SysTick_Handler);
+
+// ISR Vector's definitions
+ISR_VECTOR_FORCED    (ISR_EXTI0_1);
+ISR_VECTOR_FORCED    (ISR_EXTI2_3);
+ISR_VECTOR_FORCED    (ISR_EXTI4_15);
+ISR_VECTOR_DISPATCHER(ISR_DMA1_Channel2_3);
+ISR_VECTOR_DISPATCHER(ISR_DMA1_Channel4_5);
+ISR_VECTOR_DISPATCHER(ISR_DMA1_Ch2_3_DMA2_Ch1_2);
+ISR_VECTOR_DISPATCHER(ISR_DMA1_Ch4_7_DMA2_Ch3_5);
+ISR_VECTOR_DISPATCHER(ISR_TIM6_DAC);
+ISR_VECTOR_DISPATCHER(ISR_DMA1_Channel4_5_6_7);
+ISR_VECTOR           (ISR_WWDG);
+ISR_VECTOR           (ISR_PVD);
+ISR_VECTOR           (ISR_RTC);
+ISR_VECTOR           (ISR_FLASH);
+ISR_VECTOR           (ISR_RCC);
+ISR_VECTOR           (ISR_DMA1_Channel1);
+ISR_VECTOR           (ISR_ADC);
+ISR_VECTOR           (ISR_TIM1_BRK_UP_TRG_COM);
+ISR_VECTOR           (ISR_TIM1_CC);
+ISR_VECTOR           (ISR_TIM3);
+ISR_VECTOR           (ISR_TIM6);
+ISR_VECTOR           (ISR_TIM14);
+ISR_VECTOR           (ISR_TIM15);
+ISR_VECTOR           (ISR_TIM16);
+ISR_VECTOR           (ISR_TIM17);
+ISR_VECTOR           (ISR_I2C1);
+ISR_VECTOR           (ISR_I2C2);
+ISR_VECTOR           (ISR_SPI1);
+ISR_VECTOR           (ISR_SPI2);
+ISR_VECTOR           (ISR_USART1);
+ISR_VECTOR           (ISR_USART2);
+ISR_VECTOR           (ISR_USART3_4_5_6);
+ISR_VECTOR           (ISR_USB);
+ISR_VECTOR           (ISR_RCC_CRS);
+ISR_VECTOR           (ISR_TSC);
+ISR_VECTOR           (ISR_ADC_COMP);
+ISR_VECTOR           (ISR_TIM2);
+ISR_VECTOR           (ISR_TIM7);
+ISR_VECTOR           (ISR_USART3_8);
+ISR_VECTOR           (ISR_CEC_CAN);
+ISR_VECTOR           (ISR_USART3_4);
+
+/* ========================================================= Pseud-vectors ======================================================== */
+
+// Pseudo-ISR vectors
+ISR_VECTOR           (ISR_EXTI0);
+ISR_VECTOR           (ISR_EXTI1);
+ISR_VECTOR           (ISR_EXTI2);
+ISR_VECTOR           (ISR_EXTI3);
+ISR_VECTOR           (ISR_EXTI4);
+ISR_VECTOR           (ISR_EXTI5);
+ISR_VECTOR           (ISR_EXTI6);
+ISR_VECTOR           (ISR_EXTI7);
+ISR_VECTOR           (ISR_EXTI8);
+ISR_VECTOR           (ISR_EXTI9);
+ISR_VECTOR           (ISR_EXTI10);
+ISR_VECTOR           (ISR_EXTI11);
+ISR_VECTOR           (ISR_EXTI12);
+ISR_VECTOR           (ISR_EXTI13);
+ISR_VECTOR           (ISR_EXTI14);
+ISR_VECTOR           (ISR_EXTI15);
+ISR_VECTOR           (ISR_DMA1_Channel2);
+ISR_VECTOR           (ISR_DMA1_Channel3);
+ISR_VECTOR           (ISR_DMA1_Channel4);
+ISR_VECTOR           (ISR_DMA1_Channel5);
+ISR_VECTOR           (ISR_DMA2_Channel1);
+ISR_VECTOR           (ISR_DMA2_Channel2);
+ISR_VECTOR           (ISR_DMA1_Channel6);
+ISR_VECTOR           (ISR_DMA1_Channel7);
+ISR_VECTOR           (ISR_DMA2_Channel3);
+ISR_VECTOR           (ISR_DMA2_Channel4);
+ISR_VECTOR           (ISR_DMA2_Channel5);
+ISR_VECTOR           (ISR_DAC);
+
+/* ================================================= Emulated vectors definitions ================================================= */
+
+// Pending flags of the EXTI lines enabled for the current core
+#define EXTI_PENDING (EXTI->PR & EXTI->IMR)
+
+// Default handlers of the EXTI lines (indexed by line number)
+const vector_function_ptr exti_default_handlers[16] = {
+    ISR_EXTI0,
+    ISR_EXTI1,
+    ISR_EXTI2,
+    ISR_EXTI3,
+    ISR_EXTI4,
+    ISR_EXTI5,
+    ISR_EXTI6,
+    ISR_EXTI7,
+    ISR_EXTI8,
+    ISR_EXTI9,
+    ISR_EXTI10,
+    ISR_EXTI11,
+    ISR_EXTI12,
+    ISR_EXTI13,
+    ISR_EXTI14,
+    ISR_EXTI15
+};
+
+// Handlers of the EXTI lines called by dispatchers (indexed by line number)
+exti_line_handler exti_line_handlers[16] = {
+    EXTI_DEFAULT_LINE_HANDLER(0),
+    EXTI_DEFAULT_LINE_HANDLER(1),
+    EXTI_DEFAULT_LINE_HANDLER(2),
+    EXTI_DEFAULT_LINE_HANDLER(3),
+    EXTI_DEFAULT_LINE_HANDLER(4),
+    EXTI_DEFAULT_LINE_HANDLER(5),
+    EXTI_DEFAULT_LINE_HANDLER(6),
+    EXTI_DEFAULT_LINE_HANDLER(7),
+    EXTI_DEFAULT_LINE_HANDLER(8),
+    EXTI_DEFAULT_LINE_HANDLER(9),
+    EXTI_DEFAULT_LINE_HANDLER(10),
+    EXTI_DEFAULT_LINE_HANDLER(11),
+    EXTI_DEFAULT_LINE_HANDLER(12),
+    EXTI_DEFAULT_LINE_HANDLER(13),
+    EXTI_DEFAULT_LINE_HANDLER(14),
+    EXTI_DEFAULT_LINE_HANDLER(15)
+};
+
+// Dispatcher of the EXTI 0-1 lines
+void ISR_EXTI0_1(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(0, 1), exti_line_handlers);
+}
+
+// Dispatcher of the EXTI 2-3 lines
+void ISR_EXTI2_3(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(2, 3), exti_line_handlers);
+}
+
+// Dispatcher of the EXTI 4-15 lines
+void ISR_EXTI4_15(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(4, 15), exti_line_handlers);
+}
+
+#if defined(STM32F030x6) || defined(STM32F030x8) || defined(STM32F070x6) || defined(STM32F070xB) || defined(STM32F030xC) || \
+    defined(STM32F042x6) || defined(STM32F072xB)
+
+// Dispatcher of the DMA1_Channel2_3 interrupt
+void ISR_DMA1_Channel2_3(void) {
+
+    #if defined(DMA1)
+        // Get pending flags of the DMA1 channels with enabled interrupts
+        unsigned long dma1_flags = DMA1->ISR & (
+            DmaChannelEnabled(DMA1, 2) |
+            DmaChannelEnabled(DMA1, 3)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma1_vectors[] = { 0, ISR_DMA1_Channel2, ISR_DMA1_Channel3 };
+        isr_dispatch(dma1_flags, 2, dma1_vectors);
+    #endif
+}
+
+#endif
+
+#if defined(STM32F030x6) || defined(STM32F030x8) || defined(STM32F070x6) || defined(STM32F070xB) || defined(STM32F030xC)
+
+// Dispatcher of the DMA1_Channel4_5 interrupt
+void ISR_DMA1_Channel4_5(void) {
+
+    #if defined(DMA1)
+        // Get pending flags of the DMA1 channels with enabled interrupts
+        unsigned long dma1_flags = DMA1->ISR & (
+            DmaChannelEnabled(DMA1, 4) |
+            DmaChannelEnabled(DMA1, 5)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma1_vectors[] = { 0, 0, 0, ISR_DMA1_Channel4, ISR_DMA1_Channel5 };
+        isr_dispatch(dma1_flags, 2, dma1_vectors);
+    #endif
+}
+
+#endif
+
+#if defined(STM32F031x6) || defined(STM32F051x8) || defined(STM32F071xB) || defined(STM32F091xC) || defined(STM32F038xx) || \
+    defined(STM32F048xx) || defined(STM32F058xx) || defined(STM32F078xx) || defined(STM32F098xx)
+
+// Dispatcher of the DMA1_Ch2_3_DMA2_Ch1_2 interrupt
+void ISR_DMA1_Ch2_3_DMA2_Ch1_2(void) {
+
+    #if defined(DMA1)
+        // Get pending flags of the DMA1 channels with enabled interrupts
+        unsigned long dma1_flags = DMA1->ISR & (
+            DmaChannelEnabled(DMA1, 2) |
+            DmaChannelEnabled(DMA1, 3)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma1_vectors[] = { 0, ISR_DMA1_Channel2, ISR_DMA1_Channel3 };
+        isr_dispatch(dma1_flags, 2, dma1_vectors);
+    #endif
+
+    #if defined(DMA2)
+        // Get pending flags of the DMA2 channels with enabled interrupts
+        unsigned long dma2_flags = DMA2->ISR & (
+            DmaChannelEnabled(DMA2, 1) |
+            DmaChannelEnabled(DMA2, 2)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma2_vectors[] = { ISR_DMA2_Channel1, ISR_DMA2_Channel2 };
+        isr_dispatch(dma2_flags, 2, dma2_vectors);
+    #endif
+}
+
+// Dispatcher of the DMA1_Ch4_7_DMA2_Ch3_5 interrupt
+void ISR_DMA1_Ch4_7_DMA2_Ch3_5(void) {
+
+    #if defined(DMA1)
+        // Get pending flags of the DMA1 channels with enabled interrupts
+        unsigned long dma1_flags = DMA1->ISR & (
+            DmaChannelEnabled(DMA1, 4) |
+            DmaChannelEnabled(DMA1, 5) |
+            DmaChannelEnabled(DMA1, 6) |
+            DmaChannelEnabled(DMA1, 7)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma1_vectors[] = { 0, 0, 0, ISR_DMA1_Channel4, ISR_DMA1_Channel5, ISR_DMA1_Channel6, ISR_DMA1_Channel7 };
+        isr_dispatch(dma1_flags, 2, dma1_vectors);
+    #endif
+
+    #if defined(DMA2)
+        // Get pending flags of the DMA2 channels with enabled interrupts
+        unsigned long dma2_flags = DMA2->ISR & (
+            DmaChannelEnabled(DMA2, 3) |
+            DmaChannelEnabled(DMA2, 4) |
+            DmaChannelEnabled(DMA2, 5)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma2_vectors[] = { 0, 0, ISR_DMA2_Channel3, ISR_DMA2_Channel4, ISR_DMA2_Channel5 };
+        isr_dispatch(dma2_flags, 2, dma2_vectors);
+    #endif
+}
+
+#endif
+
+#if defined(STM32F031x6) || defined(STM32F051x8) || defined(STM32F071xB) || defined(STM32F091xC) || defined(STM32F038xx) || \
+    defined(STM32F048xx) || defined(STM32F058xx) || defined(STM32F078xx) || defined(STM32F098xx) || defined(STM32F042x6) || \
+    defined(STM32F072xB)
+
+// Dispatcher of the TIM6_DAC interrupt
+void ISR_TIM6_DAC(void) {
+
+    #if defined(TIM6)
+        // Dispatch TIM6
+        if(TimPends(TIM6, 0xFFUL))
+            ISR_TIM6();
+    #endif
+
+    #if defined(DAC1)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC1))
+            ISR_DAC();
+    #elif defined(DAC)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC))
+            ISR_DAC();
+    #endif
+}
+
+#endif
+
+#if defined(STM32F042x6) || defined(STM32F072xB)
+
+// Dispatcher of the DMA1_Channel4_5_6_7 interrupt
+void ISR_DMA1_Channel4_5_6_7(void) {
+
+    #if defined(DMA1)
+        // Get pending flags of the DMA1 channels with enabled interrupts
+        unsigned long dma1_flags = DMA1->ISR & (
+            DmaChannelEnabled(DMA1, 4) |
+            DmaChannelEnabled(DMA1, 5) |
+            DmaChannelEnabled(DMA1, 6) |
+            DmaChannelEnabled(DMA1, 7)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma1_vectors[] = { 0, 0, 0, ISR_DMA1_Channel4, ISR_DMA1_Channel5, ISR_DMA1_Channel6, ISR_DMA1_Channel7 };
+        isr_dispatch(dma1_flags, 2, dma1_vectors);
+    #endif
+}
+
+#endif
+
+/* ======================================================== Vectors' table ======================================================== */
+
+#if defined(STM32F030x6) || defined(STM32F030x8) || defined(STM32F070x6) || defined(STM32F070xB) || defined(STM32F030xC)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_RTC,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
+    0,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Channel4_5,
+    ISR_ADC,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    0,
+    ISR_TIM3,
+    ISR_TIM6,
+    0,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3_4_5_6,
+    0,
+    ISR_USB
+};
+
+#elif defined(STM32F031x6) || defined(STM32F051x8) || defined(STM32F071xB) || defined(STM32F091xC) || defined(STM32F038xx) || \
+    defined(STM32F048xx) || defined(STM32F058xx) || defined(STM32F078xx) || defined(STM32F098xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_RTC,
+    ISR_FLASH,
+    ISR_RCC_CRS,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
+    ISR_TSC,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Ch2_3_DMA2_Ch1_2,
+    ISR_DMA1_Ch4_7_DMA2_Ch3_5,
+    ISR_ADC_COMP,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3_8,
+    ISR_CEC_CAN,
+    ISR_USB
+};
+
+#elif defined(STM32F042x6) || defined(STM32F072xB)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_RTC,
+    ISR_FLASH,
+    ISR_RCC_CRS,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
+    ISR_TSC,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Channel4_5_6_7,
+    ISR_ADC_COMP,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3_4,
+    ISR_CEC_CAN,
+    ISR_USB
+};
+
+#else
+#error "ISR vectors table is not defined for the target device"
+#endif
 
 /* ================================================================================================================================ */
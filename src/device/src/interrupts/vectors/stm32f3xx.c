@@ -2,12 +2,14 @@
  * @file       stm32f3xx.c
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
- * @date       Thursday, 15th July 2021 10:14:58 am
- * @modified   Thursday, 15th July 2021 10:40:09 am
+ * @date       Saturday, 17th October 2026 9:58:24 pm
+ * @modified   Saturday, 17th October 2026 9:58:24 pm
  * @project    stm-utils
- * @brief      Definitions of interrupt vectors for STMF3xx devices
- *    
- * @copyright Krzysztof Pierczyk © 2022
+ * @brief      Definitions of interrupt vectors for STM32F3xx devices
+ *
+ * @note Generated by scripts/generate_vectors.py, do not edit
+ *
+ * @copyright Krzysztof Pierczyk © 2026
  * /// ============================================================================================================================ */
 
 /* =========================================================== Includes =========================================================== */
@@ -17,6 +19,1015 @@
 
 /* ========================================================== Definitions ========================================================= */
 
+/**
+ * @note Names for SVC_Handler, PendSV_Handler and SysTick_Handler interrupt
+ *    handlers was set differently to fit RTX-RTOSv5 naming scheme
+ */
 
+// Exception vector's definitions
+ISR_VECTOR           (EXC_NMI);
+ISR_VECTOR           (EXC_HardFault);
+ISR_VECTOR           (EXC_MemoryManagement);
+ISR_VECTOR           (EXC_BusFault);
+ISR_VECTOR           (EXC_UsageFault);
+ISR_VECTOR           (SVC_Handler);
+ISR_VECTOR           (EXC_DebugMonitor);
+ISR_VECTOR           (PendSV_Handler);
+ISR_VECTOR           (SysTick_Handler);
+
+// ISR Vector's definitions
+ISR_VECTOR_FORCED    (ISR_EXTI0_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI1_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI3_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI4_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI9_5);
+ISR_VECTOR_FORCED    (ISR_EXTI15_10);
+ISR_VECTOR_DISPATCHER(ISR_EXTI2_TSC);
+ISR_VECTOR_DISPATCHER(ISR_TIM6_DAC);
+ISR_VECTOR_DISPATCHER(ISR_TIM1_BRK_TIM15);
+ISR_VECTOR_DISPATCHER(ISR_TIM1_UP_TIM16);
+ISR_VECTOR_DISPATCHER(ISR_TIM1_TRG_COM_TIM17);
+ISR_VECTOR           (ISR_WWDG);
+ISR_VECTOR           (ISR_PVD);
+ISR_VECTOR           (ISR_TAMP_STAMP);
+ISR_VECTOR           (ISR_RTC_WKUP);
+ISR_VECTOR           (ISR_FLASH);
+ISR_VECTOR           (ISR_RCC);
+ISR_VECTOR           (ISR_DMA1_Channel1);
+ISR_VECTOR           (ISR_DMA1_Channel2);
+ISR_VECTOR           (ISR_DMA1_Channel3);
+ISR_VECTOR           (ISR_DMA1_Channel4);
+ISR_VECTOR           (ISR_DMA1_Channel5);
+ISR_VECTOR           (ISR_DMA1_Channel6);
+ISR_VECTOR           (ISR_DMA1_Channel7);
+ISR_VECTOR           (ISR_ADC1);
+ISR_VECTOR           (ISR_TIM15);
+ISR_VECTOR           (ISR_TIM16);
+ISR_VECTOR           (ISR_TIM17);
+ISR_VECTOR           (ISR_TIM2);
+ISR_VECTOR           (ISR_I2C1_EV);
+ISR_VECTOR           (ISR_I2C1_ER);
+ISR_VECTOR           (ISR_I2C2_EV);
+ISR_VECTOR           (ISR_I2C2_ER);
+ISR_VECTOR           (ISR_USART1);
+ISR_VECTOR           (ISR_USART2);
+ISR_VECTOR           (ISR_USART3);
+ISR_VECTOR           (ISR_RTC_Alarm);
+ISR_VECTOR           (ISR_COMP2);
+ISR_VECTOR           (ISR_COMP4_6);
+ISR_VECTOR           (ISR_I2C3_EV);
+ISR_VECTOR           (ISR_I2C3_ER);
+ISR_VECTOR           (ISR_FPU);
+ISR_VECTOR           (ISR_ADC1_2);
+ISR_VECTOR           (ISR_USB_HP_CAN_TX);
+ISR_VECTOR           (ISR_USB_LP_CAN_RX0);
+ISR_VECTOR           (ISR_CAN_RX1);
+ISR_VECTOR           (ISR_CAN_SCE);
+ISR_VECTOR           (ISR_TIM1_CC);
+ISR_VECTOR           (ISR_TIM3);
+ISR_VECTOR           (ISR_TIM4);
+ISR_VECTOR           (ISR_SPI1);
+ISR_VECTOR           (ISR_SPI2);
+ISR_VECTOR           (ISR_USBWakeUp);
+ISR_VECTOR           (ISR_TIM8_BRK);
+ISR_VECTOR           (ISR_TIM8_UP);
+ISR_VECTOR           (ISR_TIM8_TRG_COM);
+ISR_VECTOR           (ISR_TIM8_CC);
+ISR_VECTOR           (ISR_ADC3);
+ISR_VECTOR           (ISR_FMC);
+ISR_VECTOR           (ISR_SPI3);
+ISR_VECTOR           (ISR_UART4);
+ISR_VECTOR           (ISR_UART5);
+ISR_VECTOR           (ISR_TIM7);
+ISR_VECTOR           (ISR_DMA2_Channel1);
+ISR_VECTOR           (ISR_DMA2_Channel2);
+ISR_VECTOR           (ISR_DMA2_Channel3);
+ISR_VECTOR           (ISR_DMA2_Channel4);
+ISR_VECTOR           (ISR_DMA2_Channel5);
+ISR_VECTOR           (ISR_ADC4);
+ISR_VECTOR           (ISR_USB_HP);
+ISR_VECTOR           (ISR_USB_LP);
+ISR_VECTOR           (ISR_USBWakeUp_RMP);
+ISR_VECTOR           (ISR_COMP1_2_3);
+ISR_VECTOR           (ISR_COMP4_5_6);
+ISR_VECTOR           (ISR_COMP7);
+ISR_VECTOR           (ISR_TIM20_BRK);
+ISR_VECTOR           (ISR_TIM20_UP);
+ISR_VECTOR           (ISR_TIM20_TRG_COM);
+ISR_VECTOR           (ISR_TIM20_CC);
+ISR_VECTOR           (ISR_SPI4);
+ISR_VECTOR           (ISR_CAN_TX);
+ISR_VECTOR           (ISR_CAN_RX0);
+ISR_VECTOR           (ISR_TIM18_DAC2);
+ISR_VECTOR           (ISR_CEC);
+ISR_VECTOR           (ISR_TIM12);
+ISR_VECTOR           (ISR_TIM13);
+ISR_VECTOR           (ISR_TIM14);
+ISR_VECTOR           (ISR_TIM5);
+ISR_VECTOR           (ISR_SDADC1);
+ISR_VECTOR           (ISR_SDADC2);
+ISR_VECTOR           (ISR_SDADC3);
+ISR_VECTOR           (ISR_COMP1_2);
+ISR_VECTOR           (ISR_TIM19);
+ISR_VECTOR           (ISR_TIM7_DAC2);
+ISR_VECTOR           (ISR_HRTIM1_MST);
+ISR_VECTOR           (ISR_HRTIM1_TIMA);
+ISR_VECTOR           (ISR_HRTIM1_TIMB);
+ISR_VECTOR           (ISR_HRTIM1_TIMC);
+ISR_VECTOR           (ISR_HRTIM1_TIMD);
+ISR_VECTOR           (ISR_HRTIM1_TIME);
+ISR_VECTOR           (ISR_HRTIM1_FLT);
+
+/* ========================================================= Pseud-vectors ======================================================== */
+
+// Pseudo-ISR vectors
+ISR_VECTOR           (ISR_EXTI0);
+ISR_VECTOR           (ISR_EXTI1);
+ISR_VECTOR           (ISR_EXTI2);
+ISR_VECTOR           (ISR_EXTI3);
+ISR_VECTOR           (ISR_EXTI4);
+ISR_VECTOR           (ISR_EXTI5);
+ISR_VECTOR           (ISR_EXTI6);
+ISR_VECTOR           (ISR_EXTI7);
+ISR_VECTOR           (ISR_EXTI8);
+ISR_VECTOR           (ISR_EXTI9);
+ISR_VECTOR           (ISR_EXTI10);
+ISR_VECTOR           (ISR_EXTI11);
+ISR_VECTOR           (ISR_EXTI12);
+ISR_VECTOR           (ISR_EXTI13);
+ISR_VECTOR           (ISR_EXTI14);
+ISR_VECTOR           (ISR_EXTI15);
+ISR_VECTOR           (ISR_TSC);
+ISR_VECTOR           (ISR_TIM6);
+ISR_VECTOR           (ISR_DAC);
+ISR_VECTOR           (ISR_TIM1_BRK);
+ISR_VECTOR           (ISR_TIM1_UP);
+ISR_VECTOR           (ISR_TIM1_TRG_COM);
+
+/* ================================================= Emulated vectors definitions ================================================= */
+
+// Pending flags of the EXTI lines enabled for the current core
+#define EXTI_PENDING (EXTI->PR & EXTI->IMR)
+
+// Default handlers of the EXTI lines (indexed by line number)
+const vector_function_ptr exti_default_handlers[16] = {
+    ISR_EXTI0,
+    ISR_EXTI1,
+    ISR_EXTI2,
+    ISR_EXTI3,
+    ISR_EXTI4,
+    ISR_EXTI5,
+    ISR_EXTI6,
+    ISR_EXTI7,
+    ISR_EXTI8,
+    ISR_EXTI9,
+    ISR_EXTI10,
+    ISR_EXTI11,
+    ISR_EXTI12,
+    ISR_EXTI13,
+    ISR_EXTI14,
+    ISR_EXTI15
+};
+
+// Handlers of the EXTI lines called by dispatchers (indexed by line number)
+exti_line_handler exti_line_handlers[16] = {
+    EXTI_DEFAULT_LINE_HANDLER(0),
+    EXTI_DEFAULT_LINE_HANDLER(1),
+    EXTI_DEFAULT_LINE_HANDLER(2),
+    EXTI_DEFAULT_LINE_HANDLER(3),
+    EXTI_DEFAULT_LINE_HANDLER(4),
+    EXTI_DEFAULT_LINE_HANDLER(5),
+    EXTI_DEFAULT_LINE_HANDLER(6),
+    EXTI_DEFAULT_LINE_HANDLER(7),
+    EXTI_DEFAULT_LINE_HANDLER(8),
+    EXTI_DEFAULT_LINE_HANDLER(9),
+    EXTI_DEFAULT_LINE_HANDLER(10),
+    EXTI_DEFAULT_LINE_HANDLER(11),
+    EXTI_DEFAULT_LINE_HANDLER(12),
+    EXTI_DEFAULT_LINE_HANDLER(13),
+    EXTI_DEFAULT_LINE_HANDLER(14),
+    EXTI_DEFAULT_LINE_HANDLER(15)
+};
+
+// Dispatchers of the EXTI lines with dedicated vectors
+ISR_EXTI_LINE_DISPATCHER(0)
+ISR_EXTI_LINE_DISPATCHER(1)
+ISR_EXTI_LINE_DISPATCHER(3)
+ISR_EXTI_LINE_DISPATCHER(4)
+
+// Dispatcher of the EXTI 5-9 lines
+void ISR_EXTI9_5(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(5, 9), exti_line_handlers);
+}
+
+// Dispatcher of the EXTI 10-15 lines
+void ISR_EXTI15_10(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(10, 15), exti_line_handlers);
+}
+
+// Dispatcher of the EXTI2_TSC interrupt
+void ISR_EXTI2_TSC(void) {
+
+    // Dispatch pending EXTI lines
+    exti_dispatch(EXTI_PENDING & ExtiLines(2, 2), exti_line_handlers);
+
+    #if defined(TSC)
+        // Dispatch TSC
+        if(TSC->ISR & TSC->IER)
+            ISR_TSC();
+    #endif
+}
+
+// Dispatcher of the TIM6_DAC interrupt
+void ISR_TIM6_DAC(void) {
+
+    #if defined(TIM6)
+        // Dispatch TIM6
+        if(TimPends(TIM6, 0xFFUL))
+            ISR_TIM6();
+    #endif
+
+    #if defined(DAC1)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC1))
+            ISR_DAC();
+    #elif defined(DAC)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC))
+            ISR_DAC();
+    #endif
+}
+
+#if defined(STM32F302x8) || defined(STM32F302xC) || defined(STM32F302xE) || defined(STM32F303xC) || defined(STM32F303x8) || \
+    defined(STM32F303xE) || defined(STM32F334x8)
+
+// Dispatcher of the TIM1_BRK_TIM15 interrupt
+void ISR_TIM1_BRK_TIM15(void) {
+
+    #if defined(TIM1)
+        // Dispatch BRK events of TIM1
+        if(TimPends(TIM1, TIM_SR_BIF))
+            ISR_TIM1_BRK();
+    #endif
+
+    #if defined(TIM15)
+        // Dispatch TIM15
+        if(TimPends(TIM15, 0xFFUL))
+            ISR_TIM15();
+    #endif
+}
+
+// Dispatcher of the TIM1_UP_TIM16 interrupt
+void ISR_TIM1_UP_TIM16(void) {
+
+    #if defined(TIM1)
+        // Dispatch UP events of TIM1
+        if(TimPends(TIM1, TIM_SR_UIF))
+            ISR_TIM1_UP();
+    #endif
+
+    #if defined(TIM16)
+        // Dispatch TIM16
+        if(TimPends(TIM16, 0xFFUL))
+            ISR_TIM16();
+    #endif
+}
+
+// Dispatcher of the TIM1_TRG_COM_TIM17 interrupt
+void ISR_TIM1_TRG_COM_TIM17(void) {
+
+    #if defined(TIM1)
+        // Dispatch TRG COM events of TIM1
+        if(TimPends(TIM1, TIM_SR_TIF | TIM_SR_COMIF))
+            ISR_TIM1_TRG_COM();
+    #endif
+
+    #if defined(TIM17)
+        // Dispatch TIM17
+        if(TimPends(TIM17, 0xFFUL))
+            ISR_TIM17();
+    #endif
+}
+
+#endif
+
+/* ======================================================== Vectors' table ======================================================== */
+
+#if defined(STM32F301x8)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_TSC,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    0,
+    0,
+    0,
+    0,
+    ISR_EXTI9_5,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    0,
+    ISR_TIM2,
+    0,
+    0,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    0,
+    0,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_TIM6_DAC,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_COMP2,
+    ISR_COMP4_6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_FPU
+};
+
+#elif defined(STM32F302x8) || defined(STM32F302xC) || defined(STM32F302xE)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_TSC,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1_2,
+    ISR_USB_HP_CAN_TX,
+    ISR_USB_LP_CAN_RX0,
+    ISR_CAN_RX1,
+    ISR_CAN_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_USBWakeUp,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_ADC3,
+    ISR_FMC,
+    0,
+    0,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_ADC4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_USB_HP,
+    ISR_USB_LP,
+    ISR_USBWakeUp_RMP,
+    0,
+    0,
+    0,
+    0,
+    ISR_FPU
+};
+
+#elif defined(STM32F303xC) || defined(STM32F303x8) || defined(STM32F303xE)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_TSC,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1_2,
+    ISR_USB_HP_CAN_TX,
+    ISR_USB_LP_CAN_RX0,
+    ISR_CAN_RX1,
+    ISR_CAN_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_USBWakeUp,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_ADC3,
+    ISR_FMC,
+    0,
+    0,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_ADC4,
+    0,
+    0,
+    ISR_COMP1_2_3,
+    ISR_COMP4_5_6,
+    ISR_COMP7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_USB_HP,
+    ISR_USB_LP,
+    ISR_USBWakeUp_RMP,
+    ISR_TIM20_BRK,
+    ISR_TIM20_UP,
+    ISR_TIM20_TRG_COM,
+    ISR_TIM20_CC,
+    ISR_FPU,
+    0,
+    0,
+    ISR_SPI4
+};
+
+#elif defined(STM32F373xC)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_TSC,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    ISR_CAN_TX,
+    ISR_CAN_RX0,
+    ISR_CAN_RX1,
+    ISR_CAN_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_TIM18_DAC2,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_CEC,
+    ISR_TIM12,
+    ISR_TIM13,
+    ISR_TIM14,
+    0,
+    0,
+    0,
+    0,
+    ISR_TIM5,
+    ISR_SPI3,
+    0,
+    0,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_SDADC1,
+    ISR_SDADC2,
+    ISR_SDADC3,
+    ISR_COMP1_2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_USB_HP,
+    ISR_USB_LP,
+    ISR_USBWakeUp,
+    0,
+    ISR_TIM19,
+    0,
+    0,
+    ISR_FPU
+};
+
+#elif defined(STM32F334x8)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_TSC,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1_2,
+    ISR_USB_HP_CAN_TX,
+    ISR_USB_LP_CAN_RX0,
+    ISR_CAN_RX1,
+    ISR_CAN_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    0,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    0,
+    0,
+    ISR_SPI1,
+    0,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_TIM6_DAC,
+    ISR_TIM7_DAC2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_FPU,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_HRTIM1_MST,
+    ISR_HRTIM1_TIMA,
+    ISR_HRTIM1_TIMB,
+    ISR_HRTIM1_TIMC,
+    ISR_HRTIM1_TIMD,
+    ISR_HRTIM1_TIME,
+    ISR_HRTIM1_FLT
+};
+
+#elif defined(STM32F318xx) || defined(STM32F358xx) || defined(STM32F328xx) || defined(STM32F398xx) || defined(STM32F378xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_TSC,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    ISR_CAN_TX,
+    ISR_CAN_RX0,
+    ISR_CAN_RX1,
+    ISR_CAN_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_TIM18_DAC2,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_TIM12,
+    ISR_TIM13,
+    ISR_TIM14,
+    ISR_TIM8_CC,
+    ISR_ADC3,
+    ISR_FMC,
+    0,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_SDADC1,
+    ISR_SDADC2,
+    ISR_SDADC3,
+    0,
+    0,
+    ISR_COMP7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_USB_HP,
+    ISR_USB_LP,
+    ISR_USBWakeUp,
+    ISR_TIM20_BRK,
+    ISR_TIM19,
+    ISR_TIM20_TRG_COM,
+    ISR_TIM20_CC,
+    ISR_FPU
+};
+
+#else
+#error "ISR vectors table is not defined for the target device"
+#endif
 
 /* ================================================================================================================================ */
@@ -2,12 +2,14 @@
  * @file       stm32f4xx.c
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
- * @date       Tuesday, 6th July 2021 1:51:11 pm
- * @modified   Tuesday, 6th July 2021 1:51:11 pm
+ * @date       Saturday, 17th October 2026 9:58:25 pm
+ * @modified   Saturday, 17th October 2026 9:58:25 pm
  * @project    stm-utils
- * @brief      Definitions of interrupt vectors for STMF4xx devices
- *    
- * @copyright Krzysztof Pierczyk © 2022
+ * @brief      Definitions of interrupt vectors for STM32F4xx devices
+ *
+ * @note Generated by scripts/generate_vectors.py, do not edit
+ *
+ * @copyright Krzysztof Pierczyk © 2026
  * /// ============================================================================================================================ */
 
 /* =========================================================== Includes =========================================================== */
@@ -23,160 +25,425 @@
  */
 
 // Exception vector's definitions
-ISR_VECTOR       (EXC_NMI);
-ISR_VECTOR       (EXC_HardFault);
-ISR_VECTOR       (EXC_MemoryManagement);
-ISR_VECTOR       (EXC_BusFault);
-ISR_VECTOR       (EXC_UsageFault);
-ISR_VECTOR       (SVC_Handler);
-ISR_VECTOR       (EXC_DebugMonitor);
-ISR_VECTOR       (PendSV_Handler);
-ISR_VECTOR       (SysTick_Handler);
+ISR_VECTOR           (EXC_NMI);
+ISR_VECTOR           (EXC_HardFault);
+ISR_VECTOR           (EXC_MemoryManagement);
+ISR_VECTOR           (EXC_BusFault);
+ISR_VECTOR           (EXC_UsageFault);
+ISR_VECTOR           (SVC_Handler);
+ISR_VECTOR           (EXC_DebugMonitor);
+ISR_VECTOR           (PendSV_Handler);
+ISR_VECTOR           (SysTick_Handler);
 
 // ISR Vector's definitions
-ISR_VECTOR       (ISR_WWDG);
-ISR_VECTOR       (ISR_PVD);
-ISR_VECTOR       (ISR_Tamper);
-ISR_VECTOR       (ISR_RTC_Wakeup);
-ISR_VECTOR       (ISR_FLASH);
-ISR_VECTOR       (ISR_RCC);
-ISR_VECTOR       (ISR_EXTI0);
-ISR_VECTOR       (ISR_EXTI1);
-ISR_VECTOR       (ISR_EXTI2);
-ISR_VECTOR       (ISR_EXTI3);
-ISR_VECTOR       (ISR_EXTI4);
-ISR_VECTOR       (ISR_DMA1_Stream0);
-ISR_VECTOR       (ISR_DMA1_Stream1);
-ISR_VECTOR       (ISR_DMA1_Stream2);
-ISR_VECTOR       (ISR_DMA1_Stream3);
-ISR_VECTOR       (ISR_DMA1_Stream4);
-ISR_VECTOR       (ISR_DMA1_Stream5);
-ISR_VECTOR       (ISR_DMA1_Stream6);
-ISR_VECTOR       (ISR_ADC);
-ISR_VECTOR       (ISR_CAN1_TX);
-ISR_VECTOR       (ISR_CAN1_RX0);
-ISR_VECTOR       (ISR_CAN1_RX1);
-ISR_VECTOR       (ISR_CAN1_SCE);
-ISR_VECTOR_FORCED(ISR_EXTI9_5);
-ISR_VECTOR       (ISR_TIM1_Break_TIM9);
-ISR_VECTOR       (ISR_TIM1_Update_TIM10);
-ISR_VECTOR       (ISR_TIM1_TRG_COM_TIM11);
-ISR_VECTOR       (ISR_TIM1_CC);
-ISR_VECTOR       (ISR_TIM2);
-ISR_VECTOR       (ISR_TIM3);
-ISR_VECTOR       (ISR_TIM4);
-ISR_VECTOR       (ISR_I2C1_EV);
-ISR_VECTOR       (ISR_I2C1_ER);
-ISR_VECTOR       (ISR_I2C2_EV);
-ISR_VECTOR       (ISR_I2C2_ER);
-ISR_VECTOR       (ISR_SPI1);
-ISR_VECTOR       (ISR_SPI2);
-ISR_VECTOR       (ISR_USART1);
-ISR_VECTOR       (ISR_USART2);
-ISR_VECTOR       (ISR_USART3);
-ISR_VECTOR_FORCED(ISR_EXTI15_10);
-ISR_VECTOR       (ISR_RTC_Alarm);
-ISR_VECTOR       (ISR_USB_Wakeup);
-ISR_VECTOR       (ISR_TIM8_Break_TIM12);
-ISR_VECTOR       (ISR_TIM8_Update_TIM13);
-ISR_VECTOR       (ISR_TIM8_TRG_COM_TIM14);
-ISR_VECTOR       (ISR_TIM8_CC);
-ISR_VECTOR       (ISR_DMA1_Stream7);
-ISR_VECTOR       (ISR_FSMC);
-ISR_VECTOR       (ISR_SDIO);
-ISR_VECTOR       (ISR_TIM5);
-ISR_VECTOR       (ISR_SPI3);
-ISR_VECTOR       (ISR_USART4);
-ISR_VECTOR       (ISR_USART5);
-ISR_VECTOR       (ISR_TIM6_DAC);
-ISR_VECTOR       (ISR_TIM7);
-ISR_VECTOR       (ISR_DMA2_Stream0);
-ISR_VECTOR       (ISR_DMA2_Stream1);
-ISR_VECTOR       (ISR_DMA2_Stream2);
-ISR_VECTOR       (ISR_DMA2_Stream3);
-ISR_VECTOR       (ISR_DMA2_Stream4);
-ISR_VECTOR       (ISR_ETH);
-ISR_VECTOR       (ISR_ETH_Wakeup);
-ISR_VECTOR       (ISR_CAN2_TX);
-ISR_VECTOR       (ISR_CAN2_RX0);
-ISR_VECTOR       (ISR_CAN2_RX1);
-ISR_VECTOR       (ISR_CAN2_SCE);
-ISR_VECTOR       (ISR_OTG_FS);
-ISR_VECTOR       (ISR_DMA2_Stream5);
-ISR_VECTOR       (ISR_DMA2_Stream6);
-ISR_VECTOR       (ISR_DMA2_Stream7);
-ISR_VECTOR       (ISR_USART6);
-ISR_VECTOR       (ISR_I2C3_EV);
-ISR_VECTOR       (ISR_I2C3_ER);
-ISR_VECTOR       (ISR_OTG_HS_EP1_Out);
-ISR_VECTOR       (ISR_OTG_HS_Wakeup);
-ISR_VECTOR       (ISR_OTG_HS);
-ISR_VECTOR       (ISR_DCMI_isr_vector);
-ISR_VECTOR       (ISR_Cryp);
-ISR_VECTOR       (ISR_Hash_RNG);
-ISR_VECTOR       (ISR_FPU);
-ISR_VECTOR       (ISR_SPI4);
-ISR_VECTOR       (ISR_SPI5);
+ISR_VECTOR_FORCED    (ISR_EXTI0_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI1_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI2_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI3_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI4_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI9_5);
+ISR_VECTOR_FORCED    (ISR_EXTI15_10);
+ISR_VECTOR_DISPATCHER(ISR_TIM1_BRK_TIM9);
+ISR_VECTOR_DISPATCHER(ISR_TIM1_UP_TIM10);
+ISR_VECTOR_DISPATCHER(ISR_TIM1_TRG_COM_TIM11);
+ISR_VECTOR_DISPATCHER(ISR_TIM8_BRK_TIM12);
+ISR_VECTOR_DISPATCHER(ISR_TIM8_UP_TIM13);
+ISR_VECTOR_DISPATCHER(ISR_TIM8_TRG_COM_TIM14);
+ISR_VECTOR_DISPATCHER(ISR_TIM6_DAC);
+ISR_VECTOR           (ISR_WWDG);
+ISR_VECTOR           (ISR_PVD);
+ISR_VECTOR           (ISR_FLASH);
+ISR_VECTOR           (ISR_RCC);
+ISR_VECTOR           (ISR_DMA1_Stream0);
+ISR_VECTOR           (ISR_DMA1_Stream1);
+ISR_VECTOR           (ISR_DMA1_Stream2);
+ISR_VECTOR           (ISR_DMA1_Stream3);
+ISR_VECTOR           (ISR_DMA1_Stream4);
+ISR_VECTOR           (ISR_DMA1_Stream5);
+ISR_VECTOR           (ISR_DMA1_Stream6);
+ISR_VECTOR           (ISR_ADC);
+ISR_VECTOR           (ISR_TIM1_CC);
+ISR_VECTOR           (ISR_TIM2);
+ISR_VECTOR           (ISR_TIM3);
+ISR_VECTOR           (ISR_TIM4);
+ISR_VECTOR           (ISR_I2C1_EV);
+ISR_VECTOR           (ISR_I2C1_ER);
+ISR_VECTOR           (ISR_I2C2_EV);
+ISR_VECTOR           (ISR_I2C2_ER);
+ISR_VECTOR           (ISR_SPI1);
+ISR_VECTOR           (ISR_SPI2);
+ISR_VECTOR           (ISR_USART1);
+ISR_VECTOR           (ISR_USART2);
+ISR_VECTOR           (ISR_RTC_Alarm);
+ISR_VECTOR           (ISR_DMA1_Stream7);
+ISR_VECTOR           (ISR_SDIO);
+ISR_VECTOR           (ISR_TIM5);
+ISR_VECTOR           (ISR_SPI3);
+ISR_VECTOR           (ISR_DMA2_Stream0);
+ISR_VECTOR           (ISR_DMA2_Stream1);
+ISR_VECTOR           (ISR_DMA2_Stream2);
+ISR_VECTOR           (ISR_DMA2_Stream3);
+ISR_VECTOR           (ISR_DMA2_Stream4);
+ISR_VECTOR           (ISR_OTG_FS);
+ISR_VECTOR           (ISR_DMA2_Stream5);
+ISR_VECTOR           (ISR_DMA2_Stream6);
+ISR_VECTOR           (ISR_DMA2_Stream7);
+ISR_VECTOR           (ISR_USART6);
+ISR_VECTOR           (ISR_I2C3_EV);
+ISR_VECTOR           (ISR_I2C3_ER);
+ISR_VECTOR           (ISR_FPU);
+ISR_VECTOR           (ISR_SPI4);
+ISR_VECTOR           (ISR_CAN1_TX);
+ISR_VECTOR           (ISR_CAN1_RX0);
+ISR_VECTOR           (ISR_CAN1_RX1);
+ISR_VECTOR           (ISR_CAN1_SCE);
+ISR_VECTOR           (ISR_USART3);
+ISR_VECTOR           (ISR_TIM8_CC);
+ISR_VECTOR           (ISR_FSMC);
+ISR_VECTOR           (ISR_TIM7);
+ISR_VECTOR           (ISR_ETH);
+ISR_VECTOR           (ISR_CAN2_TX);
+ISR_VECTOR           (ISR_CAN2_RX0);
+ISR_VECTOR           (ISR_CAN2_RX1);
+ISR_VECTOR           (ISR_CAN2_SCE);
+ISR_VECTOR           (ISR_OTG_HS_EP1_IN);
+ISR_VECTOR           (ISR_OTG_HS);
+ISR_VECTOR           (ISR_TIM1_UP);
+ISR_VECTOR           (ISR_RNG);
+ISR_VECTOR           (ISR_FMPI2C1_EV);
+ISR_VECTOR           (ISR_FMPI2C1_ER);
+ISR_VECTOR           (ISR_LPTIM1);
+ISR_VECTOR           (ISR_SPI5);
+ISR_VECTOR           (ISR_DFSDM1_FLT0);
+ISR_VECTOR           (ISR_DFSDM1_FLT1);
+ISR_VECTOR           (ISR_QUADSPI);
+ISR_VECTOR           (ISR_CAN3_TX);
+ISR_VECTOR           (ISR_CAN3_RX0);
+ISR_VECTOR           (ISR_CAN3_RX1);
+ISR_VECTOR           (ISR_CAN3_SCE);
+ISR_VECTOR           (ISR_AES);
+ISR_VECTOR           (ISR_UART7);
+ISR_VECTOR           (ISR_UART8);
+ISR_VECTOR           (ISR_SAI1);
+ISR_VECTOR           (ISR_UART9);
+ISR_VECTOR           (ISR_UART10);
+ISR_VECTOR           (ISR_DFSDM2_FLT0);
+ISR_VECTOR           (ISR_DFSDM2_FLT1);
+ISR_VECTOR           (ISR_DFSDM2_FLT2);
+ISR_VECTOR           (ISR_DFSDM2_FLT3);
+ISR_VECTOR           (ISR_FMC);
+ISR_VECTOR           (ISR_SPI6);
+ISR_VECTOR           (ISR_DMA2D);
+ISR_VECTOR           (ISR_LTDC);
+ISR_VECTOR           (ISR_LTDC_ER);
+ISR_VECTOR           (ISR_SAI2);
+ISR_VECTOR           (ISR_CEC);
+ISR_VECTOR           (ISR_SPDIF_RX);
+ISR_VECTOR           (ISR_DSI);
+
+/* ======================================================== Legacy vectors ======================================================== */
+
+// Vectors under legacy names (handlers defined by the application under these names are called by default
+// handlers of renamed vectors and replace dispatchers of renamed shared interrupts)
+ISR_VECTOR           (ISR_Cryp);
+ISR_VECTOR           (ISR_DCMI_isr_vector);
+ISR_VECTOR           (ISR_ETH_Wakeup);
+ISR_VECTOR           (ISR_Hash_RNG);
+ISR_VECTOR           (ISR_OTG_HS_EP1_Out);
+ISR_VECTOR           (ISR_OTG_HS_Wakeup);
+ISR_VECTOR           (ISR_RTC_Wakeup);
+ISR_VECTOR           (ISR_Tamper);
+ISR_VECTOR           (ISR_USART4);
+ISR_VECTOR           (ISR_USART5);
+ISR_VECTOR           (ISR_USB_Wakeup);
+ISR_VECTOR_WEAK_REF  (ISR_TIM1_Break_TIM9);
+ISR_VECTOR_WEAK_REF  (ISR_TIM1_Update_TIM10);
+ISR_VECTOR_WEAK_REF  (ISR_TIM8_Break_TIM12);
+ISR_VECTOR_WEAK_REF  (ISR_TIM8_Update_TIM13);
+
+// Renamed vectors
+ISR_VECTOR_LEGACY(ISR_CRYP, ISR_Cryp)
+ISR_VECTOR_LEGACY(ISR_DCMI, ISR_DCMI_isr_vector)
+ISR_VECTOR_LEGACY(ISR_ETH_WKUP, ISR_ETH_Wakeup)
+ISR_VECTOR_LEGACY(ISR_HASH_RNG, ISR_Hash_RNG)
+ISR_VECTOR_LEGACY(ISR_OTG_HS_EP1_OUT, ISR_OTG_HS_EP1_Out)
+ISR_VECTOR_LEGACY(ISR_OTG_HS_WKUP, ISR_OTG_HS_Wakeup)
+ISR_VECTOR_LEGACY(ISR_RTC_WKUP, ISR_RTC_Wakeup)
+ISR_VECTOR_LEGACY(ISR_TAMP_STAMP, ISR_Tamper)
+ISR_VECTOR_LEGACY(ISR_UART4, ISR_USART4)
+ISR_VECTOR_LEGACY(ISR_UART5, ISR_USART5)
+ISR_VECTOR_LEGACY(ISR_OTG_FS_WKUP, ISR_USB_Wakeup)
 
 /* ========================================================= Pseud-vectors ======================================================== */
 
 // Pseudo-ISR vectors
-ISR_VECTOR       (ISR_EXTI5);
-ISR_VECTOR       (ISR_EXTI6);
-ISR_VECTOR       (ISR_EXTI7);
-ISR_VECTOR       (ISR_EXTI8);
-ISR_VECTOR       (ISR_EXTI9);
-ISR_VECTOR       (ISR_EXTI10);
-ISR_VECTOR       (ISR_EXTI11);
-ISR_VECTOR       (ISR_EXTI12);
-ISR_VECTOR       (ISR_EXTI13);
-ISR_VECTOR       (ISR_EXTI14);
-ISR_VECTOR       (ISR_EXTI15);
+ISR_VECTOR           (ISR_EXTI0);
+ISR_VECTOR           (ISR_EXTI1);
+ISR_VECTOR           (ISR_EXTI2);
+ISR_VECTOR           (ISR_EXTI3);
+ISR_VECTOR           (ISR_EXTI4);
+ISR_VECTOR           (ISR_EXTI5);
+ISR_VECTOR           (ISR_EXTI6);
+ISR_VECTOR           (ISR_EXTI7);
+ISR_VECTOR           (ISR_EXTI8);
+ISR_VECTOR           (ISR_EXTI9);
+ISR_VECTOR           (ISR_EXTI10);
+ISR_VECTOR           (ISR_EXTI11);
+ISR_VECTOR           (ISR_EXTI12);
+ISR_VECTOR           (ISR_EXTI13);
+ISR_VECTOR           (ISR_EXTI14);
+ISR_VECTOR           (ISR_EXTI15);
+ISR_VECTOR           (ISR_TIM1_BRK);
+ISR_VECTOR           (ISR_TIM9);
+ISR_VECTOR           (ISR_TIM10);
+ISR_VECTOR           (ISR_TIM1_TRG_COM);
+ISR_VECTOR           (ISR_TIM11);
+ISR_VECTOR           (ISR_TIM8_BRK);
+ISR_VECTOR           (ISR_TIM12);
+ISR_VECTOR           (ISR_TIM8_UP);
+ISR_VECTOR           (ISR_TIM13);
+ISR_VECTOR           (ISR_TIM8_TRG_COM);
+ISR_VECTOR           (ISR_TIM14);
+ISR_VECTOR           (ISR_TIM6);
+ISR_VECTOR           (ISR_DAC);
 
 /* ================================================= Emulated vectors definitions ================================================= */
 
+// Pending flags of the EXTI lines enabled for the current core
+#define EXTI_PENDING (EXTI->PR & EXTI->IMR)
+
+// Default handlers of the EXTI lines (indexed by line number)
+const vector_function_ptr exti_default_handlers[16] = {
+    ISR_EXTI0,
+    ISR_EXTI1,
+    ISR_EXTI2,
+    ISR_EXTI3,
+    ISR_EXTI4,
+    ISR_EXTI5,
+    ISR_EXTI6,
+    ISR_EXTI7,
+    ISR_EXTI8,
+    ISR_EXTI9,
+    ISR_EXTI10,
+    ISR_EXTI11,
+    ISR_EXTI12,
+    ISR_EXTI13,
+    ISR_EXTI14,
+    ISR_EXTI15
+};
+
+// Handlers of the EXTI lines called by dispatchers (indexed by line number)
+exti_line_handler exti_line_handlers[16] = {
+    EXTI_DEFAULT_LINE_HANDLER(0),
+    EXTI_DEFAULT_LINE_HANDLER(1),
+    EXTI_DEFAULT_LINE_HANDLER(2),
+    EXTI_DEFAULT_LINE_HANDLER(3),
+    EXTI_DEFAULT_LINE_HANDLER(4),
+    EXTI_DEFAULT_LINE_HANDLER(5),
+    EXTI_DEFAULT_LINE_HANDLER(6),
+    EXTI_DEFAULT_LINE_HANDLER(7),
+    EXTI_DEFAULT_LINE_HANDLER(8),
+    EXTI_DEFAULT_LINE_HANDLER(9),
+    EXTI_DEFAULT_LINE_HANDLER(10),
+    EXTI_DEFAULT_LINE_HANDLER(11),
+    EXTI_DEFAULT_LINE_HANDLER(12),
+    EXTI_DEFAULT_LINE_HANDLER(13),
+    EXTI_DEFAULT_LINE_HANDLER(14),
+    EXTI_DEFAULT_LINE_HANDLER(15)
+};
+
+// Dispatchers of the EXTI lines with dedicated vectors
+ISR_EXTI_LINE_DISPATCHER(0)
+ISR_EXTI_LINE_DISPATCHER(1)
+ISR_EXTI_LINE_DISPATCHER(2)
+ISR_EXTI_LINE_DISPATCHER(3)
+ISR_EXTI_LINE_DISPATCHER(4)
+
 // Dispatcher of the EXTI 5-9 lines
 void ISR_EXTI9_5(void) {
 
-    // Get EXTI pending flags
-	unsigned long flags = EXTI->PR;
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
 
     // Dispatch lines
-	if(ExtiPends(flags, 5))
-		ISR_EXTI5();
-	if(ExtiPends(flags, 6))
-		ISR_EXTI6();
-	if(ExtiPends(flags, 7))
-		ISR_EXTI7();
-	if(ExtiPends(flags, 8))
-		ISR_EXTI8();
-	if(ExtiPends(flags, 9))
-		ISR_EXTI9();
+    exti_dispatch(flags & ExtiLines(5, 9), exti_line_handlers);
 }
 
 // Dispatcher of the EXTI 10-15 lines
 void ISR_EXTI15_10(void) {
-	
-    // Get EXTI pending flags
-	unsigned long flags = EXTI->PR;
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
 
     // Dispatch lines
-	if(ExtiPends(flags, 10))
-		ISR_EXTI10();
-	if(ExtiPends(flags, 11))
-		ISR_EXTI11();
-	if(ExtiPends(flags, 12))
-		ISR_EXTI12();
-	if(ExtiPends(flags, 13))
-		ISR_EXTI13();
-	if(ExtiPends(flags, 14))
-		ISR_EXTI14();
-	if(ExtiPends(flags, 15))
-		ISR_EXTI15();
+    exti_dispatch(flags & ExtiLines(10, 15), exti_line_handlers);
+}
+
+// Dispatcher of the TIM1_BRK_TIM9 interrupt
+void ISR_TIM1_BRK_TIM9(void) {
+
+    // Call handler defined under the legacy name
+    if(ISR_TIM1_Break_TIM9) {
+        ISR_TIM1_Break_TIM9();
+        return;
+    }
+
+    #if defined(TIM1)
+        // Dispatch BRK events of TIM1
+        if(TimPends(TIM1, TIM_SR_BIF))
+            ISR_TIM1_BRK();
+    #endif
+
+    #if defined(TIM9)
+        // Dispatch TIM9
+        if(TimPends(TIM9, 0xFFUL))
+            ISR_TIM9();
+    #endif
+}
+
+// Dispatcher of the TIM1_TRG_COM_TIM11 interrupt
+void ISR_TIM1_TRG_COM_TIM11(void) {
+
+    #if defined(TIM1)
+        // Dispatch TRG COM events of TIM1
+        if(TimPends(TIM1, TIM_SR_TIF | TIM_SR_COMIF))
+            ISR_TIM1_TRG_COM();
+    #endif
+
+    #if defined(TIM11)
+        // Dispatch TIM11
+        if(TimPends(TIM11, 0xFFUL))
+            ISR_TIM11();
+    #endif
+}
+
+#if defined(STM32F401xC) || defined(STM32F401xE) || defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || \
+    defined(STM32F417xx) || defined(STM32F411xE) || defined(STM32F412Cx) || defined(STM32F412Zx) || defined(STM32F412Rx) || \
+    defined(STM32F412Vx) || defined(STM32F413xx) || defined(STM32F423xx) || defined(STM32F427xx) || defined(STM32F437xx) || \
+    defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F446xx) || defined(STM32F469xx) || defined(STM32F479xx)
+
+// Dispatcher of the TIM1_UP_TIM10 interrupt
+void ISR_TIM1_UP_TIM10(void) {
+
+    // Call handler defined under the legacy name
+    if(ISR_TIM1_Update_TIM10) {
+        ISR_TIM1_Update_TIM10();
+        return;
+    }
+
+    #if defined(TIM1)
+        // Dispatch UP events of TIM1
+        if(TimPends(TIM1, TIM_SR_UIF))
+            ISR_TIM1_UP();
+    #endif
+
+    #if defined(TIM10)
+        // Dispatch TIM10
+        if(TimPends(TIM10, 0xFFUL))
+            ISR_TIM10();
+    #endif
+}
+
+#endif
+
+#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || defined(STM32F412Cx) || \
+    defined(STM32F412Zx) || defined(STM32F412Rx) || defined(STM32F412Vx) || defined(STM32F413xx) || defined(STM32F423xx) || \
+    defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F446xx) || \
+    defined(STM32F469xx) || defined(STM32F479xx)
+
+// Dispatcher of the TIM8_BRK_TIM12 interrupt
+void ISR_TIM8_BRK_TIM12(void) {
+
+    // Call handler defined under the legacy name
+    if(ISR_TIM8_Break_TIM12) {
+        ISR_TIM8_Break_TIM12();
+        return;
+    }
+
+    #if defined(TIM8)
+        // Dispatch BRK events of TIM8
+        if(TimPends(TIM8, TIM_SR_BIF))
+            ISR_TIM8_BRK();
+    #endif
+
+    #if defined(TIM12)
+        // Dispatch TIM12
+        if(TimPends(TIM12, 0xFFUL))
+            ISR_TIM12();
+    #endif
+}
+
+// Dispatcher of the TIM8_UP_TIM13 interrupt
+void ISR_TIM8_UP_TIM13(void) {
+
+    // Call handler defined under the legacy name
+    if(ISR_TIM8_Update_TIM13) {
+        ISR_TIM8_Update_TIM13();
+        return;
+    }
+
+    #if defined(TIM8)
+        // Dispatch UP events of TIM8
+        if(TimPends(TIM8, TIM_SR_UIF))
+            ISR_TIM8_UP();
+    #endif
+
+    #if defined(TIM13)
+        // Dispatch TIM13
+        if(TimPends(TIM13, 0xFFUL))
+            ISR_TIM13();
+    #endif
+}
+
+// Dispatcher of the TIM8_TRG_COM_TIM14 interrupt
+void ISR_TIM8_TRG_COM_TIM14(void) {
+
+    #if defined(TIM8)
+        // Dispatch TRG COM events of TIM8
+        if(TimPends(TIM8, TIM_SR_TIF | TIM_SR_COMIF))
+            ISR_TIM8_TRG_COM();
+    #endif
+
+    #if defined(TIM14)
+        // Dispatch TIM14
+        if(TimPends(TIM14, 0xFFUL))
+            ISR_TIM14();
+    #endif
+}
+
+#endif
+
+#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || defined(STM32F410Tx) || \
+    defined(STM32F410Cx) || defined(STM32F410Rx) || defined(STM32F412Cx) || defined(STM32F412Zx) || defined(STM32F412Rx) || \
+    defined(STM32F412Vx) || defined(STM32F413xx) || defined(STM32F423xx) || defined(STM32F427xx) || defined(STM32F437xx) || \
+    defined(STM32F429xx) || defined(STM32F439xx) || defined(STM32F446xx) || defined(STM32F469xx) || defined(STM32F479xx)
+
+// Dispatcher of the TIM6_DAC interrupt
+void ISR_TIM6_DAC(void) {
+
+    #if defined(TIM6)
+        // Dispatch TIM6
+        if(TimPends(TIM6, 0xFFUL))
+            ISR_TIM6();
+    #endif
+
+    #if defined(DAC1)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC1))
+            ISR_DAC();
+    #elif defined(DAC)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC))
+            ISR_DAC();
+    #endif
 }
 
+#endif
+
 /* ======================================================== Vectors' table ======================================================== */
 
+#if defined(STM32F401xC) || defined(STM32F401xE)
+
 const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
 
     // Stack pointer
@@ -184,7 +451,7 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     // Reset handler
     reser_handler,
 
-    /* ----------------------------- Exception vectors ----------------------------- */    
+    /* ----------------------------- Exception vectors ----------------------------- */
 
     EXC_NMI,
     EXC_HardFault,
@@ -205,15 +472,130 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
 
     ISR_WWDG,
     ISR_PVD,
-    ISR_Tamper,
-    ISR_RTC_Wakeup,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
     ISR_FLASH,
     ISR_RCC,
-    ISR_EXTI0,
-    ISR_EXTI1,
-    ISR_EXTI2,
-    ISR_EXTI3,
-    ISR_EXTI4,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC,
+    0,
+    0,
+    0,
+    0,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM9,
+    ISR_TIM1_UP_TIM10,
+    ISR_TIM1_TRG_COM_TIM11,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    0,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_OTG_FS_WKUP,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA1_Stream7,
+    0,
+    ISR_SDIO,
+    ISR_TIM5,
+    ISR_SPI3,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_OTG_FS,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_FPU,
+    0,
+    0,
+    ISR_SPI4
+};
+
+#elif defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
     ISR_DMA1_Stream0,
     ISR_DMA1_Stream1,
     ISR_DMA1_Stream2,
@@ -227,8 +609,8 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     ISR_CAN1_RX1,
     ISR_CAN1_SCE,
     ISR_EXTI9_5,
-    ISR_TIM1_Break_TIM9,
-    ISR_TIM1_Update_TIM10,
+    ISR_TIM1_BRK_TIM9,
+    ISR_TIM1_UP_TIM10,
     ISR_TIM1_TRG_COM_TIM11,
     ISR_TIM1_CC,
     ISR_TIM2,
@@ -243,11 +625,11 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     ISR_USART1,
     ISR_USART2,
     ISR_USART3,
-    ISR_EXTI15_10,	
+    ISR_EXTI15_10,
     ISR_RTC_Alarm,
-    ISR_USB_Wakeup,
-    ISR_TIM8_Break_TIM12,
-    ISR_TIM8_Update_TIM13,
+    ISR_OTG_FS_WKUP,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
     ISR_TIM8_TRG_COM_TIM14,
     ISR_TIM8_CC,
     ISR_DMA1_Stream7,
@@ -255,8 +637,8 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     ISR_SDIO,
     ISR_TIM5,
     ISR_SPI3,
-    ISR_USART4,
-    ISR_USART5,
+    ISR_UART4,
+    ISR_UART5,
     ISR_TIM6_DAC,
     ISR_TIM7,
     ISR_DMA2_Stream0,
@@ -265,7 +647,7 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     ISR_DMA2_Stream3,
     ISR_DMA2_Stream4,
     ISR_ETH,
-    ISR_ETH_Wakeup,
+    ISR_ETH_WKUP,
     ISR_CAN2_TX,
     ISR_CAN2_RX0,
     ISR_CAN2_RX1,
@@ -277,18 +659,1013 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     ISR_USART6,
     ISR_I2C3_EV,
     ISR_I2C3_ER,
-    ISR_OTG_HS_EP1_Out,
-    ISR_OTG_HS_EP1_Out,
-    ISR_OTG_HS_Wakeup,
+    ISR_OTG_HS_EP1_OUT,
+    ISR_OTG_HS_EP1_IN,
+    ISR_OTG_HS_WKUP,
     ISR_OTG_HS,
-    ISR_DCMI_isr_vector,
-    ISR_Cryp,
-    ISR_Hash_RNG,
-    ISR_FPU,
+    ISR_DCMI,
+    ISR_CRYP,
+    ISR_HASH_RNG,
+    ISR_FPU
+};
+
+#elif defined(STM32F410Tx) || defined(STM32F410Cx) || defined(STM32F410Rx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
     0,
     0,
-    ISR_SPI4,
-    ISR_SPI5
-};
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC,
+    0,
+    0,
+    0,
+    0,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM9,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM_TIM11,
+    ISR_TIM1_CC,
+    0,
+    0,
+    0,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    0,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA1_Stream7,
+    0,
+    0,
+    ISR_TIM5,
+    0,
+    0,
+    0,
+    ISR_TIM6_DAC,
+    0,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_RNG,
+    ISR_FPU,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_FMPI2C1_EV,
+    ISR_FMPI2C1_ER,
+    ISR_LPTIM1
+};
+
+#elif defined(STM32F411xE)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC,
+    0,
+    0,
+    0,
+    0,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM9,
+    ISR_TIM1_UP_TIM10,
+    ISR_TIM1_TRG_COM_TIM11,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    0,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_OTG_FS_WKUP,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA1_Stream7,
+    0,
+    ISR_SDIO,
+    ISR_TIM5,
+    ISR_SPI3,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_OTG_FS,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_FPU,
+    0,
+    0,
+    ISR_SPI4,
+    ISR_SPI5
+};
+
+#elif defined(STM32F412Cx) || defined(STM32F412Zx) || defined(STM32F412Rx) || defined(STM32F412Vx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM9,
+    ISR_TIM1_UP_TIM10,
+    ISR_TIM1_TRG_COM_TIM11,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_OTG_FS_WKUP,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FSMC,
+    ISR_SDIO,
+    ISR_TIM5,
+    ISR_SPI3,
+    0,
+    0,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_CAN2_TX,
+    ISR_CAN2_RX0,
+    ISR_CAN2_RX1,
+    ISR_CAN2_SCE,
+    ISR_OTG_FS,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_RNG,
+    ISR_FPU,
+    0,
+    0,
+    ISR_SPI4,
+    ISR_SPI5,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_QUADSPI,
+    0,
+    0,
+    ISR_FMPI2C1_EV,
+    ISR_FMPI2C1_ER
+};
+
+#elif defined(STM32F413xx) || defined(STM32F423xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM9,
+    ISR_TIM1_UP_TIM10,
+    ISR_TIM1_TRG_COM_TIM11,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_OTG_FS_WKUP,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FSMC,
+    ISR_SDIO,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_CAN2_TX,
+    ISR_CAN2_RX0,
+    ISR_CAN2_RX1,
+    ISR_CAN2_SCE,
+    ISR_OTG_FS,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_CAN3_TX,
+    ISR_CAN3_RX0,
+    ISR_CAN3_RX1,
+    ISR_CAN3_SCE,
+    0,
+    ISR_AES,
+    ISR_RNG,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    0,
+    ISR_SAI1,
+    ISR_UART9,
+    ISR_UART10,
+    0,
+    0,
+    ISR_QUADSPI,
+    0,
+    0,
+    ISR_FMPI2C1_EV,
+    ISR_FMPI2C1_ER,
+    ISR_LPTIM1,
+    ISR_DFSDM2_FLT0,
+    ISR_DFSDM2_FLT1,
+    ISR_DFSDM2_FLT2,
+    ISR_DFSDM2_FLT3
+};
+
+#elif defined(STM32F427xx) || defined(STM32F437xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM9,
+    ISR_TIM1_UP_TIM10,
+    ISR_TIM1_TRG_COM_TIM11,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_OTG_FS_WKUP,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDIO,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_CAN2_TX,
+    ISR_CAN2_RX0,
+    ISR_CAN2_RX1,
+    ISR_CAN2_SCE,
+    ISR_OTG_FS,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_OTG_HS_EP1_OUT,
+    ISR_OTG_HS_EP1_IN,
+    ISR_OTG_HS_WKUP,
+    ISR_OTG_HS,
+    ISR_DCMI,
+    ISR_CRYP,
+    ISR_HASH_RNG,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    0,
+    0,
+    ISR_DMA2D
+};
+
+#elif defined(STM32F429xx) || defined(STM32F439xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM9,
+    ISR_TIM1_UP_TIM10,
+    ISR_TIM1_TRG_COM_TIM11,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_OTG_FS_WKUP,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDIO,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_CAN2_TX,
+    ISR_CAN2_RX0,
+    ISR_CAN2_RX1,
+    ISR_CAN2_SCE,
+    ISR_OTG_FS,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_OTG_HS_EP1_OUT,
+    ISR_OTG_HS_EP1_IN,
+    ISR_OTG_HS_WKUP,
+    ISR_OTG_HS,
+    ISR_DCMI,
+    ISR_CRYP,
+    ISR_HASH_RNG,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_DMA2D
+};
+
+#elif defined(STM32F446xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM9,
+    ISR_TIM1_UP_TIM10,
+    ISR_TIM1_TRG_COM_TIM11,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_OTG_FS_WKUP,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDIO,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    0,
+    0,
+    ISR_CAN2_TX,
+    ISR_CAN2_RX0,
+    ISR_CAN2_RX1,
+    ISR_CAN2_SCE,
+    ISR_OTG_FS,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_OTG_HS_EP1_OUT,
+    ISR_OTG_HS_EP1_IN,
+    ISR_OTG_HS_WKUP,
+    ISR_OTG_HS,
+    ISR_DCMI,
+    0,
+    0,
+    ISR_FPU,
+    0,
+    0,
+    ISR_SPI4,
+    0,
+    0,
+    ISR_SAI1,
+    0,
+    0,
+    0,
+    ISR_SAI2,
+    ISR_QUADSPI,
+    ISR_CEC,
+    ISR_SPDIF_RX,
+    ISR_FMPI2C1_EV,
+    ISR_FMPI2C1_ER
+};
+
+#elif defined(STM32F469xx) || defined(STM32F479xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM9,
+    ISR_TIM1_UP_TIM10,
+    ISR_TIM1_TRG_COM_TIM11,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_OTG_FS_WKUP,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDIO,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_CAN2_TX,
+    ISR_CAN2_RX0,
+    ISR_CAN2_RX1,
+    ISR_CAN2_SCE,
+    ISR_OTG_FS,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_OTG_HS_EP1_OUT,
+    ISR_OTG_HS_EP1_IN,
+    ISR_OTG_HS_WKUP,
+    ISR_OTG_HS,
+    ISR_DCMI,
+    ISR_CRYP,
+    ISR_HASH_RNG,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_DMA2D,
+    ISR_QUADSPI,
+    ISR_DSI
+};
+
+#else
+#error "ISR vectors table is not defined for the target device"
+#endif
 
 /* ================================================================================================================================ */
@@ -2,12 +2,14 @@
  * @file       stm32g0xx.c
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
- * @date       Tuesday, 6th July 2021 1:51:11 pm
- * @modified   Tuesday, 6th July 2021 1:51:11 pm
+ * @date       Saturday, 17th October 2026 9:58:30 pm
+ * @modified   Saturday, 17th October 2026 9:58:30 pm
  * @project    stm-utils
- * @brief      Definitions of interrupt vectors for STMG0xx devices
- *    
- * @copyright Krzysztof Pierczyk © 2022
+ * @brief      Definitions of interrupt vectors for STM32G0xx devices
+ *
+ * @note Generated by scripts/generate_vectors.py, do not edit
+ *
+ * @copyright Krzysztof Pierczyk © 2026
  * /// ============================================================================================================================ */
 
 /* =========================================================== Includes =========================================================== */
@@ -23,121 +25,361 @@
  */
 
 // Exception vector's definitions
-ISR_VECTOR       (EXC_NMI);
-ISR_VECTOR       (EXC_HardFault);
-ISR_VECTOR       (EXC_MemoryManagement);
-ISR_VECTOR       (SVC_Handler);
-ISR_VECTOR       (PendSV_Handler);
-ISR_VECTOR       (SysTick_Handler);
+ISR_VECTOR           (EXC_NMI);
+ISR_VECTOR           (EXC_HardFault);
+ISR_VECTOR           (SVC_Handler);
+ISR_VECTOR           (PendSV_Handler);
+ISR_VECTOR           (SysTick_Handler);
 
 // ISR Vector's definitions
-ISR_VECTOR       (ISR_WWDG);
-ISR_VECTOR       (ISR_RTC_TAMP);
-ISR_VECTOR       (ISR_FLASH);
-ISR_VECTOR       (ISR_RCC);
-ISR_VECTOR_FORCED(ISR_EXTI0_1);
-ISR_VECTOR_FORCED(ISR_EXTI2_3);
-ISR_VECTOR_FORCED(ISR_EXTI4_15);
-ISR_VECTOR       (ISR_DMA1_Channel1);
-ISR_VECTOR       (ISR_DMA1_Channel2_3);
-ISR_VECTOR       (ISR_DMA1_Ch4_5_DMAMUX1_OVR);
-ISR_VECTOR       (ISR_ADC1);
-ISR_VECTOR       (ISR_TIM1_BRK_UP_TRG_COM);
-ISR_VECTOR       (ISR_TIM1_CC);
-ISR_VECTOR       (ISR_TIM3);
-ISR_VECTOR       (ISR_TIM14);
-ISR_VECTOR       (ISR_TIM16);
-ISR_VECTOR       (ISR_TIM17);
-ISR_VECTOR       (ISR_I2C1);
-ISR_VECTOR       (ISR_I2C2);
-ISR_VECTOR       (ISR_SPI1);
-ISR_VECTOR       (ISR_SPI2);
-ISR_VECTOR       (ISR_USART1);
-ISR_VECTOR       (ISR_USART2);
+ISR_VECTOR_FORCED    (ISR_EXTI0_1);
+ISR_VECTOR_FORCED    (ISR_EXTI2_3);
+ISR_VECTOR_FORCED    (ISR_EXTI4_15);
+ISR_VECTOR_DISPATCHER(ISR_DMA1_Channel2_3);
+ISR_VECTOR_DISPATCHER(ISR_DMA1_Ch4_5_DMAMUX1_OVR);
+ISR_VECTOR_DISPATCHER(ISR_DMA1_Ch4_7_DMAMUX1_OVR);
+ISR_VECTOR_DISPATCHER(ISR_TIM6_DAC_LPTIM1);
+ISR_VECTOR_DISPATCHER(ISR_TIM7_LPTIM2);
+ISR_VECTOR_DISPATCHER(ISR_DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR);
+ISR_VECTOR_DISPATCHER(ISR_TIM3_TIM4);
+ISR_VECTOR           (ISR_WWDG);
+ISR_VECTOR           (ISR_RTC_TAMP);
+ISR_VECTOR           (ISR_FLASH);
+ISR_VECTOR           (ISR_RCC);
+ISR_VECTOR           (ISR_DMA1_Channel1);
+ISR_VECTOR           (ISR_ADC1);
+ISR_VECTOR           (ISR_TIM1_BRK_UP_TRG_COM);
+ISR_VECTOR           (ISR_TIM1_CC);
+ISR_VECTOR           (ISR_TIM2);
+ISR_VECTOR           (ISR_TIM3);
+ISR_VECTOR           (ISR_TIM14);
+ISR_VECTOR           (ISR_TIM16);
+ISR_VECTOR           (ISR_TIM17);
+ISR_VECTOR           (ISR_I2C1);
+ISR_VECTOR           (ISR_I2C2);
+ISR_VECTOR           (ISR_SPI1);
+ISR_VECTOR           (ISR_SPI2);
+ISR_VECTOR           (ISR_USART1);
+ISR_VECTOR           (ISR_USART2);
+ISR_VECTOR           (ISR_CEC);
+ISR_VECTOR           (ISR_PVD);
+ISR_VECTOR           (ISR_USART3_4_LPUART1);
+ISR_VECTOR           (ISR_AES_RNG);
+ISR_VECTOR           (ISR_TIM6);
+ISR_VECTOR           (ISR_TIM7);
+ISR_VECTOR           (ISR_TIM15);
+ISR_VECTOR           (ISR_SPI2_3);
+ISR_VECTOR           (ISR_ADC1_COMP);
+ISR_VECTOR           (ISR_UCPD1_2);
+ISR_VECTOR           (ISR_USART3_4);
+ISR_VECTOR           (ISR_RNG);
+ISR_VECTOR           (ISR_USART3_4_5_6);
+ISR_VECTOR           (ISR_RCC_CRS);
+ISR_VECTOR           (ISR_USB_UCPD1_2);
+ISR_VECTOR           (ISR_I2C2_3);
+ISR_VECTOR           (ISR_USART2_LPUART2);
+ISR_VECTOR           (ISR_USART3_4_5_6_LPUART1);
+
+/* ======================================================== Legacy vectors ======================================================== */
+
+// Vectors under legacy names (handlers defined by the application under these names are called by default
+// handlers of renamed vectors and replace dispatchers of renamed shared interrupts)
+ISR_VECTOR           (EXC_MemoryManagement);
+
+// Renamed vectors
 
 /* ========================================================= Pseud-vectors ======================================================== */
 
 // Pseudo-ISR vectors
-ISR_VECTOR       (ISR_EXTI0);
-ISR_VECTOR       (ISR_EXTI1);
-ISR_VECTOR       (ISR_EXTI2);
-ISR_VECTOR       (ISR_EXTI3);
-ISR_VECTOR       (ISR_EXTI4);
-ISR_VECTOR       (ISR_EXTI5);
-ISR_VECTOR       (ISR_EXTI6);
-ISR_VECTOR       (ISR_EXTI7);
-ISR_VECTOR       (ISR_EXTI8);
-ISR_VECTOR       (ISR_EXTI9);
-ISR_VECTOR       (ISR_EXTI10);
-ISR_VECTOR       (ISR_EXTI11);
-ISR_VECTOR       (ISR_EXTI12);
-ISR_VECTOR       (ISR_EXTI13);
-ISR_VECTOR       (ISR_EXTI14);
-ISR_VECTOR       (ISR_EXTI15);
+ISR_VECTOR           (ISR_EXTI0);
+ISR_VECTOR           (ISR_EXTI1);
+ISR_VECTOR           (ISR_EXTI2);
+ISR_VECTOR           (ISR_EXTI3);
+ISR_VECTOR           (ISR_EXTI4);
+ISR_VECTOR           (ISR_EXTI5);
+ISR_VECTOR           (ISR_EXTI6);
+ISR_VECTOR           (ISR_EXTI7);
+ISR_VECTOR           (ISR_EXTI8);
+ISR_VECTOR           (ISR_EXTI9);
+ISR_VECTOR           (ISR_EXTI10);
+ISR_VECTOR           (ISR_EXTI11);
+ISR_VECTOR           (ISR_EXTI12);
+ISR_VECTOR           (ISR_EXTI13);
+ISR_VECTOR           (ISR_EXTI14);
+ISR_VECTOR           (ISR_EXTI15);
+ISR_VECTOR           (ISR_DMA1_Channel2);
+ISR_VECTOR           (ISR_DMA1_Channel3);
+ISR_VECTOR           (ISR_DMA1_Channel4);
+ISR_VECTOR           (ISR_DMA1_Channel5);
+ISR_VECTOR           (ISR_DMAMUX1_OVR);
+ISR_VECTOR           (ISR_DMA1_Channel6);
+ISR_VECTOR           (ISR_DMA1_Channel7);
+ISR_VECTOR           (ISR_DAC);
+ISR_VECTOR           (ISR_LPTIM1);
+ISR_VECTOR           (ISR_LPTIM2);
+ISR_VECTOR           (ISR_DMA2_Channel1);
+ISR_VECTOR           (ISR_DMA2_Channel2);
+ISR_VECTOR           (ISR_DMA2_Channel3);
+ISR_VECTOR           (ISR_DMA2_Channel4);
+ISR_VECTOR           (ISR_DMA2_Channel5);
+ISR_VECTOR           (ISR_TIM4);
 
 /* ================================================= Emulated vectors definitions ================================================= */
 
+// Pending flags of the EXTI lines enabled for the current core
+#define EXTI_PENDING ((EXTI->RPR1 | EXTI->FPR1) & EXTI->IMR1)
+
+// Default handlers of the EXTI lines (indexed by line number)
+const vector_function_ptr exti_default_handlers[16] = {
+    ISR_EXTI0,
+    ISR_EXTI1,
+    ISR_EXTI2,
+    ISR_EXTI3,
+    ISR_EXTI4,
+    ISR_EXTI5,
+    ISR_EXTI6,
+    ISR_EXTI7,
+    ISR_EXTI8,
+    ISR_EXTI9,
+    ISR_EXTI10,
+    ISR_EXTI11,
+    ISR_EXTI12,
+    ISR_EXTI13,
+    ISR_EXTI14,
+    ISR_EXTI15
+};
+
+// Handlers of the EXTI lines called by dispatchers (indexed by line number)
+exti_line_handler exti_line_handlers[16] = {
+    EXTI_DEFAULT_LINE_HANDLER(0),
+    EXTI_DEFAULT_LINE_HANDLER(1),
+    EXTI_DEFAULT_LINE_HANDLER(2),
+    EXTI_DEFAULT_LINE_HANDLER(3),
+    EXTI_DEFAULT_LINE_HANDLER(4),
+    EXTI_DEFAULT_LINE_HANDLER(5),
+    EXTI_DEFAULT_LINE_HANDLER(6),
+    EXTI_DEFAULT_LINE_HANDLER(7),
+    EXTI_DEFAULT_LINE_HANDLER(8),
+    EXTI_DEFAULT_LINE_HANDLER(9),
+    EXTI_DEFAULT_LINE_HANDLER(10),
+    EXTI_DEFAULT_LINE_HANDLER(11),
+    EXTI_DEFAULT_LINE_HANDLER(12),
+    EXTI_DEFAULT_LINE_HANDLER(13),
+    EXTI_DEFAULT_LINE_HANDLER(14),
+    EXTI_DEFAULT_LINE_HANDLER(15)
+};
+
+#if defined(STM32G030xx) || defined(STM32G031xx) || defined(STM32G041xx) || defined(STM32G050xx) || defined(STM32G070xx) || \
+    defined(STM32G071xx) || defined(STM32G081xx) || defined(STM32G0B0xx) || defined(STM32G0B1xx) || defined(STM32G0C1xx)
+
 // Dispatcher of the EXTI 0-1 lines
 void ISR_EXTI0_1(void) {
 
-    // Get EXTI pending flags
-	unsigned long flags = (EXTI->RPR1 | EXTI->FPR1);
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
 
     // Dispatch lines
-	if(ExtiPends(flags, 0))
-		ISR_EXTI0();
-	if(ExtiPends(flags, 1))
-		ISR_EXTI1();
+    exti_dispatch(flags & ExtiLines(0, 1), exti_line_handlers);
 }
 
 // Dispatcher of the EXTI 2-3 lines
 void ISR_EXTI2_3(void) {
 
-    // Get EXTI pending flags
-	unsigned long flags = (EXTI->RPR1 | EXTI->FPR1);
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
 
     // Dispatch lines
-	if(ExtiPends(flags, 2))
-		ISR_EXTI2();
-	if(ExtiPends(flags, 3))
-		ISR_EXTI3();
+    exti_dispatch(flags & ExtiLines(2, 3), exti_line_handlers);
 }
 
-// Dispatcher of the EXTI 4-5 lines
+// Dispatcher of the EXTI 4-15 lines
 void ISR_EXTI4_15(void) {
-	
-    // Get EXTI pending flags
-	unsigned long flags = (EXTI->RPR1 | EXTI->FPR1);
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
 
     // Dispatch lines
-	if(ExtiPends(flags, 4))
-		ISR_EXTI4();
-	if(ExtiPends(flags, 5))
-		ISR_EXTI5();
-	if(ExtiPends(flags, 6))
-		ISR_EXTI6();
-	if(ExtiPends(flags, 7))
-		ISR_EXTI7();
-	if(ExtiPends(flags, 8))
-		ISR_EXTI8();
-	if(ExtiPends(flags, 9))
-		ISR_EXTI9();
-	if(ExtiPends(flags, 10))
-		ISR_EXTI10();
-	if(ExtiPends(flags, 11))
-		ISR_EXTI11();
-	if(ExtiPends(flags, 12))
-		ISR_EXTI12();
-	if(ExtiPends(flags, 13))
-		ISR_EXTI13();
-	if(ExtiPends(flags, 14))
-		ISR_EXTI14();
-	if(ExtiPends(flags, 15))
-		ISR_EXTI15();
+    exti_dispatch(flags & ExtiLines(4, 15), exti_line_handlers);
+}
+
+#endif
+
+// Dispatcher of the DMA1_Channel2_3 interrupt
+void ISR_DMA1_Channel2_3(void) {
+
+    #if defined(DMA1)
+        // Get pending flags of the DMA1 channels with enabled interrupts
+        unsigned long dma1_flags = DMA1->ISR & (
+            DmaChannelEnabled(DMA1, 2) |
+            DmaChannelEnabled(DMA1, 3)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma1_vectors[] = { 0, ISR_DMA1_Channel2, ISR_DMA1_Channel3 };
+        isr_dispatch(dma1_flags, 2, dma1_vectors);
+    #endif
+}
+
+#if defined(STM32G030xx) || defined(STM32G031xx) || defined(STM32G041xx)
+
+// Dispatcher of the DMA1_Ch4_5_DMAMUX1_OVR interrupt
+void ISR_DMA1_Ch4_5_DMAMUX1_OVR(void) {
+
+    #if defined(DMA1)
+        // Get pending flags of the DMA1 channels with enabled interrupts
+        unsigned long dma1_flags = DMA1->ISR & (
+            DmaChannelEnabled(DMA1, 4) |
+            DmaChannelEnabled(DMA1, 5)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma1_vectors[] = { 0, 0, 0, ISR_DMA1_Channel4, ISR_DMA1_Channel5 };
+        isr_dispatch(dma1_flags, 2, dma1_vectors);
+    #endif
+
+    #if defined(DMAMUX1_ChannelStatus)
+        // Dispatch overrun of the DMAMUX1
+        if(DMAMUX1_ChannelStatus->CSR | DMAMUX1_RequestGenStatus->RGSR)
+            ISR_DMAMUX1_OVR();
+    #endif
+}
+
+#endif
+
+#if defined(STM32G050xx) || defined(STM32G051xx) || defined(STM32G061xx) || defined(STM32G070xx) || defined(STM32G071xx) || \
+    defined(STM32G081xx)
+
+// Dispatcher of the DMA1_Ch4_7_DMAMUX1_OVR interrupt
+void ISR_DMA1_Ch4_7_DMAMUX1_OVR(void) {
+
+    #if defined(DMA1)
+        // Get pending flags of the DMA1 channels with enabled interrupts
+        unsigned long dma1_flags = DMA1->ISR & (
+            DmaChannelEnabled(DMA1, 4) |
+            DmaChannelEnabled(DMA1, 5) |
+            DmaChannelEnabled(DMA1, 6) |
+            DmaChannelEnabled(DMA1, 7)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma1_vectors[] = { 0, 0, 0, ISR_DMA1_Channel4, ISR_DMA1_Channel5, ISR_DMA1_Channel6, ISR_DMA1_Channel7 };
+        isr_dispatch(dma1_flags, 2, dma1_vectors);
+    #endif
+
+    #if defined(DMAMUX1_ChannelStatus)
+        // Dispatch overrun of the DMAMUX1
+        if(DMAMUX1_ChannelStatus->CSR | DMAMUX1_RequestGenStatus->RGSR)
+            ISR_DMAMUX1_OVR();
+    #endif
+}
+
+#endif
+
+#if defined(STM32G051xx) || defined(STM32G061xx) || defined(STM32G071xx) || defined(STM32G081xx) || defined(STM32G0B1xx) || \
+    defined(STM32G0C1xx)
+
+// Dispatcher of the TIM6_DAC_LPTIM1 interrupt
+void ISR_TIM6_DAC_LPTIM1(void) {
+
+    #if defined(TIM6)
+        // Dispatch TIM6
+        if(TimPends(TIM6, 0xFFUL))
+            ISR_TIM6();
+    #endif
+
+    #if defined(DAC1)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC1))
+            ISR_DAC();
+    #elif defined(DAC)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC))
+            ISR_DAC();
+    #endif
+
+    #if defined(LPTIM1)
+        // Dispatch LPTIM1
+        if(LPTIM1->ISR & LPTIM1->IER)
+            ISR_LPTIM1();
+    #endif
 }
 
+// Dispatcher of the TIM7_LPTIM2 interrupt
+void ISR_TIM7_LPTIM2(void) {
+
+    #if defined(TIM7)
+        // Dispatch TIM7
+        if(TimPends(TIM7, 0xFFUL))
+            ISR_TIM7();
+    #endif
+
+    #if defined(LPTIM2)
+        // Dispatch LPTIM2
+        if(LPTIM2->ISR & LPTIM2->IER)
+            ISR_LPTIM2();
+    #endif
+}
+
+#endif
+
+#if defined(STM32G0B0xx) || defined(STM32G0B1xx) || defined(STM32G0C1xx)
+
+// Dispatcher of the DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR interrupt
+void ISR_DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR(void) {
+
+    #if defined(DMA1)
+        // Get pending flags of the DMA1 channels with enabled interrupts
+        unsigned long dma1_flags = DMA1->ISR & (
+            DmaChannelEnabled(DMA1, 4) |
+            DmaChannelEnabled(DMA1, 5) |
+            DmaChannelEnabled(DMA1, 6) |
+            DmaChannelEnabled(DMA1, 7)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma1_vectors[] = { 0, 0, 0, ISR_DMA1_Channel4, ISR_DMA1_Channel5, ISR_DMA1_Channel6, ISR_DMA1_Channel7 };
+        isr_dispatch(dma1_flags, 2, dma1_vectors);
+    #endif
+
+    #if defined(DMA2)
+        // Get pending flags of the DMA2 channels with enabled interrupts
+        unsigned long dma2_flags = DMA2->ISR & (
+            DmaChannelEnabled(DMA2, 1) |
+            DmaChannelEnabled(DMA2, 2) |
+            DmaChannelEnabled(DMA2, 3) |
+            DmaChannelEnabled(DMA2, 4) |
+            DmaChannelEnabled(DMA2, 5)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma2_vectors[] = { ISR_DMA2_Channel1, ISR_DMA2_Channel2, ISR_DMA2_Channel3, ISR_DMA2_Channel4, ISR_DMA2_Channel5 };
+        isr_dispatch(dma2_flags, 2, dma2_vectors);
+    #endif
+
+    #if defined(DMAMUX1_ChannelStatus)
+        // Dispatch overrun of the DMAMUX1
+        if(DMAMUX1_ChannelStatus->CSR | DMAMUX1_RequestGenStatus->RGSR)
+            ISR_DMAMUX1_OVR();
+    #endif
+}
+
+// Dispatcher of the TIM3_TIM4 interrupt
+void ISR_TIM3_TIM4(void) {
+
+    #if defined(TIM3)
+        // Dispatch TIM3
+        if(TimPends(TIM3, 0xFFUL))
+            ISR_TIM3();
+    #endif
+
+    #if defined(TIM4)
+        // Dispatch TIM4
+        if(TimPends(TIM4, 0xFFUL))
+            ISR_TIM4();
+    #endif
+}
+
+#endif
+
 /* ======================================================== Vectors' table ======================================================== */
 
+#if defined(STM32G030xx)
+
 const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
 
     // Stack pointer
@@ -145,11 +387,11 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     // Reset handler
     reser_handler,
 
-    /* ----------------------------- Exception vectors ----------------------------- */    
+    /* ----------------------------- Exception vectors ----------------------------- */
 
     EXC_NMI,
     EXC_HardFault,
-    EXC_MemoryManagement,
+    0,
     0,
     0,
     0,
@@ -179,7 +421,129 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     ISR_ADC1,
     ISR_TIM1_BRK_UP_TRG_COM,
     ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    0,
+    0,
+    ISR_TIM14,
+    0,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    0,
+    ISR_CEC
+};
+
+#elif defined(STM32G031xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_RTC_TAMP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
+    0,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Ch4_5_DMAMUX1_OVR,
+    ISR_ADC1,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    0,
+    0,
+    ISR_TIM14,
+    0,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3_4_LPUART1,
+    ISR_CEC
+};
+
+#elif defined(STM32G041xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_RTC_TAMP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
     0,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Ch4_5_DMAMUX1_OVR,
+    ISR_ADC1,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
     ISR_TIM3,
     0,
     0,
@@ -193,7 +557,563 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     ISR_SPI2,
     ISR_USART1,
     ISR_USART2,
-    0
+    ISR_USART3_4_LPUART1,
+    ISR_CEC,
+    ISR_AES_RNG
+};
+
+#elif defined(STM32G050xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    0,
+    ISR_RTC_TAMP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
+    0,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Ch4_7_DMAMUX1_OVR,
+    ISR_ADC1,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    0,
+    ISR_TIM3,
+    ISR_TIM6,
+    ISR_TIM7,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_SPI1,
+    ISR_SPI2_3,
+    ISR_USART1,
+    ISR_USART2
 };
 
+#elif defined(STM32G051xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    0,
+    ISR_RTC_TAMP,
+    ISR_FLASH,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Ch4_7_DMAMUX1_OVR,
+    ISR_ADC1_COMP,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM6_DAC_LPTIM1,
+    ISR_TIM7_LPTIM2,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_SPI1,
+    ISR_SPI2_3,
+    ISR_USART1,
+    ISR_USART2,
+    0,
+    ISR_CEC
+};
+
+#elif defined(STM32G061xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_RTC_TAMP,
+    ISR_FLASH,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Ch4_7_DMAMUX1_OVR,
+    0,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM6_DAC_LPTIM1,
+    ISR_TIM7_LPTIM2,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    0,
+    0,
+    ISR_USART1,
+    ISR_USART2,
+    0,
+    ISR_CEC,
+    ISR_AES_RNG
+};
+
+#elif defined(STM32G070xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    0,
+    ISR_RTC_TAMP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
+    ISR_UCPD1_2,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Ch4_7_DMAMUX1_OVR,
+    ISR_ADC1,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM6,
+    ISR_TIM7,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3_4,
+    ISR_CEC
+};
+
+#elif defined(STM32G071xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_RTC_TAMP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
+    ISR_UCPD1_2,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Ch4_7_DMAMUX1_OVR,
+    ISR_ADC1_COMP,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM6_DAC_LPTIM1,
+    ISR_TIM7_LPTIM2,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3_4_LPUART1,
+    ISR_CEC,
+    ISR_RNG
+};
+
+#elif defined(STM32G081xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_RTC_TAMP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
+    ISR_UCPD1_2,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Ch4_7_DMAMUX1_OVR,
+    ISR_ADC1_COMP,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM6_DAC_LPTIM1,
+    ISR_TIM7_LPTIM2,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3_4_LPUART1,
+    ISR_CEC,
+    ISR_AES_RNG
+};
+
+#elif defined(STM32G0B0xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    0,
+    ISR_RTC_TAMP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
+    0,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR,
+    ISR_ADC1,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    0,
+    ISR_TIM3_TIM4,
+    ISR_TIM6,
+    ISR_TIM7,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_SPI1,
+    ISR_SPI2_3,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3_4_5_6
+};
+
+#elif defined(STM32G0B1xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_RTC_TAMP,
+    ISR_FLASH,
+    ISR_RCC_CRS,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
+    ISR_USB_UCPD1_2,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR,
+    ISR_ADC1_COMP,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3_TIM4,
+    ISR_TIM6_DAC_LPTIM1,
+    ISR_TIM7_LPTIM2,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2_3,
+    ISR_SPI1,
+    ISR_SPI2_3,
+    ISR_USART1,
+    ISR_USART2_LPUART2,
+    ISR_USART3_4_5_6_LPUART1,
+    ISR_CEC
+};
+
+#elif defined(STM32G0C1xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_RTC_TAMP,
+    ISR_FLASH,
+    ISR_RCC_CRS,
+    ISR_EXTI0_1,
+    ISR_EXTI2_3,
+    ISR_EXTI4_15,
+    ISR_USB_UCPD1_2,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2_3,
+    ISR_DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR,
+    ISR_ADC1_COMP,
+    ISR_TIM1_BRK_UP_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3_TIM4,
+    ISR_TIM6_DAC_LPTIM1,
+    ISR_TIM7_LPTIM2,
+    ISR_TIM14,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1,
+    ISR_I2C2_3,
+    ISR_SPI1,
+    ISR_SPI2_3,
+    ISR_USART1,
+    ISR_USART2_LPUART2,
+    ISR_USART3_4_5_6_LPUART1,
+    ISR_CEC,
+    ISR_AES_RNG
+};
+
+#else
+#error "ISR vectors table is not defined for the target device"
+#endif
+
 /* ================================================================================================================================ */
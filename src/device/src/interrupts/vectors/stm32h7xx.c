@@ -2,12 +2,16 @@
  * @file       stm32h7xx.c
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
- * @date       Thursday, 15th July 2021 10:14:58 am
- * @modified   Thursday, 15th July 2021 10:46:22 am
+ * @date       Saturday, 17th October 2026 9:58:35 pm
+ * @modified   Saturday, 17th October 2026 9:58:35 pm
  * @project    stm-utils
- * @brief      Definitions of interrupt vectors for STMH7xx devices
- *    
- * @copyright Krzysztof Pierczyk © 2022
+ * @brief      Definitions of interrupt vectors for STM32H7xx devices
+ *
+ * @note Generated by scripts/generate_vectors.py, do not edit
+ *
+ * @note Devices not described by SVD files: STM32H7A3xx, STM32H7A3xxQ, STM32H7B3xx, STM32H7B3xxQ, STM32H7B0xx, STM32H7B0xxQ
+ *
+ * @copyright Krzysztof Pierczyk © 2026
  * /// ============================================================================================================================ */
 
 /* =========================================================== Includes =========================================================== */
@@ -17,6 +21,2016 @@
 
 /* ========================================================== Definitions ========================================================= */
 
+/**
+ * @note Names for SVC_Handler, PendSV_Handler and SysTick_Handler interrupt
+ *    handlers was set differently to fit RTX-RTOSv5 naming scheme
+ */
 
+// Exception vector's definitions
+ISR_VECTOR           (EXC_NMI);
+ISR_VECTOR           (EXC_HardFault);
+ISR_VECTOR           (EXC_MemoryManagement);
+ISR_VECTOR           (EXC_BusFault);
+ISR_VECTOR           (EXC_UsageFault);
+ISR_VECTOR           (SVC_Handler);
+ISR_VECTOR           (EXC_DebugMonitor);
+ISR_VECTOR           (PendSV_Handler);
+ISR_VECTOR           (SysTick_Handler);
+
+// ISR Vector's definitions
+ISR_VECTOR_FORCED    (ISR_EXTI0_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI1_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI2_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI3_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI4_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI9_5);
+ISR_VECTOR_FORCED    (ISR_EXTI15_10);
+ISR_VECTOR_DISPATCHER(ISR_TIM8_BRK_TIM12);
+ISR_VECTOR_DISPATCHER(ISR_TIM8_UP_TIM13);
+ISR_VECTOR_DISPATCHER(ISR_TIM8_TRG_COM_TIM14);
+ISR_VECTOR_DISPATCHER(ISR_TIM6_DAC);
+ISR_VECTOR           (ISR_WWDG);
+ISR_VECTOR           (ISR_PVD_PVM);
+ISR_VECTOR           (ISR_TAMP_STAMP);
+ISR_VECTOR           (ISR_RTC_WKUP);
+ISR_VECTOR           (ISR_FLASH);
+ISR_VECTOR           (ISR_RCC);
+ISR_VECTOR           (ISR_DMA1_Stream0);
+ISR_VECTOR           (ISR_DMA1_Stream1);
+ISR_VECTOR           (ISR_DMA1_Stream2);
+ISR_VECTOR           (ISR_DMA1_Stream3);
+ISR_VECTOR           (ISR_DMA1_Stream4);
+ISR_VECTOR           (ISR_DMA1_Stream5);
+ISR_VECTOR           (ISR_DMA1_Stream6);
+ISR_VECTOR           (ISR_ADC1_2);
+ISR_VECTOR           (ISR_FDCAN1_IT0);
+ISR_VECTOR           (ISR_FDCAN2_IT0);
+ISR_VECTOR           (ISR_FDCAN1_IT1);
+ISR_VECTOR           (ISR_FDCAN2_IT1);
+ISR_VECTOR           (ISR_TIM1_BRK);
+ISR_VECTOR           (ISR_TIM1_UP);
+ISR_VECTOR           (ISR_TIM1_TRG_COM);
+ISR_VECTOR           (ISR_TIM1_CC);
+ISR_VECTOR           (ISR_TIM2);
+ISR_VECTOR           (ISR_TIM3);
+ISR_VECTOR           (ISR_TIM4);
+ISR_VECTOR           (ISR_I2C1_EV);
+ISR_VECTOR           (ISR_I2C1_ER);
+ISR_VECTOR           (ISR_I2C2_EV);
+ISR_VECTOR           (ISR_I2C2_ER);
+ISR_VECTOR           (ISR_SPI1);
+ISR_VECTOR           (ISR_SPI2);
+ISR_VECTOR           (ISR_USART1);
+ISR_VECTOR           (ISR_USART2);
+ISR_VECTOR           (ISR_USART3);
+ISR_VECTOR           (ISR_RTC_Alarm);
+ISR_VECTOR           (ISR_TIM8_CC);
+ISR_VECTOR           (ISR_DMA1_Stream7);
+ISR_VECTOR           (ISR_FMC);
+ISR_VECTOR           (ISR_SDMMC1);
+ISR_VECTOR           (ISR_TIM5);
+ISR_VECTOR           (ISR_SPI3);
+ISR_VECTOR           (ISR_UART4);
+ISR_VECTOR           (ISR_UART5);
+ISR_VECTOR           (ISR_TIM7);
+ISR_VECTOR           (ISR_DMA2_Stream0);
+ISR_VECTOR           (ISR_DMA2_Stream1);
+ISR_VECTOR           (ISR_DMA2_Stream2);
+ISR_VECTOR           (ISR_DMA2_Stream3);
+ISR_VECTOR           (ISR_DMA2_Stream4);
+ISR_VECTOR           (ISR_ETH);
+ISR_VECTOR           (ISR_ETH_WKUP);
+ISR_VECTOR           (ISR_FDCAN_CAL);
+ISR_VECTOR           (ISR_DMA2_Stream5);
+ISR_VECTOR           (ISR_DMA2_Stream6);
+ISR_VECTOR           (ISR_DMA2_Stream7);
+ISR_VECTOR           (ISR_USART6);
+ISR_VECTOR           (ISR_I2C3_EV);
+ISR_VECTOR           (ISR_I2C3_ER);
+ISR_VECTOR           (ISR_DCMI);
+ISR_VECTOR           (ISR_FPU);
+ISR_VECTOR           (ISR_UART7);
+ISR_VECTOR           (ISR_UART8);
+ISR_VECTOR           (ISR_SPI4);
+ISR_VECTOR           (ISR_SPI5);
+ISR_VECTOR           (ISR_SPI6);
+ISR_VECTOR           (ISR_SAI1);
+ISR_VECTOR           (ISR_LTDC);
+ISR_VECTOR           (ISR_LTDC_ER);
+ISR_VECTOR           (ISR_DMA2D);
+ISR_VECTOR           (ISR_OCTOSPI1);
+ISR_VECTOR           (ISR_LPTIM1);
+ISR_VECTOR           (ISR_CEC);
+ISR_VECTOR           (ISR_I2C4_EV);
+ISR_VECTOR           (ISR_I2C4_ER);
+ISR_VECTOR           (ISR_SPDIF_RX);
+ISR_VECTOR           (ISR_DMAMUX1_OVR);
+ISR_VECTOR           (ISR_DFSDM1_FLT0);
+ISR_VECTOR           (ISR_DFSDM1_FLT1);
+ISR_VECTOR           (ISR_DFSDM1_FLT2);
+ISR_VECTOR           (ISR_DFSDM1_FLT3);
+ISR_VECTOR           (ISR_SWPMI1);
+ISR_VECTOR           (ISR_TIM15);
+ISR_VECTOR           (ISR_TIM16);
+ISR_VECTOR           (ISR_TIM17);
+ISR_VECTOR           (ISR_MDIOS_WKUP);
+ISR_VECTOR           (ISR_MDIOS);
+ISR_VECTOR           (ISR_MDMA);
+ISR_VECTOR           (ISR_SDMMC2);
+ISR_VECTOR           (ISR_HSEM1);
+ISR_VECTOR           (ISR_ADC3);
+ISR_VECTOR           (ISR_DMAMUX2_OVR);
+ISR_VECTOR           (ISR_COMP);
+ISR_VECTOR           (ISR_LPTIM2);
+ISR_VECTOR           (ISR_LPTIM3);
+ISR_VECTOR           (ISR_LPTIM4);
+ISR_VECTOR           (ISR_LPTIM5);
+ISR_VECTOR           (ISR_LPUART1);
+ISR_VECTOR           (ISR_CRS);
+ISR_VECTOR           (ISR_SAI4);
+ISR_VECTOR           (ISR_WAKEUP_PIN);
+ISR_VECTOR           (ISR_OCTOSPI2);
+ISR_VECTOR           (ISR_FMAC);
+ISR_VECTOR           (ISR_CORDIC);
+ISR_VECTOR           (ISR_USART10);
+ISR_VECTOR           (ISR_I2C5_EV);
+ISR_VECTOR           (ISR_I2C5_ER);
+ISR_VECTOR           (ISR_FDCAN3_IT0);
+ISR_VECTOR           (ISR_FDCAN3_IT1);
+ISR_VECTOR           (ISR_TIM23);
+ISR_VECTOR           (ISR_TIM24);
+ISR_VECTOR           (ISR_OTFDEC1);
+ISR_VECTOR           (ISR_OTFDEC2);
+ISR_VECTOR           (ISR_CRYP);
+ISR_VECTOR           (ISR_OTG_HS_EP1_OUT);
+ISR_VECTOR           (ISR_OTG_HS_EP1_IN);
+ISR_VECTOR           (ISR_OTG_HS_WKUP);
+ISR_VECTOR           (ISR_OTG_HS);
+ISR_VECTOR           (ISR_SAI2);
+ISR_VECTOR           (ISR_QUADSPI);
+ISR_VECTOR           (ISR_OTG_FS_EP1_OUT);
+ISR_VECTOR           (ISR_OTG_FS_EP1_IN);
+ISR_VECTOR           (ISR_OTG_FS_WKUP);
+ISR_VECTOR           (ISR_OTG_FS);
+ISR_VECTOR           (ISR_HRTIM1_MST);
+ISR_VECTOR           (ISR_HRTIM1_TIMA);
+ISR_VECTOR           (ISR_HRTIM1_TIMB);
+ISR_VECTOR           (ISR_HRTIM1_TIMC);
+ISR_VECTOR           (ISR_HRTIM1_TIMD);
+ISR_VECTOR           (ISR_HRTIM1_TIME);
+ISR_VECTOR           (ISR_HRTIM1_FLT);
+ISR_VECTOR           (ISR_SAI3);
+ISR_VECTOR           (ISR_JPEG);
+ISR_VECTOR           (ISR_BDMA_Channel0);
+ISR_VECTOR           (ISR_BDMA_Channel1);
+ISR_VECTOR           (ISR_BDMA_Channel2);
+ISR_VECTOR           (ISR_BDMA_Channel3);
+ISR_VECTOR           (ISR_BDMA_Channel4);
+ISR_VECTOR           (ISR_BDMA_Channel5);
+ISR_VECTOR           (ISR_BDMA_Channel6);
+ISR_VECTOR           (ISR_BDMA_Channel7);
+ISR_VECTOR           (ISR_WWDG_RST);
+ISR_VECTOR           (ISR_CM7_SEV);
+ISR_VECTOR           (ISR_HSEM2);
+ISR_VECTOR           (ISR_HOLD_CORE);
+ISR_VECTOR           (ISR_CM4_SEV);
+ISR_VECTOR           (ISR_HASH_RNG);
+
+/* ========================================================= Pseud-vectors ======================================================== */
+
+// Pseudo-ISR vectors
+ISR_VECTOR           (ISR_EXTI0);
+ISR_VECTOR           (ISR_EXTI1);
+ISR_VECTOR           (ISR_EXTI2);
+ISR_VECTOR           (ISR_EXTI3);
+ISR_VECTOR           (ISR_EXTI4);
+ISR_VECTOR           (ISR_EXTI5);
+ISR_VECTOR           (ISR_EXTI6);
+ISR_VECTOR           (ISR_EXTI7);
+ISR_VECTOR           (ISR_EXTI8);
+ISR_VECTOR           (ISR_EXTI9);
+ISR_VECTOR           (ISR_EXTI10);
+ISR_VECTOR           (ISR_EXTI11);
+ISR_VECTOR           (ISR_EXTI12);
+ISR_VECTOR           (ISR_EXTI13);
+ISR_VECTOR           (ISR_EXTI14);
+ISR_VECTOR           (ISR_EXTI15);
+ISR_VECTOR           (ISR_TIM8_BRK);
+ISR_VECTOR           (ISR_TIM12);
+ISR_VECTOR           (ISR_TIM8_UP);
+ISR_VECTOR           (ISR_TIM13);
+ISR_VECTOR           (ISR_TIM8_TRG_COM);
+ISR_VECTOR           (ISR_TIM14);
+ISR_VECTOR           (ISR_TIM6);
+ISR_VECTOR           (ISR_DAC);
+
+/* ================================================= Emulated vectors definitions ================================================= */
+
+// Pending flags of the EXTI lines enabled for the current core
+#if defined(CORE_CM4)
+#define EXTI_PENDING (EXTI_D2->PR1 & EXTI_D2->IMR1)
+#else
+#define EXTI_PENDING (EXTI_D1->PR1 & EXTI_D1->IMR1)
+#endif
+
+// Default handlers of the EXTI lines (indexed by line number)
+const vector_function_ptr exti_default_handlers[16] = {
+    ISR_EXTI0,
+    ISR_EXTI1,
+    ISR_EXTI2,
+    ISR_EXTI3,
+    ISR_EXTI4,
+    ISR_EXTI5,
+    ISR_EXTI6,
+    ISR_EXTI7,
+    ISR_EXTI8,
+    ISR_EXTI9,
+    ISR_EXTI10,
+    ISR_EXTI11,
+    ISR_EXTI12,
+    ISR_EXTI13,
+    ISR_EXTI14,
+    ISR_EXTI15
+};
+
+// Handlers of the EXTI lines called by dispatchers (indexed by line number)
+exti_line_handler exti_line_handlers[16] = {
+    EXTI_DEFAULT_LINE_HANDLER(0),
+    EXTI_DEFAULT_LINE_HANDLER(1),
+    EXTI_DEFAULT_LINE_HANDLER(2),
+    EXTI_DEFAULT_LINE_HANDLER(3),
+    EXTI_DEFAULT_LINE_HANDLER(4),
+    EXTI_DEFAULT_LINE_HANDLER(5),
+    EXTI_DEFAULT_LINE_HANDLER(6),
+    EXTI_DEFAULT_LINE_HANDLER(7),
+    EXTI_DEFAULT_LINE_HANDLER(8),
+    EXTI_DEFAULT_LINE_HANDLER(9),
+    EXTI_DEFAULT_LINE_HANDLER(10),
+    EXTI_DEFAULT_LINE_HANDLER(11),
+    EXTI_DEFAULT_LINE_HANDLER(12),
+    EXTI_DEFAULT_LINE_HANDLER(13),
+    EXTI_DEFAULT_LINE_HANDLER(14),
+    EXTI_DEFAULT_LINE_HANDLER(15)
+};
+
+// Dispatchers of the EXTI lines with dedicated vectors
+ISR_EXTI_LINE_DISPATCHER(0)
+ISR_EXTI_LINE_DISPATCHER(1)
+ISR_EXTI_LINE_DISPATCHER(2)
+ISR_EXTI_LINE_DISPATCHER(3)
+ISR_EXTI_LINE_DISPATCHER(4)
+
+// Dispatcher of the EXTI 5-9 lines
+void ISR_EXTI9_5(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(5, 9), exti_line_handlers);
+}
+
+// Dispatcher of the EXTI 10-15 lines
+void ISR_EXTI15_10(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(10, 15), exti_line_handlers);
+}
+
+// Dispatcher of the TIM8_BRK_TIM12 interrupt
+void ISR_TIM8_BRK_TIM12(void) {
+
+    #if defined(TIM8)
+        // Dispatch BRK events of TIM8
+        if(TimPends(TIM8, TIM_SR_BIF))
+            ISR_TIM8_BRK();
+    #endif
+
+    #if defined(TIM12)
+        // Dispatch TIM12
+        if(TimPends(TIM12, 0xFFUL))
+            ISR_TIM12();
+    #endif
+}
+
+// Dispatcher of the TIM8_UP_TIM13 interrupt
+void ISR_TIM8_UP_TIM13(void) {
+
+    #if defined(TIM8)
+        // Dispatch UP events of TIM8
+        if(TimPends(TIM8, TIM_SR_UIF))
+            ISR_TIM8_UP();
+    #endif
+
+    #if defined(TIM13)
+        // Dispatch TIM13
+        if(TimPends(TIM13, 0xFFUL))
+            ISR_TIM13();
+    #endif
+}
+
+// Dispatcher of the TIM8_TRG_COM_TIM14 interrupt
+void ISR_TIM8_TRG_COM_TIM14(void) {
+
+    #if defined(TIM8)
+        // Dispatch TRG COM events of TIM8
+        if(TimPends(TIM8, TIM_SR_TIF | TIM_SR_COMIF))
+            ISR_TIM8_TRG_COM();
+    #endif
+
+    #if defined(TIM14)
+        // Dispatch TIM14
+        if(TimPends(TIM14, 0xFFUL))
+            ISR_TIM14();
+    #endif
+}
+
+// Dispatcher of the TIM6_DAC interrupt
+void ISR_TIM6_DAC(void) {
+
+    #if defined(TIM6)
+        // Dispatch TIM6
+        if(TimPends(TIM6, 0xFFUL))
+            ISR_TIM6();
+    #endif
+
+    #if defined(DAC1)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC1))
+            ISR_DAC();
+    #elif defined(DAC)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC))
+            ISR_DAC();
+    #endif
+}
+
+/* ======================================================== Vectors' table ======================================================== */
+
+#if defined(STM32H723xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC1_2,
+    ISR_FDCAN1_IT0,
+    ISR_FDCAN2_IT0,
+    ISR_FDCAN1_IT1,
+    ISR_FDCAN2_IT1,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_FDCAN_CAL,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    0,
+    0,
+    0,
+    0,
+    ISR_DCMI,
+    0,
+    0,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_DMA2D,
+    0,
+    ISR_OCTOSPI1,
+    ISR_LPTIM1,
+    ISR_CEC,
+    ISR_I2C4_EV,
+    ISR_I2C4_ER,
+    ISR_SPDIF_RX,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMAMUX1_OVR,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_DFSDM1_FLT3,
+    0,
+    ISR_SWPMI1,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_MDIOS_WKUP,
+    ISR_MDIOS,
+    0,
+    ISR_MDMA,
+    0,
+    ISR_SDMMC2,
+    ISR_HSEM1,
+    0,
+    ISR_ADC3,
+    ISR_DMAMUX2_OVR,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_COMP,
+    ISR_LPTIM2,
+    ISR_LPTIM3,
+    ISR_LPTIM4,
+    ISR_LPTIM5,
+    ISR_LPUART1,
+    0,
+    ISR_CRS,
+    0,
+    ISR_SAI4,
+    0,
+    0,
+    ISR_WAKEUP_PIN,
+    ISR_OCTOSPI2,
+    0,
+    0,
+    ISR_FMAC,
+    ISR_CORDIC,
+    0,
+    ISR_USART10,
+    ISR_I2C5_EV,
+    ISR_I2C5_ER,
+    ISR_FDCAN3_IT0,
+    ISR_FDCAN3_IT1,
+    ISR_TIM23,
+    ISR_TIM24
+};
+
+#elif defined(STM32H725xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC1_2,
+    ISR_FDCAN1_IT0,
+    ISR_FDCAN2_IT0,
+    ISR_FDCAN1_IT1,
+    ISR_FDCAN2_IT1,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_FDCAN_CAL,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    0,
+    0,
+    0,
+    0,
+    ISR_DCMI,
+    0,
+    0,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_DMA2D,
+    0,
+    ISR_OCTOSPI1,
+    ISR_LPTIM1,
+    ISR_CEC,
+    ISR_I2C4_EV,
+    ISR_I2C4_ER,
+    ISR_SPDIF_RX,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMAMUX1_OVR,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_DFSDM1_FLT3,
+    0,
+    ISR_SWPMI1,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_MDIOS_WKUP,
+    ISR_MDIOS,
+    0,
+    ISR_MDMA,
+    0,
+    ISR_SDMMC2,
+    ISR_HSEM1,
+    0,
+    ISR_ADC3,
+    ISR_DMAMUX2_OVR,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_COMP,
+    ISR_LPTIM2,
+    ISR_LPTIM3,
+    ISR_LPTIM4,
+    ISR_LPTIM5,
+    ISR_LPUART1,
+    0,
+    ISR_CRS,
+    0,
+    ISR_SAI4,
+    0,
+    0,
+    ISR_WAKEUP_PIN,
+    ISR_OCTOSPI2,
+    ISR_OTFDEC1,
+    ISR_OTFDEC2,
+    ISR_FMAC,
+    ISR_CORDIC,
+    0,
+    ISR_USART10,
+    ISR_I2C5_EV,
+    ISR_I2C5_ER,
+    ISR_FDCAN3_IT0,
+    ISR_FDCAN3_IT1,
+    ISR_TIM23,
+    ISR_TIM24
+};
+
+#elif defined(STM32H735xx) || defined(STM32H733xx) || defined(STM32H730xx) || defined(STM32H730xxQ)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC1_2,
+    ISR_FDCAN1_IT0,
+    ISR_FDCAN2_IT0,
+    ISR_FDCAN1_IT1,
+    ISR_FDCAN2_IT1,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_FDCAN_CAL,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    0,
+    0,
+    0,
+    0,
+    ISR_DCMI,
+    ISR_CRYP,
+    0,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_DMA2D,
+    0,
+    ISR_OCTOSPI1,
+    ISR_LPTIM1,
+    ISR_CEC,
+    ISR_I2C4_EV,
+    ISR_I2C4_ER,
+    ISR_SPDIF_RX,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMAMUX1_OVR,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_DFSDM1_FLT3,
+    0,
+    ISR_SWPMI1,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_MDIOS_WKUP,
+    ISR_MDIOS,
+    0,
+    ISR_MDMA,
+    0,
+    ISR_SDMMC2,
+    ISR_HSEM1,
+    0,
+    ISR_ADC3,
+    ISR_DMAMUX2_OVR,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_COMP,
+    ISR_LPTIM2,
+    ISR_LPTIM3,
+    ISR_LPTIM4,
+    ISR_LPTIM5,
+    ISR_LPUART1,
+    0,
+    ISR_CRS,
+    0,
+    ISR_SAI4,
+    0,
+    0,
+    ISR_WAKEUP_PIN,
+    ISR_OCTOSPI2,
+    ISR_OTFDEC1,
+    ISR_OTFDEC2,
+    ISR_FMAC,
+    ISR_CORDIC,
+    0,
+    ISR_USART10,
+    ISR_I2C5_EV,
+    ISR_I2C5_ER,
+    ISR_FDCAN3_IT0,
+    ISR_FDCAN3_IT1,
+    ISR_TIM23,
+    ISR_TIM24
+};
+
+#elif defined(STM32H742xx) || defined(STM32H743xx) || defined(STM32H750xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC1_2,
+    ISR_FDCAN1_IT0,
+    ISR_FDCAN2_IT0,
+    ISR_FDCAN1_IT1,
+    ISR_FDCAN2_IT1,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_FDCAN_CAL,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_OTG_HS_EP1_OUT,
+    ISR_OTG_HS_EP1_IN,
+    ISR_OTG_HS_WKUP,
+    ISR_OTG_HS,
+    ISR_DCMI,
+    0,
+    0,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_DMA2D,
+    ISR_SAI2,
+    ISR_QUADSPI,
+    ISR_LPTIM1,
+    ISR_CEC,
+    ISR_I2C4_EV,
+    ISR_I2C4_ER,
+    ISR_SPDIF_RX,
+    ISR_OTG_FS_EP1_OUT,
+    ISR_OTG_FS_EP1_IN,
+    ISR_OTG_FS_WKUP,
+    ISR_OTG_FS,
+    ISR_DMAMUX1_OVR,
+    ISR_HRTIM1_MST,
+    ISR_HRTIM1_TIMA,
+    ISR_HRTIM1_TIMB,
+    ISR_HRTIM1_TIMC,
+    ISR_HRTIM1_TIMD,
+    ISR_HRTIM1_TIME,
+    ISR_HRTIM1_FLT,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_DFSDM1_FLT3,
+    ISR_SAI3,
+    ISR_SWPMI1,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_MDIOS_WKUP,
+    ISR_MDIOS,
+    ISR_JPEG,
+    ISR_MDMA,
+    0,
+    ISR_SDMMC2,
+    ISR_HSEM1,
+    0,
+    ISR_ADC3,
+    ISR_DMAMUX2_OVR,
+    ISR_BDMA_Channel0,
+    ISR_BDMA_Channel1,
+    ISR_BDMA_Channel2,
+    ISR_BDMA_Channel3,
+    ISR_BDMA_Channel4,
+    ISR_BDMA_Channel5,
+    ISR_BDMA_Channel6,
+    ISR_BDMA_Channel7,
+    ISR_COMP,
+    ISR_LPTIM2,
+    ISR_LPTIM3,
+    ISR_LPTIM4,
+    ISR_LPTIM5,
+    ISR_LPUART1,
+    ISR_WWDG_RST,
+    ISR_CRS,
+    0,
+    ISR_SAI4,
+    0,
+    0,
+    ISR_WAKEUP_PIN
+};
+
+#elif (defined(STM32H745xx) && defined(CORE_CM4)) || (defined(STM32H747xx) && defined(CORE_CM4))
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC1_2,
+    ISR_FDCAN1_IT0,
+    ISR_FDCAN2_IT0,
+    ISR_FDCAN1_IT1,
+    ISR_FDCAN2_IT1,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_FDCAN_CAL,
+    ISR_CM7_SEV,
+    0,
+    0,
+    0,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_OTG_HS_EP1_OUT,
+    ISR_OTG_HS_EP1_IN,
+    ISR_OTG_HS_WKUP,
+    ISR_OTG_HS,
+    ISR_DCMI,
+    0,
+    0,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_DMA2D,
+    ISR_SAI2,
+    ISR_QUADSPI,
+    ISR_LPTIM1,
+    ISR_CEC,
+    ISR_I2C4_EV,
+    ISR_I2C4_ER,
+    ISR_SPDIF_RX,
+    ISR_OTG_FS_EP1_OUT,
+    ISR_OTG_FS_EP1_IN,
+    ISR_OTG_FS_WKUP,
+    ISR_OTG_FS,
+    ISR_DMAMUX1_OVR,
+    ISR_HRTIM1_MST,
+    ISR_HRTIM1_TIMA,
+    ISR_HRTIM1_TIMB,
+    ISR_HRTIM1_TIMC,
+    ISR_HRTIM1_TIMD,
+    ISR_HRTIM1_TIME,
+    ISR_HRTIM1_FLT,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_DFSDM1_FLT3,
+    ISR_SAI3,
+    ISR_SWPMI1,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_MDIOS_WKUP,
+    ISR_MDIOS,
+    ISR_JPEG,
+    ISR_MDMA,
+    0,
+    ISR_SDMMC2,
+    0,
+    ISR_HSEM2,
+    ISR_ADC3,
+    ISR_DMAMUX2_OVR,
+    ISR_BDMA_Channel0,
+    ISR_BDMA_Channel1,
+    ISR_BDMA_Channel2,
+    ISR_BDMA_Channel3,
+    ISR_BDMA_Channel4,
+    ISR_BDMA_Channel5,
+    ISR_BDMA_Channel6,
+    ISR_BDMA_Channel7,
+    ISR_COMP,
+    ISR_LPTIM2,
+    ISR_LPTIM3,
+    ISR_LPTIM4,
+    ISR_LPTIM5,
+    ISR_LPUART1,
+    ISR_WWDG_RST,
+    ISR_CRS,
+    0,
+    ISR_SAI4,
+    0,
+    ISR_HOLD_CORE,
+    ISR_WAKEUP_PIN
+};
+
+#elif (defined(STM32H745xx) && !defined(CORE_CM4)) || (defined(STM32H747xx) && !defined(CORE_CM4))
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC1_2,
+    ISR_FDCAN1_IT0,
+    ISR_FDCAN2_IT0,
+    ISR_FDCAN1_IT1,
+    ISR_FDCAN2_IT1,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_FDCAN_CAL,
+    0,
+    ISR_CM4_SEV,
+    0,
+    0,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_OTG_HS_EP1_OUT,
+    ISR_OTG_HS_EP1_IN,
+    ISR_OTG_HS_WKUP,
+    ISR_OTG_HS,
+    ISR_DCMI,
+    0,
+    0,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_DMA2D,
+    ISR_SAI2,
+    ISR_QUADSPI,
+    ISR_LPTIM1,
+    ISR_CEC,
+    ISR_I2C4_EV,
+    ISR_I2C4_ER,
+    ISR_SPDIF_RX,
+    ISR_OTG_FS_EP1_OUT,
+    ISR_OTG_FS_EP1_IN,
+    ISR_OTG_FS_WKUP,
+    ISR_OTG_FS,
+    ISR_DMAMUX1_OVR,
+    ISR_HRTIM1_MST,
+    ISR_HRTIM1_TIMA,
+    ISR_HRTIM1_TIMB,
+    ISR_HRTIM1_TIMC,
+    ISR_HRTIM1_TIMD,
+    ISR_HRTIM1_TIME,
+    ISR_HRTIM1_FLT,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_DFSDM1_FLT3,
+    ISR_SAI3,
+    ISR_SWPMI1,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_MDIOS_WKUP,
+    ISR_MDIOS,
+    ISR_JPEG,
+    ISR_MDMA,
+    0,
+    ISR_SDMMC2,
+    ISR_HSEM1,
+    0,
+    ISR_ADC3,
+    ISR_DMAMUX2_OVR,
+    ISR_BDMA_Channel0,
+    ISR_BDMA_Channel1,
+    ISR_BDMA_Channel2,
+    ISR_BDMA_Channel3,
+    ISR_BDMA_Channel4,
+    ISR_BDMA_Channel5,
+    ISR_BDMA_Channel6,
+    ISR_BDMA_Channel7,
+    ISR_COMP,
+    ISR_LPTIM2,
+    ISR_LPTIM3,
+    ISR_LPTIM4,
+    ISR_LPTIM5,
+    ISR_LPUART1,
+    ISR_WWDG_RST,
+    ISR_CRS,
+    0,
+    ISR_SAI4,
+    0,
+    ISR_HOLD_CORE,
+    ISR_WAKEUP_PIN
+};
+
+#elif defined(STM32H753xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC1_2,
+    ISR_FDCAN1_IT0,
+    ISR_FDCAN2_IT0,
+    ISR_FDCAN1_IT1,
+    ISR_FDCAN2_IT1,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_FDCAN_CAL,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_OTG_HS_EP1_OUT,
+    ISR_OTG_HS_EP1_IN,
+    ISR_OTG_HS_WKUP,
+    ISR_OTG_HS,
+    ISR_DCMI,
+    ISR_CRYP,
+    ISR_HASH_RNG,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_DMA2D,
+    ISR_SAI2,
+    ISR_QUADSPI,
+    ISR_LPTIM1,
+    ISR_CEC,
+    ISR_I2C4_EV,
+    ISR_I2C4_ER,
+    ISR_SPDIF_RX,
+    ISR_OTG_FS_EP1_OUT,
+    ISR_OTG_FS_EP1_IN,
+    ISR_OTG_FS_WKUP,
+    ISR_OTG_FS,
+    ISR_DMAMUX1_OVR,
+    ISR_HRTIM1_MST,
+    ISR_HRTIM1_TIMA,
+    ISR_HRTIM1_TIMB,
+    ISR_HRTIM1_TIMC,
+    ISR_HRTIM1_TIMD,
+    ISR_HRTIM1_TIME,
+    ISR_HRTIM1_FLT,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_DFSDM1_FLT3,
+    ISR_SAI3,
+    ISR_SWPMI1,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_MDIOS_WKUP,
+    ISR_MDIOS,
+    ISR_JPEG,
+    ISR_MDMA,
+    0,
+    ISR_SDMMC2,
+    ISR_HSEM1,
+    0,
+    ISR_ADC3,
+    ISR_DMAMUX2_OVR,
+    ISR_BDMA_Channel0,
+    ISR_BDMA_Channel1,
+    ISR_BDMA_Channel2,
+    ISR_BDMA_Channel3,
+    ISR_BDMA_Channel4,
+    ISR_BDMA_Channel5,
+    ISR_BDMA_Channel6,
+    ISR_BDMA_Channel7,
+    ISR_COMP,
+    ISR_LPTIM2,
+    ISR_LPTIM3,
+    ISR_LPTIM4,
+    ISR_LPTIM5,
+    ISR_LPUART1,
+    ISR_WWDG_RST,
+    ISR_CRS,
+    0,
+    ISR_SAI4,
+    0,
+    0,
+    ISR_WAKEUP_PIN
+};
+
+#elif (defined(STM32H755xx) && defined(CORE_CM4)) || (defined(STM32H757xx) && defined(CORE_CM4))
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC1_2,
+    ISR_FDCAN1_IT0,
+    ISR_FDCAN2_IT0,
+    ISR_FDCAN1_IT1,
+    ISR_FDCAN2_IT1,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_FDCAN_CAL,
+    ISR_CM7_SEV,
+    0,
+    0,
+    0,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_OTG_HS_EP1_OUT,
+    ISR_OTG_HS_EP1_IN,
+    ISR_OTG_HS_WKUP,
+    ISR_OTG_HS,
+    ISR_DCMI,
+    ISR_CRYP,
+    ISR_HASH_RNG,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_DMA2D,
+    ISR_SAI2,
+    ISR_QUADSPI,
+    ISR_LPTIM1,
+    ISR_CEC,
+    ISR_I2C4_EV,
+    ISR_I2C4_ER,
+    ISR_SPDIF_RX,
+    ISR_OTG_FS_EP1_OUT,
+    ISR_OTG_FS_EP1_IN,
+    ISR_OTG_FS_WKUP,
+    ISR_OTG_FS,
+    ISR_DMAMUX1_OVR,
+    ISR_HRTIM1_MST,
+    ISR_HRTIM1_TIMA,
+    ISR_HRTIM1_TIMB,
+    ISR_HRTIM1_TIMC,
+    ISR_HRTIM1_TIMD,
+    ISR_HRTIM1_TIME,
+    ISR_HRTIM1_FLT,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_DFSDM1_FLT3,
+    ISR_SAI3,
+    ISR_SWPMI1,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_MDIOS_WKUP,
+    ISR_MDIOS,
+    ISR_JPEG,
+    ISR_MDMA,
+    0,
+    ISR_SDMMC2,
+    0,
+    ISR_HSEM2,
+    ISR_ADC3,
+    ISR_DMAMUX2_OVR,
+    ISR_BDMA_Channel0,
+    ISR_BDMA_Channel1,
+    ISR_BDMA_Channel2,
+    ISR_BDMA_Channel3,
+    ISR_BDMA_Channel4,
+    ISR_BDMA_Channel5,
+    ISR_BDMA_Channel6,
+    ISR_BDMA_Channel7,
+    ISR_COMP,
+    ISR_LPTIM2,
+    ISR_LPTIM3,
+    ISR_LPTIM4,
+    ISR_LPTIM5,
+    ISR_LPUART1,
+    ISR_WWDG_RST,
+    ISR_CRS,
+    0,
+    ISR_SAI4,
+    0,
+    ISR_HOLD_CORE,
+    ISR_WAKEUP_PIN
+};
+
+#elif (defined(STM32H755xx) && !defined(CORE_CM4)) || (defined(STM32H757xx) && !defined(CORE_CM4))
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Stream0,
+    ISR_DMA1_Stream1,
+    ISR_DMA1_Stream2,
+    ISR_DMA1_Stream3,
+    ISR_DMA1_Stream4,
+    ISR_DMA1_Stream5,
+    ISR_DMA1_Stream6,
+    ISR_ADC1_2,
+    ISR_FDCAN1_IT0,
+    ISR_FDCAN2_IT0,
+    ISR_FDCAN1_IT1,
+    ISR_FDCAN2_IT1,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_TIM8_BRK_TIM12,
+    ISR_TIM8_UP_TIM13,
+    ISR_TIM8_TRG_COM_TIM14,
+    ISR_TIM8_CC,
+    ISR_DMA1_Stream7,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Stream0,
+    ISR_DMA2_Stream1,
+    ISR_DMA2_Stream2,
+    ISR_DMA2_Stream3,
+    ISR_DMA2_Stream4,
+    ISR_ETH,
+    ISR_ETH_WKUP,
+    ISR_FDCAN_CAL,
+    0,
+    ISR_CM4_SEV,
+    0,
+    0,
+    ISR_DMA2_Stream5,
+    ISR_DMA2_Stream6,
+    ISR_DMA2_Stream7,
+    ISR_USART6,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_OTG_HS_EP1_OUT,
+    ISR_OTG_HS_EP1_IN,
+    ISR_OTG_HS_WKUP,
+    ISR_OTG_HS,
+    ISR_DCMI,
+    ISR_CRYP,
+    ISR_HASH_RNG,
+    ISR_FPU,
+    ISR_UART7,
+    ISR_UART8,
+    ISR_SPI4,
+    ISR_SPI5,
+    ISR_SPI6,
+    ISR_SAI1,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_DMA2D,
+    ISR_SAI2,
+    ISR_QUADSPI,
+    ISR_LPTIM1,
+    ISR_CEC,
+    ISR_I2C4_EV,
+    ISR_I2C4_ER,
+    ISR_SPDIF_RX,
+    ISR_OTG_FS_EP1_OUT,
+    ISR_OTG_FS_EP1_IN,
+    ISR_OTG_FS_WKUP,
+    ISR_OTG_FS,
+    ISR_DMAMUX1_OVR,
+    ISR_HRTIM1_MST,
+    ISR_HRTIM1_TIMA,
+    ISR_HRTIM1_TIMB,
+    ISR_HRTIM1_TIMC,
+    ISR_HRTIM1_TIMD,
+    ISR_HRTIM1_TIME,
+    ISR_HRTIM1_FLT,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_DFSDM1_FLT3,
+    ISR_SAI3,
+    ISR_SWPMI1,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_MDIOS_WKUP,
+    ISR_MDIOS,
+    ISR_JPEG,
+    ISR_MDMA,
+    0,
+    ISR_SDMMC2,
+    ISR_HSEM1,
+    0,
+    ISR_ADC3,
+    ISR_DMAMUX2_OVR,
+    ISR_BDMA_Channel0,
+    ISR_BDMA_Channel1,
+    ISR_BDMA_Channel2,
+    ISR_BDMA_Channel3,
+    ISR_BDMA_Channel4,
+    ISR_BDMA_Channel5,
+    ISR_BDMA_Channel6,
+    ISR_BDMA_Channel7,
+    ISR_COMP,
+    ISR_LPTIM2,
+    ISR_LPTIM3,
+    ISR_LPTIM4,
+    ISR_LPTIM5,
+    ISR_LPUART1,
+    ISR_WWDG_RST,
+    ISR_CRS,
+    0,
+    ISR_SAI4,
+    0,
+    ISR_HOLD_CORE,
+    ISR_WAKEUP_PIN
+};
+
+#else
+#error "ISR vectors table is not defined for the target device"
+#endif
 
 /* ================================================================================================================================ */
@@ -2,12 +2,14 @@
  * @file       stm32l4xx.c
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
- * @date       Thursday, 15th July 2021 10:14:58 am
- * @modified   Thursday, 15th July 2021 10:44:24 am
+ * @date       Saturday, 17th October 2026 9:58:39 pm
+ * @modified   Saturday, 17th October 2026 9:58:39 pm
  * @project    stm-utils
- * @brief      Definitions of interrupt vectors for STML4xx devices
- *    
- * @copyright Krzysztof Pierczyk © 2022
+ * @brief      Definitions of interrupt vectors for STM32L4xx devices
+ *
+ * @note Generated by scripts/generate_vectors.py, do not edit
+ *
+ * @copyright Krzysztof Pierczyk © 2026
  * /// ============================================================================================================================ */
 
 /* =========================================================== Includes =========================================================== */
@@ -17,6 +19,1606 @@
 
 /* ========================================================== Definitions ========================================================= */
 
+/**
+ * @note Names for SVC_Handler, PendSV_Handler and SysTick_Handler interrupt
+ *    handlers was set differently to fit RTX-RTOSv5 naming scheme
+ */
 
+// Exception vector's definitions
+ISR_VECTOR           (EXC_NMI);
+ISR_VECTOR           (EXC_HardFault);
+ISR_VECTOR           (EXC_MemoryManagement);
+ISR_VECTOR           (EXC_BusFault);
+ISR_VECTOR           (EXC_UsageFault);
+ISR_VECTOR           (SVC_Handler);
+ISR_VECTOR           (EXC_DebugMonitor);
+ISR_VECTOR           (PendSV_Handler);
+ISR_VECTOR           (SysTick_Handler);
+
+// ISR Vector's definitions
+ISR_VECTOR_FORCED    (ISR_EXTI0_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI1_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI2_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI3_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI4_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI9_5);
+ISR_VECTOR_FORCED    (ISR_EXTI15_10);
+ISR_VECTOR_DISPATCHER(ISR_TIM1_BRK_TIM15);
+ISR_VECTOR_DISPATCHER(ISR_TIM1_UP_TIM16);
+ISR_VECTOR_DISPATCHER(ISR_TIM6_DAC);
+ISR_VECTOR_DISPATCHER(ISR_TIM1_TRG_COM_TIM17);
+ISR_VECTOR           (ISR_WWDG);
+ISR_VECTOR           (ISR_PVD_PVM);
+ISR_VECTOR           (ISR_TAMP_STAMP);
+ISR_VECTOR           (ISR_RTC_WKUP);
+ISR_VECTOR           (ISR_FLASH);
+ISR_VECTOR           (ISR_RCC);
+ISR_VECTOR           (ISR_DMA1_Channel1);
+ISR_VECTOR           (ISR_DMA1_Channel2);
+ISR_VECTOR           (ISR_DMA1_Channel3);
+ISR_VECTOR           (ISR_DMA1_Channel4);
+ISR_VECTOR           (ISR_DMA1_Channel5);
+ISR_VECTOR           (ISR_DMA1_Channel6);
+ISR_VECTOR           (ISR_DMA1_Channel7);
+ISR_VECTOR           (ISR_ADC1);
+ISR_VECTOR           (ISR_TIM1_TRG_COM);
+ISR_VECTOR           (ISR_TIM1_CC);
+ISR_VECTOR           (ISR_TIM2);
+ISR_VECTOR           (ISR_I2C1_EV);
+ISR_VECTOR           (ISR_I2C1_ER);
+ISR_VECTOR           (ISR_I2C2_EV);
+ISR_VECTOR           (ISR_I2C2_ER);
+ISR_VECTOR           (ISR_SPI1);
+ISR_VECTOR           (ISR_SPI2);
+ISR_VECTOR           (ISR_USART1);
+ISR_VECTOR           (ISR_USART2);
+ISR_VECTOR           (ISR_USART3);
+ISR_VECTOR           (ISR_RTC_Alarm);
+ISR_VECTOR           (ISR_DMA2_Channel1);
+ISR_VECTOR           (ISR_DMA2_Channel2);
+ISR_VECTOR           (ISR_DMA2_Channel3);
+ISR_VECTOR           (ISR_DMA2_Channel4);
+ISR_VECTOR           (ISR_DMA2_Channel5);
+ISR_VECTOR           (ISR_COMP);
+ISR_VECTOR           (ISR_LPTIM1);
+ISR_VECTOR           (ISR_LPTIM2);
+ISR_VECTOR           (ISR_USB);
+ISR_VECTOR           (ISR_DMA2_Channel6);
+ISR_VECTOR           (ISR_DMA2_Channel7);
+ISR_VECTOR           (ISR_LPUART1);
+ISR_VECTOR           (ISR_QUADSPI);
+ISR_VECTOR           (ISR_I2C3_EV);
+ISR_VECTOR           (ISR_I2C3_ER);
+ISR_VECTOR           (ISR_TSC);
+ISR_VECTOR           (ISR_RNG);
+ISR_VECTOR           (ISR_FPU);
+ISR_VECTOR           (ISR_CRS);
+ISR_VECTOR           (ISR_ADC1_2);
+ISR_VECTOR           (ISR_CAN1_TX);
+ISR_VECTOR           (ISR_CAN1_RX0);
+ISR_VECTOR           (ISR_CAN1_RX1);
+ISR_VECTOR           (ISR_CAN1_SCE);
+ISR_VECTOR           (ISR_TIM3);
+ISR_VECTOR           (ISR_TIM4);
+ISR_VECTOR           (ISR_DFSDM1_FLT3);
+ISR_VECTOR           (ISR_TIM8_BRK);
+ISR_VECTOR           (ISR_TIM8_UP);
+ISR_VECTOR           (ISR_TIM8_TRG_COM);
+ISR_VECTOR           (ISR_TIM8_CC);
+ISR_VECTOR           (ISR_ADC3);
+ISR_VECTOR           (ISR_FMC);
+ISR_VECTOR           (ISR_SDMMC1);
+ISR_VECTOR           (ISR_TIM5);
+ISR_VECTOR           (ISR_SPI3);
+ISR_VECTOR           (ISR_UART4);
+ISR_VECTOR           (ISR_UART5);
+ISR_VECTOR           (ISR_TIM7);
+ISR_VECTOR           (ISR_DFSDM1_FLT0);
+ISR_VECTOR           (ISR_DFSDM1_FLT1);
+ISR_VECTOR           (ISR_DFSDM1_FLT2);
+ISR_VECTOR           (ISR_OTG_FS);
+ISR_VECTOR           (ISR_SAI1);
+ISR_VECTOR           (ISR_SAI2);
+ISR_VECTOR           (ISR_SWPMI1);
+ISR_VECTOR           (ISR_LCD);
+ISR_VECTOR           (ISR_AES);
+ISR_VECTOR           (ISR_HASH_RNG);
+ISR_VECTOR           (ISR_I2C4_EV);
+ISR_VECTOR           (ISR_I2C4_ER);
+ISR_VECTOR           (ISR_DCMI);
+ISR_VECTOR           (ISR_CAN2_TX);
+ISR_VECTOR           (ISR_CAN2_RX0);
+ISR_VECTOR           (ISR_CAN2_RX1);
+ISR_VECTOR           (ISR_CAN2_SCE);
+ISR_VECTOR           (ISR_DMA2D);
+ISR_VECTOR           (ISR_SDMMC2);
+ISR_VECTOR           (ISR_OCTOSPI1);
+ISR_VECTOR           (ISR_OCTOSPI2);
+ISR_VECTOR           (ISR_LTDC);
+ISR_VECTOR           (ISR_LTDC_ER);
+ISR_VECTOR           (ISR_DMAMUX1_OVR);
+ISR_VECTOR           (ISR_GFXMMU);
+ISR_VECTOR           (ISR_DSIHOST);
+
+/* ========================================================= Pseud-vectors ======================================================== */
+
+// Pseudo-ISR vectors
+ISR_VECTOR           (ISR_EXTI0);
+ISR_VECTOR           (ISR_EXTI1);
+ISR_VECTOR           (ISR_EXTI2);
+ISR_VECTOR           (ISR_EXTI3);
+ISR_VECTOR           (ISR_EXTI4);
+ISR_VECTOR           (ISR_EXTI5);
+ISR_VECTOR           (ISR_EXTI6);
+ISR_VECTOR           (ISR_EXTI7);
+ISR_VECTOR           (ISR_EXTI8);
+ISR_VECTOR           (ISR_EXTI9);
+ISR_VECTOR           (ISR_EXTI10);
+ISR_VECTOR           (ISR_EXTI11);
+ISR_VECTOR           (ISR_EXTI12);
+ISR_VECTOR           (ISR_EXTI13);
+ISR_VECTOR           (ISR_EXTI14);
+ISR_VECTOR           (ISR_EXTI15);
+ISR_VECTOR           (ISR_TIM1_BRK);
+ISR_VECTOR           (ISR_TIM15);
+ISR_VECTOR           (ISR_TIM1_UP);
+ISR_VECTOR           (ISR_TIM16);
+ISR_VECTOR           (ISR_TIM6);
+ISR_VECTOR           (ISR_DAC);
+ISR_VECTOR           (ISR_TIM17);
+
+/* ================================================= Emulated vectors definitions ================================================= */
+
+// Pending flags of the EXTI lines enabled for the current core
+#define EXTI_PENDING (EXTI->PR1 & EXTI->IMR1)
+
+// Default handlers of the EXTI lines (indexed by line number)
+const vector_function_ptr exti_default_handlers[16] = {
+    ISR_EXTI0,
+    ISR_EXTI1,
+    ISR_EXTI2,
+    ISR_EXTI3,
+    ISR_EXTI4,
+    ISR_EXTI5,
+    ISR_EXTI6,
+    ISR_EXTI7,
+    ISR_EXTI8,
+    ISR_EXTI9,
+    ISR_EXTI10,
+    ISR_EXTI11,
+    ISR_EXTI12,
+    ISR_EXTI13,
+    ISR_EXTI14,
+    ISR_EXTI15
+};
+
+// Handlers of the EXTI lines called by dispatchers (indexed by line number)
+exti_line_handler exti_line_handlers[16] = {
+    EXTI_DEFAULT_LINE_HANDLER(0),
+    EXTI_DEFAULT_LINE_HANDLER(1),
+    EXTI_DEFAULT_LINE_HANDLER(2),
+    EXTI_DEFAULT_LINE_HANDLER(3),
+    EXTI_DEFAULT_LINE_HANDLER(4),
+    EXTI_DEFAULT_LINE_HANDLER(5),
+    EXTI_DEFAULT_LINE_HANDLER(6),
+    EXTI_DEFAULT_LINE_HANDLER(7),
+    EXTI_DEFAULT_LINE_HANDLER(8),
+    EXTI_DEFAULT_LINE_HANDLER(9),
+    EXTI_DEFAULT_LINE_HANDLER(10),
+    EXTI_DEFAULT_LINE_HANDLER(11),
+    EXTI_DEFAULT_LINE_HANDLER(12),
+    EXTI_DEFAULT_LINE_HANDLER(13),
+    EXTI_DEFAULT_LINE_HANDLER(14),
+    EXTI_DEFAULT_LINE_HANDLER(15)
+};
+
+// Dispatchers of the EXTI lines with dedicated vectors
+ISR_EXTI_LINE_DISPATCHER(0)
+ISR_EXTI_LINE_DISPATCHER(1)
+ISR_EXTI_LINE_DISPATCHER(2)
+ISR_EXTI_LINE_DISPATCHER(3)
+ISR_EXTI_LINE_DISPATCHER(4)
+
+// Dispatcher of the EXTI 5-9 lines
+void ISR_EXTI9_5(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(5, 9), exti_line_handlers);
+}
+
+// Dispatcher of the EXTI 10-15 lines
+void ISR_EXTI15_10(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(10, 15), exti_line_handlers);
+}
+
+// Dispatcher of the TIM1_BRK_TIM15 interrupt
+void ISR_TIM1_BRK_TIM15(void) {
+
+    #if defined(TIM1)
+        // Dispatch BRK events of TIM1
+        if(TimPends(TIM1, TIM_SR_BIF))
+            ISR_TIM1_BRK();
+    #endif
+
+    #if defined(TIM15)
+        // Dispatch TIM15
+        if(TimPends(TIM15, 0xFFUL))
+            ISR_TIM15();
+    #endif
+}
+
+// Dispatcher of the TIM1_UP_TIM16 interrupt
+void ISR_TIM1_UP_TIM16(void) {
+
+    #if defined(TIM1)
+        // Dispatch UP events of TIM1
+        if(TimPends(TIM1, TIM_SR_UIF))
+            ISR_TIM1_UP();
+    #endif
+
+    #if defined(TIM16)
+        // Dispatch TIM16
+        if(TimPends(TIM16, 0xFFUL))
+            ISR_TIM16();
+    #endif
+}
+
+// Dispatcher of the TIM6_DAC interrupt
+void ISR_TIM6_DAC(void) {
+
+    #if defined(TIM6)
+        // Dispatch TIM6
+        if(TimPends(TIM6, 0xFFUL))
+            ISR_TIM6();
+    #endif
+
+    #if defined(DAC1)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC1))
+            ISR_DAC();
+    #elif defined(DAC)
+        // Dispatch DMA underrun of the DAC
+        if(DacPends(DAC))
+            ISR_DAC();
+    #endif
+}
+
+#if defined(STM32L476xx) || defined(STM32L486xx) || defined(STM32L496xx) || defined(STM32L4A6xx) || defined(STM32L4P5xx) || \
+    defined(STM32L4Q5xx) || defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4S5xx) || defined(STM32L4S7xx) || \
+    defined(STM32L4R9xx) || defined(STM32L4S9xx) || defined(STM32L475xx) || defined(STM32L485xx)
+
+// Dispatcher of the TIM1_TRG_COM_TIM17 interrupt
+void ISR_TIM1_TRG_COM_TIM17(void) {
+
+    #if defined(TIM1)
+        // Dispatch TRG COM events of TIM1
+        if(TimPends(TIM1, TIM_SR_TIF | TIM_SR_COMIF))
+            ISR_TIM1_TRG_COM();
+    #endif
+
+    #if defined(TIM17)
+        // Dispatch TIM17
+        if(TimPends(TIM17, 0xFFUL))
+            ISR_TIM17();
+    #endif
+}
+
+#endif
+
+/* ======================================================== Vectors' table ======================================================== */
+
+#if defined(STM32L412xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    0,
+    0,
+    0,
+    0,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    0,
+    0,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_TIM6_DAC,
+    0,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    0,
+    0,
+    0,
+    ISR_COMP,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_USB,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_LPUART1,
+    ISR_QUADSPI,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    0,
+    0,
+    0,
+    ISR_TSC,
+    0,
+    0,
+    ISR_RNG,
+    ISR_FPU,
+    ISR_CRS
+};
+
+#elif defined(STM32L476xx) || defined(STM32L486xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1_2,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_DFSDM1_FLT3,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_ADC3,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_COMP,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_OTG_FS,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_LPUART1,
+    ISR_QUADSPI,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    ISR_SAI2,
+    ISR_SWPMI1,
+    ISR_TSC,
+    ISR_LCD,
+    ISR_AES,
+    ISR_RNG,
+    ISR_FPU
+};
+
+#elif defined(STM32L496xx) || defined(STM32L4A6xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1_2,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_DFSDM1_FLT3,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_ADC3,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_COMP,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_OTG_FS,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_LPUART1,
+    ISR_QUADSPI,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    ISR_SAI2,
+    ISR_SWPMI1,
+    ISR_TSC,
+    ISR_LCD,
+    ISR_AES,
+    ISR_HASH_RNG,
+    ISR_FPU,
+    ISR_CRS,
+    ISR_I2C4_EV,
+    ISR_I2C4_ER,
+    ISR_DCMI,
+    ISR_CAN2_TX,
+    ISR_CAN2_RX0,
+    ISR_CAN2_RX1,
+    ISR_CAN2_SCE,
+    ISR_DMA2D
+};
+
+#elif defined(STM32L4P5xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1_2,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_DFSDM1_FLT3,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_SDMMC2,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_COMP,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_OTG_FS,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_LPUART1,
+    ISR_OCTOSPI1,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    ISR_SAI2,
+    ISR_OCTOSPI2,
+    ISR_TSC,
+    0,
+    ISR_AES,
+    ISR_HASH_RNG,
+    ISR_FPU,
+    ISR_CRS,
+    ISR_I2C4_ER,
+    ISR_I2C4_EV,
+    ISR_DCMI,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2D,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    0,
+    ISR_DMAMUX1_OVR
+};
+
+#elif defined(STM32L4Q5xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1_2,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_DFSDM1_FLT3,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_SDMMC2,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_COMP,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_OTG_FS,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_LPUART1,
+    ISR_OCTOSPI1,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    ISR_SAI2,
+    ISR_OCTOSPI2,
+    ISR_TSC,
+    0,
+    ISR_AES,
+    0,
+    ISR_FPU,
+    ISR_CRS,
+    ISR_I2C4_ER,
+    ISR_I2C4_EV,
+    ISR_DCMI,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2D,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    0,
+    ISR_DMAMUX1_OVR
+};
+
+#elif defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4S5xx) || defined(STM32L4S7xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_DFSDM1_FLT3,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_ADC3,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_COMP,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_OTG_FS,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_LPUART1,
+    ISR_OCTOSPI1,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    ISR_SAI2,
+    ISR_OCTOSPI2,
+    ISR_TSC,
+    0,
+    ISR_AES,
+    ISR_HASH_RNG,
+    ISR_FPU,
+    ISR_CRS,
+    ISR_I2C4_ER,
+    ISR_I2C4_EV,
+    ISR_DCMI,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2D,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_GFXMMU,
+    ISR_DMAMUX1_OVR
+};
+
+#elif defined(STM32L4R9xx) || defined(STM32L4S9xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_DFSDM1_FLT3,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_ADC3,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_COMP,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_OTG_FS,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_LPUART1,
+    ISR_OCTOSPI1,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    ISR_SAI2,
+    ISR_OCTOSPI2,
+    ISR_TSC,
+    ISR_DSIHOST,
+    ISR_AES,
+    ISR_HASH_RNG,
+    ISR_FPU,
+    ISR_CRS,
+    ISR_I2C4_ER,
+    ISR_I2C4_EV,
+    ISR_DCMI,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMA2D,
+    ISR_LTDC,
+    ISR_LTDC_ER,
+    ISR_GFXMMU,
+    ISR_DMAMUX1_OVR
+};
+
+#elif defined(STM32L431xx) || defined(STM32L451xx) || defined(STM32L471xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_DFSDM1_FLT3,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_ADC3,
+    0,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    0,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_COMP,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_USB,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_LPUART1,
+    ISR_QUADSPI,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    0,
+    ISR_SWPMI1,
+    ISR_TSC,
+    ISR_LCD,
+    ISR_AES,
+    ISR_RNG,
+    ISR_FPU,
+    ISR_CRS
+};
+
+#elif defined(STM32L422xx) || defined(STM32L432xx) || defined(STM32L442xx) || defined(STM32L452xx) || defined(STM32L462xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    0,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_DFSDM1_FLT3,
+    0,
+    0,
+    0,
+    0,
+    ISR_ADC3,
+    0,
+    ISR_SDMMC1,
+    0,
+    ISR_SPI3,
+    ISR_UART4,
+    0,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_COMP,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_USB,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_LPUART1,
+    ISR_QUADSPI,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    0,
+    ISR_SWPMI1,
+    ISR_TSC,
+    ISR_LCD,
+    ISR_AES,
+    ISR_RNG,
+    ISR_FPU,
+    ISR_CRS,
+    ISR_I2C4_EV,
+    ISR_I2C4_ER
+};
+
+#elif defined(STM32L433xx) || defined(STM32L443xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    0,
+    0,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_ADC3,
+    0,
+    ISR_SDMMC1,
+    0,
+    ISR_SPI3,
+    0,
+    0,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    0,
+    0,
+    0,
+    ISR_COMP,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_USB,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_LPUART1,
+    0,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    0,
+    ISR_SWPMI1,
+    ISR_TSC,
+    ISR_LCD,
+    0,
+    ISR_RNG,
+    ISR_FPU,
+    ISR_CRS
+};
+
+#elif defined(STM32L475xx) || defined(STM32L485xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1_2,
+    ISR_CAN1_TX,
+    ISR_CAN1_RX0,
+    ISR_CAN1_RX1,
+    ISR_CAN1_SCE,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK_TIM15,
+    ISR_TIM1_UP_TIM16,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_DFSDM1_FLT3,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_ADC3,
+    ISR_FMC,
+    ISR_SDMMC1,
+    ISR_TIM5,
+    ISR_SPI3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_TIM6_DAC,
+    ISR_TIM7,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_COMP,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    0,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_LPUART1,
+    ISR_QUADSPI,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    ISR_SAI2,
+    ISR_SWPMI1,
+    ISR_TSC,
+    ISR_LCD,
+    0,
+    ISR_RNG,
+    ISR_FPU,
+    0,
+    0,
+    ISR_I2C4_ER
+};
+
+#else
+#error "ISR vectors table is not defined for the target device"
+#endif
 
 /* ================================================================================================================================ */
@@ -2,20 +2,509 @@
  * @file       stm32l5xx.c
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
- * @date       Thursday, 15th July 2021 10:14:58 am
- * @modified   Thursday, 15th July 2021 10:44:39 am
+ * @date       Saturday, 17th October 2026 9:58:40 pm
+ * @modified   Saturday, 17th October 2026 9:58:40 pm
  * @project    stm-utils
- * @brief      Definitions of interrupt vectors for STML5xx devices
- *    
- * @copyright Krzysztof Pierczyk © 2022
+ * @brief      Definitions of interrupt vectors for STM32L5xx devices
+ *
+ * @note Generated by scripts/generate_vectors.py, do not edit
+ *
+ * @copyright Krzysztof Pierczyk © 2026
  * /// ============================================================================================================================ */
 
 /* =========================================================== Includes =========================================================== */
 
+#include "device.h"
 #include "interrupts/definitions.h"
 
 /* ========================================================== Definitions ========================================================= */
 
+/**
+ * @note Names for SVC_Handler, PendSV_Handler and SysTick_Handler interrupt
+ *    handlers was set differently to fit RTX-RTOSv5 naming scheme
+ */
 
+// Exception vector's definitions
+ISR_VECTOR           (EXC_NMI);
+ISR_VECTOR           (EXC_HardFault);
+ISR_VECTOR           (EXC_MemoryManagement);
+ISR_VECTOR           (EXC_BusFault);
+ISR_VECTOR           (EXC_UsageFault);
+ISR_VECTOR           (EXC_SecureFault);
+ISR_VECTOR           (SVC_Handler);
+ISR_VECTOR           (EXC_DebugMonitor);
+ISR_VECTOR           (PendSV_Handler);
+ISR_VECTOR           (SysTick_Handler);
+
+// ISR Vector's definitions
+ISR_VECTOR_FORCED    (ISR_EXTI0_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI1_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI2_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI3_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI4_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI5_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI6_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI7_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI8_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI9_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI10_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI11_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI12_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI13_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI14_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI15_Dispatcher);
+ISR_VECTOR           (ISR_WWDG);
+ISR_VECTOR           (ISR_PVD_PVM);
+ISR_VECTOR           (ISR_RTC);
+ISR_VECTOR           (ISR_RTC_S);
+ISR_VECTOR           (ISR_TAMP);
+ISR_VECTOR           (ISR_TAMP_S);
+ISR_VECTOR           (ISR_FLASH);
+ISR_VECTOR           (ISR_FLASH_S);
+ISR_VECTOR           (ISR_GTZC);
+ISR_VECTOR           (ISR_RCC);
+ISR_VECTOR           (ISR_RCC_S);
+ISR_VECTOR           (ISR_DMAMUX1_OVR);
+ISR_VECTOR           (ISR_DMAMUX1_OVR_S);
+ISR_VECTOR           (ISR_DMA1_Channel1);
+ISR_VECTOR           (ISR_DMA1_Channel2);
+ISR_VECTOR           (ISR_DMA1_Channel3);
+ISR_VECTOR           (ISR_DMA1_Channel4);
+ISR_VECTOR           (ISR_DMA1_Channel5);
+ISR_VECTOR           (ISR_DMA1_Channel6);
+ISR_VECTOR           (ISR_DMA1_Channel7);
+ISR_VECTOR           (ISR_DMA1_Channel8);
+ISR_VECTOR           (ISR_ADC1_2);
+ISR_VECTOR           (ISR_DAC);
+ISR_VECTOR           (ISR_FDCAN1_IT0);
+ISR_VECTOR           (ISR_FDCAN1_IT1);
+ISR_VECTOR           (ISR_TIM1_BRK);
+ISR_VECTOR           (ISR_TIM1_UP);
+ISR_VECTOR           (ISR_TIM1_TRG_COM);
+ISR_VECTOR           (ISR_TIM1_CC);
+ISR_VECTOR           (ISR_TIM2);
+ISR_VECTOR           (ISR_TIM3);
+ISR_VECTOR           (ISR_TIM4);
+ISR_VECTOR           (ISR_TIM5);
+ISR_VECTOR           (ISR_TIM6);
+ISR_VECTOR           (ISR_TIM7);
+ISR_VECTOR           (ISR_TIM8_BRK);
+ISR_VECTOR           (ISR_TIM8_UP);
+ISR_VECTOR           (ISR_TIM8_TRG_COM);
+ISR_VECTOR           (ISR_TIM8_CC);
+ISR_VECTOR           (ISR_I2C1_EV);
+ISR_VECTOR           (ISR_I2C1_ER);
+ISR_VECTOR           (ISR_I2C2_EV);
+ISR_VECTOR           (ISR_I2C2_ER);
+ISR_VECTOR           (ISR_SPI1);
+ISR_VECTOR           (ISR_SPI2);
+ISR_VECTOR           (ISR_USART1);
+ISR_VECTOR           (ISR_USART2);
+ISR_VECTOR           (ISR_USART3);
+ISR_VECTOR           (ISR_UART4);
+ISR_VECTOR           (ISR_UART5);
+ISR_VECTOR           (ISR_LPUART1);
+ISR_VECTOR           (ISR_LPTIM1);
+ISR_VECTOR           (ISR_LPTIM2);
+ISR_VECTOR           (ISR_TIM15);
+ISR_VECTOR           (ISR_TIM16);
+ISR_VECTOR           (ISR_TIM17);
+ISR_VECTOR           (ISR_COMP);
+ISR_VECTOR           (ISR_USB_FS);
+ISR_VECTOR           (ISR_CRS);
+ISR_VECTOR           (ISR_FMC);
+ISR_VECTOR           (ISR_OCTOSPI1);
+ISR_VECTOR           (ISR_SDMMC1);
+ISR_VECTOR           (ISR_DMA2_Channel1);
+ISR_VECTOR           (ISR_DMA2_Channel2);
+ISR_VECTOR           (ISR_DMA2_Channel3);
+ISR_VECTOR           (ISR_DMA2_Channel4);
+ISR_VECTOR           (ISR_DMA2_Channel5);
+ISR_VECTOR           (ISR_DMA2_Channel6);
+ISR_VECTOR           (ISR_DMA2_Channel7);
+ISR_VECTOR           (ISR_DMA2_Channel8);
+ISR_VECTOR           (ISR_I2C3_EV);
+ISR_VECTOR           (ISR_I2C3_ER);
+ISR_VECTOR           (ISR_SAI1);
+ISR_VECTOR           (ISR_SAI2);
+ISR_VECTOR           (ISR_TSC);
+ISR_VECTOR           (ISR_RNG);
+ISR_VECTOR           (ISR_HASH);
+ISR_VECTOR           (ISR_LPTIM3);
+ISR_VECTOR           (ISR_SPI3);
+ISR_VECTOR           (ISR_I2C4_ER);
+ISR_VECTOR           (ISR_I2C4_EV);
+ISR_VECTOR           (ISR_DFSDM1_FLT0);
+ISR_VECTOR           (ISR_DFSDM1_FLT1);
+ISR_VECTOR           (ISR_DFSDM1_FLT2);
+ISR_VECTOR           (ISR_DFSDM1_FLT3);
+ISR_VECTOR           (ISR_UCPD1);
+ISR_VECTOR           (ISR_ICACHE);
+ISR_VECTOR           (ISR_AES);
+ISR_VECTOR           (ISR_PKA);
+ISR_VECTOR           (ISR_OTFDEC1);
+
+/* ========================================================= Pseud-vectors ======================================================== */
+
+// Pseudo-ISR vectors
+ISR_VECTOR           (ISR_EXTI0);
+ISR_VECTOR           (ISR_EXTI1);
+ISR_VECTOR           (ISR_EXTI2);
+ISR_VECTOR           (ISR_EXTI3);
+ISR_VECTOR           (ISR_EXTI4);
+ISR_VECTOR           (ISR_EXTI5);
+ISR_VECTOR           (ISR_EXTI6);
+ISR_VECTOR           (ISR_EXTI7);
+ISR_VECTOR           (ISR_EXTI8);
+ISR_VECTOR           (ISR_EXTI9);
+ISR_VECTOR           (ISR_EXTI10);
+ISR_VECTOR           (ISR_EXTI11);
+ISR_VECTOR           (ISR_EXTI12);
+ISR_VECTOR           (ISR_EXTI13);
+ISR_VECTOR           (ISR_EXTI14);
+ISR_VECTOR           (ISR_EXTI15);
+
+/* ================================================= Emulated vectors definitions ================================================= */
+
+// Default handlers of the EXTI lines (indexed by line number)
+const vector_function_ptr exti_default_handlers[16] = {
+    ISR_EXTI0,
+    ISR_EXTI1,
+    ISR_EXTI2,
+    ISR_EXTI3,
+    ISR_EXTI4,
+    ISR_EXTI5,
+    ISR_EXTI6,
+    ISR_EXTI7,
+    ISR_EXTI8,
+    ISR_EXTI9,
+    ISR_EXTI10,
+    ISR_EXTI11,
+    ISR_EXTI12,
+    ISR_EXTI13,
+    ISR_EXTI14,
+    ISR_EXTI15
+};
+
+// Handlers of the EXTI lines called by dispatchers (indexed by line number)
+exti_line_handler exti_line_handlers[16] = {
+    EXTI_DEFAULT_LINE_HANDLER(0),
+    EXTI_DEFAULT_LINE_HANDLER(1),
+    EXTI_DEFAULT_LINE_HANDLER(2),
+    EXTI_DEFAULT_LINE_HANDLER(3),
+    EXTI_DEFAULT_LINE_HANDLER(4),
+    EXTI_DEFAULT_LINE_HANDLER(5),
+    EXTI_DEFAULT_LINE_HANDLER(6),
+    EXTI_DEFAULT_LINE_HANDLER(7),
+    EXTI_DEFAULT_LINE_HANDLER(8),
+    EXTI_DEFAULT_LINE_HANDLER(9),
+    EXTI_DEFAULT_LINE_HANDLER(10),
+    EXTI_DEFAULT_LINE_HANDLER(11),
+    EXTI_DEFAULT_LINE_HANDLER(12),
+    EXTI_DEFAULT_LINE_HANDLER(13),
+    EXTI_DEFAULT_LINE_HANDLER(14),
+    EXTI_DEFAULT_LINE_HANDLER(15)
+};
+
+// Dispatchers of the EXTI lines with dedicated vectors
+ISR_EXTI_LINE_DISPATCHER(0)
+ISR_EXTI_LINE_DISPATCHER(1)
+ISR_EXTI_LINE_DISPATCHER(2)
+ISR_EXTI_LINE_DISPATCHER(3)
+ISR_EXTI_LINE_DISPATCHER(4)
+ISR_EXTI_LINE_DISPATCHER(5)
+ISR_EXTI_LINE_DISPATCHER(6)
+ISR_EXTI_LINE_DISPATCHER(7)
+ISR_EXTI_LINE_DISPATCHER(8)
+ISR_EXTI_LINE_DISPATCHER(9)
+ISR_EXTI_LINE_DISPATCHER(10)
+ISR_EXTI_LINE_DISPATCHER(11)
+ISR_EXTI_LINE_DISPATCHER(12)
+ISR_EXTI_LINE_DISPATCHER(13)
+ISR_EXTI_LINE_DISPATCHER(14)
+ISR_EXTI_LINE_DISPATCHER(15)
+
+/* ======================================================== Vectors' table ======================================================== */
+
+#if defined(STM32L552xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    EXC_SecureFault,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_RTC,
+    ISR_RTC_S,
+    ISR_TAMP,
+    ISR_TAMP_S,
+    ISR_FLASH,
+    ISR_FLASH_S,
+    ISR_GTZC,
+    ISR_RCC,
+    ISR_RCC_S,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_EXTI5_Dispatcher,
+    ISR_EXTI6_Dispatcher,
+    ISR_EXTI7_Dispatcher,
+    ISR_EXTI8_Dispatcher,
+    ISR_EXTI9_Dispatcher,
+    ISR_EXTI10_Dispatcher,
+    ISR_EXTI11_Dispatcher,
+    ISR_EXTI12_Dispatcher,
+    ISR_EXTI13_Dispatcher,
+    ISR_EXTI14_Dispatcher,
+    ISR_EXTI15_Dispatcher,
+    ISR_DMAMUX1_OVR,
+    ISR_DMAMUX1_OVR_S,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_DMA1_Channel8,
+    ISR_ADC1_2,
+    ISR_DAC,
+    ISR_FDCAN1_IT0,
+    ISR_FDCAN1_IT1,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_TIM5,
+    ISR_TIM6,
+    ISR_TIM7,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_LPUART1,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_COMP,
+    ISR_USB_FS,
+    ISR_CRS,
+    ISR_FMC,
+    ISR_OCTOSPI1,
+    0,
+    ISR_SDMMC1,
+    0,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_DMA2_Channel8,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    ISR_SAI2,
+    ISR_TSC,
+    0,
+    ISR_RNG,
+    0,
+    ISR_HASH,
+    0,
+    ISR_LPTIM3,
+    ISR_SPI3,
+    ISR_I2C4_ER,
+    ISR_I2C4_EV,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_DFSDM1_FLT3,
+    ISR_UCPD1,
+    ISR_ICACHE
+};
+
+#elif defined(STM32L562xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    EXC_SecureFault,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_RTC,
+    ISR_RTC_S,
+    ISR_TAMP,
+    ISR_TAMP_S,
+    ISR_FLASH,
+    ISR_FLASH_S,
+    ISR_GTZC,
+    ISR_RCC,
+    ISR_RCC_S,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_EXTI5_Dispatcher,
+    ISR_EXTI6_Dispatcher,
+    ISR_EXTI7_Dispatcher,
+    ISR_EXTI8_Dispatcher,
+    ISR_EXTI9_Dispatcher,
+    ISR_EXTI10_Dispatcher,
+    ISR_EXTI11_Dispatcher,
+    ISR_EXTI12_Dispatcher,
+    ISR_EXTI13_Dispatcher,
+    ISR_EXTI14_Dispatcher,
+    ISR_EXTI15_Dispatcher,
+    ISR_DMAMUX1_OVR,
+    ISR_DMAMUX1_OVR_S,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_DMA1_Channel8,
+    ISR_ADC1_2,
+    ISR_DAC,
+    ISR_FDCAN1_IT0,
+    ISR_FDCAN1_IT1,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM3,
+    ISR_TIM4,
+    ISR_TIM5,
+    ISR_TIM6,
+    ISR_TIM7,
+    ISR_TIM8_BRK,
+    ISR_TIM8_UP,
+    ISR_TIM8_TRG_COM,
+    ISR_TIM8_CC,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_USART3,
+    ISR_UART4,
+    ISR_UART5,
+    ISR_LPUART1,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_TIM15,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_COMP,
+    ISR_USB_FS,
+    ISR_CRS,
+    ISR_FMC,
+    ISR_OCTOSPI1,
+    0,
+    ISR_SDMMC1,
+    0,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_DMA2_Channel8,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SAI1,
+    ISR_SAI2,
+    ISR_TSC,
+    ISR_AES,
+    ISR_RNG,
+    0,
+    ISR_HASH,
+    ISR_PKA,
+    ISR_LPTIM3,
+    ISR_SPI3,
+    ISR_I2C4_ER,
+    ISR_I2C4_EV,
+    ISR_DFSDM1_FLT0,
+    ISR_DFSDM1_FLT1,
+    ISR_DFSDM1_FLT2,
+    ISR_DFSDM1_FLT3,
+    ISR_UCPD1,
+    ISR_ICACHE,
+    ISR_OTFDEC1
+};
+
+#else
+#error "ISR vectors table is not defined for the target device"
+#endif
 
 /* ================================================================================================================================ */
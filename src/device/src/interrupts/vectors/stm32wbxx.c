@@ -0,0 +1,781 @@
+/* ============================================================================================================================= *//**
+ * @file       stm32wbxx.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 9:58:41 pm
+ * @modified   Saturday, 17th October 2026 9:58:41 pm
+ * @project    stm-utils
+ * @brief      Definitions of interrupt vectors for STM32WBxx devices
+ *
+ * @note Generated by scripts/generate_vectors.py, do not edit
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "device.h"
+#include "interrupts/definitions.h"
+
+/* ========================================================== Definitions ========================================================= */
+
+/**
+ * @note Names for SVC_Handler, PendSV_Handler and SysTick_Handler interrupt
+ *    handlers was set differently to fit RTX-RTOSv5 naming scheme
+ */
+
+// Exception vector's definitions
+ISR_VECTOR           (EXC_NMI);
+ISR_VECTOR           (EXC_HardFault);
+ISR_VECTOR           (EXC_MemoryManagement);
+ISR_VECTOR           (EXC_BusFault);
+ISR_VECTOR           (EXC_UsageFault);
+ISR_VECTOR           (SVC_Handler);
+ISR_VECTOR           (EXC_DebugMonitor);
+ISR_VECTOR           (PendSV_Handler);
+ISR_VECTOR           (SysTick_Handler);
+
+// ISR Vector's definitions
+ISR_VECTOR_FORCED    (ISR_EXTI0_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI1_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI2_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI3_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI4_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI9_5);
+ISR_VECTOR_FORCED    (ISR_EXTI15_10);
+ISR_VECTOR_DISPATCHER(ISR_TIM1_TRG_COM_TIM17);
+ISR_VECTOR           (ISR_WWDG);
+ISR_VECTOR           (ISR_PVD);
+ISR_VECTOR           (ISR_TAMP_STAMP_LSECSS);
+ISR_VECTOR           (ISR_RTC_WKUP);
+ISR_VECTOR           (ISR_FLASH);
+ISR_VECTOR           (ISR_RCC);
+ISR_VECTOR           (ISR_DMA1_Channel1);
+ISR_VECTOR           (ISR_DMA1_Channel2);
+ISR_VECTOR           (ISR_DMA1_Channel3);
+ISR_VECTOR           (ISR_DMA1_Channel4);
+ISR_VECTOR           (ISR_DMA1_Channel5);
+ISR_VECTOR           (ISR_DMA1_Channel6);
+ISR_VECTOR           (ISR_DMA1_Channel7);
+ISR_VECTOR           (ISR_ADC1);
+ISR_VECTOR           (ISR_C2SEV_PWR_C2H);
+ISR_VECTOR           (ISR_TIM1_BRK);
+ISR_VECTOR           (ISR_TIM1_UP);
+ISR_VECTOR           (ISR_TIM1_TRG_COM);
+ISR_VECTOR           (ISR_TIM1_CC);
+ISR_VECTOR           (ISR_TIM2);
+ISR_VECTOR           (ISR_PKA);
+ISR_VECTOR           (ISR_I2C1_EV);
+ISR_VECTOR           (ISR_I2C1_ER);
+ISR_VECTOR           (ISR_SPI1);
+ISR_VECTOR           (ISR_USART1);
+ISR_VECTOR           (ISR_TSC);
+ISR_VECTOR           (ISR_RTC_Alarm);
+ISR_VECTOR           (ISR_PWR_SOTF_BLEACT_802ACT_RFPHASE);
+ISR_VECTOR           (ISR_IPCC_C1_RX);
+ISR_VECTOR           (ISR_IPCC_C1_TX);
+ISR_VECTOR           (ISR_HSEM);
+ISR_VECTOR           (ISR_LPTIM1);
+ISR_VECTOR           (ISR_LPTIM2);
+ISR_VECTOR           (ISR_RNG);
+ISR_VECTOR           (ISR_FPU);
+ISR_VECTOR           (ISR_DMAMUX1_OVR);
+ISR_VECTOR           (ISR_COMP);
+ISR_VECTOR           (ISR_LPUART1);
+ISR_VECTOR           (ISR_AES2);
+ISR_VECTOR           (ISR_USB_HP);
+ISR_VECTOR           (ISR_USB_LP);
+ISR_VECTOR           (ISR_I2C3_EV);
+ISR_VECTOR           (ISR_I2C3_ER);
+ISR_VECTOR           (ISR_SAI1);
+ISR_VECTOR           (ISR_CRS);
+ISR_VECTOR           (ISR_QUADSPI);
+ISR_VECTOR           (ISR_AES1);
+ISR_VECTOR           (ISR_DMA2_Channel1);
+ISR_VECTOR           (ISR_DMA2_Channel2);
+ISR_VECTOR           (ISR_DMA2_Channel3);
+ISR_VECTOR           (ISR_DMA2_Channel4);
+ISR_VECTOR           (ISR_DMA2_Channel5);
+ISR_VECTOR           (ISR_DMA2_Channel6);
+ISR_VECTOR           (ISR_DMA2_Channel7);
+ISR_VECTOR           (ISR_SPI2);
+ISR_VECTOR           (ISR_LCD);
+
+/* ========================================================= Pseud-vectors ======================================================== */
+
+// Pseudo-ISR vectors
+ISR_VECTOR           (ISR_EXTI0);
+ISR_VECTOR           (ISR_EXTI1);
+ISR_VECTOR           (ISR_EXTI2);
+ISR_VECTOR           (ISR_EXTI3);
+ISR_VECTOR           (ISR_EXTI4);
+ISR_VECTOR           (ISR_EXTI5);
+ISR_VECTOR           (ISR_EXTI6);
+ISR_VECTOR           (ISR_EXTI7);
+ISR_VECTOR           (ISR_EXTI8);
+ISR_VECTOR           (ISR_EXTI9);
+ISR_VECTOR           (ISR_EXTI10);
+ISR_VECTOR           (ISR_EXTI11);
+ISR_VECTOR           (ISR_EXTI12);
+ISR_VECTOR           (ISR_EXTI13);
+ISR_VECTOR           (ISR_EXTI14);
+ISR_VECTOR           (ISR_EXTI15);
+ISR_VECTOR           (ISR_TIM17);
+
+/* ================================================= Emulated vectors definitions ================================================= */
+
+// Pending flags of the EXTI lines enabled for the current core
+#define EXTI_PENDING (EXTI->PR1 & EXTI->IMR1)
+
+// Default handlers of the EXTI lines (indexed by line number)
+const vector_function_ptr exti_default_handlers[16] = {
+    ISR_EXTI0,
+    ISR_EXTI1,
+    ISR_EXTI2,
+    ISR_EXTI3,
+    ISR_EXTI4,
+    ISR_EXTI5,
+    ISR_EXTI6,
+    ISR_EXTI7,
+    ISR_EXTI8,
+    ISR_EXTI9,
+    ISR_EXTI10,
+    ISR_EXTI11,
+    ISR_EXTI12,
+    ISR_EXTI13,
+    ISR_EXTI14,
+    ISR_EXTI15
+};
+
+// Handlers of the EXTI lines called by dispatchers (indexed by line number)
+exti_line_handler exti_line_handlers[16] = {
+    EXTI_DEFAULT_LINE_HANDLER(0),
+    EXTI_DEFAULT_LINE_HANDLER(1),
+    EXTI_DEFAULT_LINE_HANDLER(2),
+    EXTI_DEFAULT_LINE_HANDLER(3),
+    EXTI_DEFAULT_LINE_HANDLER(4),
+    EXTI_DEFAULT_LINE_HANDLER(5),
+    EXTI_DEFAULT_LINE_HANDLER(6),
+    EXTI_DEFAULT_LINE_HANDLER(7),
+    EXTI_DEFAULT_LINE_HANDLER(8),
+    EXTI_DEFAULT_LINE_HANDLER(9),
+    EXTI_DEFAULT_LINE_HANDLER(10),
+    EXTI_DEFAULT_LINE_HANDLER(11),
+    EXTI_DEFAULT_LINE_HANDLER(12),
+    EXTI_DEFAULT_LINE_HANDLER(13),
+    EXTI_DEFAULT_LINE_HANDLER(14),
+    EXTI_DEFAULT_LINE_HANDLER(15)
+};
+
+// Dispatchers of the EXTI lines with dedicated vectors
+ISR_EXTI_LINE_DISPATCHER(0)
+ISR_EXTI_LINE_DISPATCHER(1)
+ISR_EXTI_LINE_DISPATCHER(2)
+ISR_EXTI_LINE_DISPATCHER(3)
+ISR_EXTI_LINE_DISPATCHER(4)
+
+// Dispatcher of the EXTI 5-9 lines
+void ISR_EXTI9_5(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(5, 9), exti_line_handlers);
+}
+
+// Dispatcher of the EXTI 10-15 lines
+void ISR_EXTI15_10(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(10, 15), exti_line_handlers);
+}
+
+#if defined(STM32WB30xx) || defined(STM32WB35xx) || defined(STM32WB50xx) || defined(STM32WB55xx) || defined(STM32WB5Mxx)
+
+// Dispatcher of the TIM1_TRG_COM_TIM17 interrupt
+void ISR_TIM1_TRG_COM_TIM17(void) {
+
+    #if defined(TIM1)
+        // Dispatch TRG COM events of TIM1
+        if(TimPends(TIM1, TIM_SR_TIF | TIM_SR_COMIF))
+            ISR_TIM1_TRG_COM();
+    #endif
+
+    #if defined(TIM17)
+        // Dispatch TIM17
+        if(TimPends(TIM17, 0xFFUL))
+            ISR_TIM17();
+    #endif
+}
+
+#endif
+
+/* ======================================================== Vectors' table ======================================================== */
+
+#if defined(STM32WB10xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP_LSECSS,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    0,
+    0,
+    ISR_C2SEV_PWR_C2H,
+    0,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_PKA,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    0,
+    0,
+    ISR_SPI1,
+    0,
+    ISR_USART1,
+    0,
+    0,
+    ISR_TSC,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_PWR_SOTF_BLEACT_802ACT_RFPHASE,
+    ISR_IPCC_C1_RX,
+    ISR_IPCC_C1_TX,
+    ISR_HSEM,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    0,
+    0,
+    0,
+    0,
+    ISR_RNG,
+    ISR_FPU,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMAMUX1_OVR
+};
+
+#elif defined(STM32WB15xx) || defined(STM32WB1Mxx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP_LSECSS,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    0,
+    0,
+    ISR_C2SEV_PWR_C2H,
+    ISR_COMP,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_PKA,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    0,
+    0,
+    ISR_SPI1,
+    0,
+    ISR_USART1,
+    ISR_LPUART1,
+    0,
+    ISR_TSC,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_PWR_SOTF_BLEACT_802ACT_RFPHASE,
+    ISR_IPCC_C1_RX,
+    ISR_IPCC_C1_TX,
+    ISR_HSEM,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    0,
+    0,
+    0,
+    ISR_AES2,
+    ISR_RNG,
+    ISR_FPU,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMAMUX1_OVR
+};
+
+#elif defined(STM32WB30xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP_LSECSS,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    0,
+    0,
+    ISR_C2SEV_PWR_C2H,
+    0,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_PKA,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    0,
+    0,
+    ISR_SPI1,
+    0,
+    ISR_USART1,
+    0,
+    0,
+    0,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_PWR_SOTF_BLEACT_802ACT_RFPHASE,
+    ISR_IPCC_C1_RX,
+    ISR_IPCC_C1_TX,
+    ISR_HSEM,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    0,
+    0,
+    0,
+    ISR_AES2,
+    ISR_RNG,
+    ISR_FPU,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    ISR_DMAMUX1_OVR
+};
+
+#elif defined(STM32WB35xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP_LSECSS,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    ISR_USB_HP,
+    ISR_USB_LP,
+    ISR_C2SEV_PWR_C2H,
+    ISR_COMP,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_PKA,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SPI1,
+    0,
+    ISR_USART1,
+    ISR_LPUART1,
+    ISR_SAI1,
+    0,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_CRS,
+    ISR_PWR_SOTF_BLEACT_802ACT_RFPHASE,
+    ISR_IPCC_C1_RX,
+    ISR_IPCC_C1_TX,
+    ISR_HSEM,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    0,
+    ISR_QUADSPI,
+    ISR_AES1,
+    ISR_AES2,
+    ISR_RNG,
+    ISR_FPU,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_DMAMUX1_OVR
+};
+
+#elif defined(STM32WB50xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP_LSECSS,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    0,
+    0,
+    ISR_C2SEV_PWR_C2H,
+    0,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_PKA,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    0,
+    0,
+    ISR_SPI1,
+    0,
+    ISR_USART1,
+    0,
+    0,
+    0,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    0,
+    ISR_PWR_SOTF_BLEACT_802ACT_RFPHASE,
+    ISR_IPCC_C1_RX,
+    ISR_IPCC_C1_TX,
+    ISR_HSEM,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    0,
+    0,
+    0,
+    ISR_AES2,
+    ISR_RNG,
+    ISR_FPU,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_DMAMUX1_OVR
+};
+
+#elif defined(STM32WB55xx) || defined(STM32WB5Mxx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD,
+    ISR_TAMP_STAMP_LSECSS,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC1,
+    ISR_USB_HP,
+    ISR_USB_LP,
+    ISR_C2SEV_PWR_C2H,
+    ISR_COMP,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM_TIM17,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_PKA,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_LPUART1,
+    ISR_SAI1,
+    ISR_TSC,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_CRS,
+    ISR_PWR_SOTF_BLEACT_802ACT_RFPHASE,
+    ISR_IPCC_C1_RX,
+    ISR_IPCC_C1_TX,
+    ISR_HSEM,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_LCD,
+    ISR_QUADSPI,
+    ISR_AES1,
+    ISR_AES2,
+    ISR_RNG,
+    ISR_FPU,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_DMAMUX1_OVR
+};
+
+#else
+#error "ISR vectors table is not defined for the target device"
+#endif
+
+/* ================================================================================================================================ */
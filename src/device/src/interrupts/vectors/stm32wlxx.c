@@ -2,12 +2,14 @@
  * @file       stm32wlxx.c
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
- * @date       Tuesday, 6th July 2021 1:51:11 pm
- * @modified   Tuesday, 6th July 2021 1:51:11 pm
+ * @date       Saturday, 17th October 2026 9:58:40 pm
+ * @modified   Saturday, 17th October 2026 9:58:40 pm
  * @project    stm-utils
- * @brief      Definitions of interrupt vectors for STMWLxx devices
- *    
- * @copyright Krzysztof Pierczyk © 2022
+ * @brief      Definitions of interrupt vectors for STM32WLxx devices
+ *
+ * @note Generated by scripts/generate_vectors.py, do not edit
+ *
+ * @copyright Krzysztof Pierczyk © 2026
  * /// ============================================================================================================================ */
 
 /* =========================================================== Includes =========================================================== */
@@ -23,139 +25,303 @@
  */
 
 // Exception vector's definitions
-ISR_VECTOR       (EXC_NMI);
-ISR_VECTOR       (EXC_HardFault);
-ISR_VECTOR       (EXC_MemoryManagement);
-ISR_VECTOR       (EXC_BusFault);
-ISR_VECTOR       (EXC_UageFault);
-ISR_VECTOR       (SVC_Handler);
-ISR_VECTOR       (DebugMon_Handler);
-ISR_VECTOR       (PendSV_Handler);
-ISR_VECTOR       (SysTick_Handler);
+ISR_VECTOR           (EXC_NMI);
+ISR_VECTOR           (EXC_HardFault);
+ISR_VECTOR           (EXC_MemoryManagement);
+ISR_VECTOR           (EXC_BusFault);
+ISR_VECTOR           (SVC_Handler);
+ISR_VECTOR           (PendSV_Handler);
+ISR_VECTOR           (SysTick_Handler);
 
 // ISR Vector's definitions
-ISR_VECTOR       (ISR_WWDG);
-ISR_VECTOR       (ISR_PVD_PVM);
-ISR_VECTOR       (ISR_TAMP_STAMP_LSECSS_SSRU);
-ISR_VECTOR       (ISR_RTC_WKUP);
-ISR_VECTOR       (ISR_FLASH);
-ISR_VECTOR       (ISR_RCC);
-ISR_VECTOR       (ISR_EXTI0);
-ISR_VECTOR       (ISR_EXTI1);
-ISR_VECTOR       (ISR_EXTI2);
-ISR_VECTOR       (ISR_EXTI3);
-ISR_VECTOR       (ISR_EXTI4);
-ISR_VECTOR       (ISR_DMA1_Channel1);
-ISR_VECTOR       (ISR_DMA1_Channel2);
-ISR_VECTOR       (ISR_DMA1_Channel3);
-ISR_VECTOR       (ISR_DMA1_Channel4);
-ISR_VECTOR       (ISR_DMA1_Channel5);
-ISR_VECTOR       (ISR_DMA1_Channel6);
-ISR_VECTOR       (ISR_DMA1_Channel7);
-ISR_VECTOR       (ISR_ADC);
-ISR_VECTOR       (ISR_DAC);
-ISR_VECTOR       (ISR_C2SEV_PWR_C2H);
-ISR_VECTOR       (ISR_COMP);
-ISR_VECTOR_FORCED(ISR_EXTI9_5);
-ISR_VECTOR       (ISR_TIM1_BRK);
-ISR_VECTOR       (ISR_TIM1_UP);
-ISR_VECTOR       (ISR_TIM1_TRG_COM);
-ISR_VECTOR       (ISR_TIM1_CC);
-ISR_VECTOR       (ISR_TIM2);
-ISR_VECTOR       (ISR_TIM16);
-ISR_VECTOR       (ISR_TIM17);
-ISR_VECTOR       (ISR_I2C1_EV);
-ISR_VECTOR       (ISR_I2C1_ER);
-ISR_VECTOR       (ISR_I2C2_EV);
-ISR_VECTOR       (ISR_I2C2_ER);
-ISR_VECTOR       (ISR_SPI1);
-ISR_VECTOR       (ISR_SPI2);
-ISR_VECTOR       (ISR_USART1);
-ISR_VECTOR       (ISR_USART2);
-ISR_VECTOR       (ISR_LPUART1);
-ISR_VECTOR       (ISR_LPTIM1);
-ISR_VECTOR       (ISR_LPTIM2);
-ISR_VECTOR_FORCED(ISR_EXTI15_10);
-ISR_VECTOR       (ISR_RTC_Alarm);
-ISR_VECTOR       (ISR_LPTIM3);
-ISR_VECTOR       (ISR_SUBGHZSPI);
-ISR_VECTOR       (ISR_IPCC_C1_RX);
-ISR_VECTOR       (ISR_IPCC_C1_TX);
-ISR_VECTOR       (ISR_HSEM);
-ISR_VECTOR       (ISR_I2C3_EV);
-ISR_VECTOR       (ISR_I2C3_ER);
-ISR_VECTOR       (ISR_SUBGHZ_Radio);
-ISR_VECTOR       (ISR_AES);
-ISR_VECTOR       (ISR_RNG);
-ISR_VECTOR       (ISR_PKA);
-ISR_VECTOR       (ISR_DMA2_Channel1);
-ISR_VECTOR       (ISR_DMA2_Channel2);
-ISR_VECTOR       (ISR_DMA2_Channel3);
-ISR_VECTOR       (ISR_DMA2_Channel4);
-ISR_VECTOR       (ISR_DMA2_Channel5);
-ISR_VECTOR       (ISR_DMA2_Channel6);
-ISR_VECTOR       (ISR_DMA2_Channel7);
-ISR_VECTOR       (ISR_DMAMUX1_OVR);
+ISR_VECTOR_FORCED    (ISR_EXTI0_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI1_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI2_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI3_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI4_Dispatcher);
+ISR_VECTOR_FORCED    (ISR_EXTI1_0);
+ISR_VECTOR_FORCED    (ISR_EXTI3_2);
+ISR_VECTOR_FORCED    (ISR_EXTI15_4);
+ISR_VECTOR_FORCED    (ISR_EXTI9_5);
+ISR_VECTOR_FORCED    (ISR_EXTI15_10);
+ISR_VECTOR_DISPATCHER(ISR_DMA1_Channel1_2_3);
+ISR_VECTOR_DISPATCHER(ISR_DMA1_Channel4_5_6_7);
+ISR_VECTOR_DISPATCHER(ISR_DMA2_DMAMUX1_OVR);
+ISR_VECTOR           (ISR_TZIC_ILA);
+ISR_VECTOR           (ISR_PVD_PVM);
+ISR_VECTOR           (ISR_RTC_LSECSS);
+ISR_VECTOR           (ISR_RCC_FLASH_C1SEV);
+ISR_VECTOR           (ISR_ADC_COMP_DAC);
+ISR_VECTOR           (ISR_LPTIM1);
+ISR_VECTOR           (ISR_LPTIM2);
+ISR_VECTOR           (ISR_LPTIM3);
+ISR_VECTOR           (ISR_TIM1);
+ISR_VECTOR           (ISR_TIM2);
+ISR_VECTOR           (ISR_TIM16);
+ISR_VECTOR           (ISR_TIM17);
+ISR_VECTOR           (ISR_IPCC_C2_RX_C2_TX);
+ISR_VECTOR           (ISR_HSEM);
+ISR_VECTOR           (ISR_RNG);
+ISR_VECTOR           (ISR_AES_PKA);
+ISR_VECTOR           (ISR_I2C1);
+ISR_VECTOR           (ISR_I2C2);
+ISR_VECTOR           (ISR_I2C3);
+ISR_VECTOR           (ISR_SPI1);
+ISR_VECTOR           (ISR_SPI2);
+ISR_VECTOR           (ISR_USART1);
+ISR_VECTOR           (ISR_USART2);
+ISR_VECTOR           (ISR_LPUART1);
+ISR_VECTOR           (ISR_SUBGHZSPI);
+ISR_VECTOR           (ISR_SUBGHZ_Radio);
+ISR_VECTOR           (ISR_WWDG);
+ISR_VECTOR           (ISR_TAMP_STAMP_LSECSS_SSRU);
+ISR_VECTOR           (ISR_RTC_WKUP);
+ISR_VECTOR           (ISR_FLASH);
+ISR_VECTOR           (ISR_RCC);
+ISR_VECTOR           (ISR_DMA1_Channel1);
+ISR_VECTOR           (ISR_DMA1_Channel2);
+ISR_VECTOR           (ISR_DMA1_Channel3);
+ISR_VECTOR           (ISR_DMA1_Channel4);
+ISR_VECTOR           (ISR_DMA1_Channel5);
+ISR_VECTOR           (ISR_DMA1_Channel6);
+ISR_VECTOR           (ISR_DMA1_Channel7);
+ISR_VECTOR           (ISR_ADC);
+ISR_VECTOR           (ISR_DAC);
+ISR_VECTOR           (ISR_C2SEV_PWR_C2H);
+ISR_VECTOR           (ISR_COMP);
+ISR_VECTOR           (ISR_TIM1_BRK);
+ISR_VECTOR           (ISR_TIM1_UP);
+ISR_VECTOR           (ISR_TIM1_TRG_COM);
+ISR_VECTOR           (ISR_TIM1_CC);
+ISR_VECTOR           (ISR_I2C1_EV);
+ISR_VECTOR           (ISR_I2C1_ER);
+ISR_VECTOR           (ISR_I2C2_EV);
+ISR_VECTOR           (ISR_I2C2_ER);
+ISR_VECTOR           (ISR_RTC_Alarm);
+ISR_VECTOR           (ISR_IPCC_C1_RX);
+ISR_VECTOR           (ISR_IPCC_C1_TX);
+ISR_VECTOR           (ISR_I2C3_EV);
+ISR_VECTOR           (ISR_I2C3_ER);
+ISR_VECTOR           (ISR_AES);
+ISR_VECTOR           (ISR_PKA);
+ISR_VECTOR           (ISR_DMA2_Channel1);
+ISR_VECTOR           (ISR_DMA2_Channel2);
+ISR_VECTOR           (ISR_DMA2_Channel3);
+ISR_VECTOR           (ISR_DMA2_Channel4);
+ISR_VECTOR           (ISR_DMA2_Channel5);
+ISR_VECTOR           (ISR_DMA2_Channel6);
+ISR_VECTOR           (ISR_DMA2_Channel7);
+ISR_VECTOR           (ISR_DMAMUX1_OVR);
+
+/* ======================================================== Legacy vectors ======================================================== */
+
+// Vectors under legacy names (handlers defined by the application under these names are called by default
+// handlers of renamed vectors and replace dispatchers of renamed shared interrupts)
+ISR_VECTOR           (DebugMon_Handler);
+ISR_VECTOR           (EXC_UageFault);
+
+// Renamed vectors
+ISR_VECTOR_LEGACY(EXC_DebugMonitor, DebugMon_Handler)
+ISR_VECTOR_LEGACY(EXC_UsageFault, EXC_UageFault)
 
 /* ========================================================= Pseud-vectors ======================================================== */
 
 // Pseudo-ISR vectors
-ISR_VECTOR       (ISR_EXTI5);
-ISR_VECTOR       (ISR_EXTI6);
-ISR_VECTOR       (ISR_EXTI7);
-ISR_VECTOR       (ISR_EXTI8);
-ISR_VECTOR       (ISR_EXTI9);
-ISR_VECTOR       (ISR_EXTI10);
-ISR_VECTOR       (ISR_EXTI11);
-ISR_VECTOR       (ISR_EXTI12);
-ISR_VECTOR       (ISR_EXTI13);
-ISR_VECTOR       (ISR_EXTI14);
-ISR_VECTOR       (ISR_EXTI15);
+ISR_VECTOR           (ISR_EXTI0);
+ISR_VECTOR           (ISR_EXTI1);
+ISR_VECTOR           (ISR_EXTI2);
+ISR_VECTOR           (ISR_EXTI3);
+ISR_VECTOR           (ISR_EXTI4);
+ISR_VECTOR           (ISR_EXTI5);
+ISR_VECTOR           (ISR_EXTI6);
+ISR_VECTOR           (ISR_EXTI7);
+ISR_VECTOR           (ISR_EXTI8);
+ISR_VECTOR           (ISR_EXTI9);
+ISR_VECTOR           (ISR_EXTI10);
+ISR_VECTOR           (ISR_EXTI11);
+ISR_VECTOR           (ISR_EXTI12);
+ISR_VECTOR           (ISR_EXTI13);
+ISR_VECTOR           (ISR_EXTI14);
+ISR_VECTOR           (ISR_EXTI15);
 
 /* ================================================= Emulated vectors definitions ================================================= */
 
-// Dispatcher of the EXTI 10-15 lines
+// Pending flags of the EXTI lines enabled for the current core
+#if defined(CORE_CM0PLUS)
+#define EXTI_PENDING (EXTI->PR1 & EXTI->C2IMR1)
+#else
+#define EXTI_PENDING (EXTI->PR1 & EXTI->IMR1)
+#endif
+
+// Default handlers of the EXTI lines (indexed by line number)
+const vector_function_ptr exti_default_handlers[16] = {
+    ISR_EXTI0,
+    ISR_EXTI1,
+    ISR_EXTI2,
+    ISR_EXTI3,
+    ISR_EXTI4,
+    ISR_EXTI5,
+    ISR_EXTI6,
+    ISR_EXTI7,
+    ISR_EXTI8,
+    ISR_EXTI9,
+    ISR_EXTI10,
+    ISR_EXTI11,
+    ISR_EXTI12,
+    ISR_EXTI13,
+    ISR_EXTI14,
+    ISR_EXTI15
+};
+
+// Handlers of the EXTI lines called by dispatchers (indexed by line number)
+exti_line_handler exti_line_handlers[16] = {
+    EXTI_DEFAULT_LINE_HANDLER(0),
+    EXTI_DEFAULT_LINE_HANDLER(1),
+    EXTI_DEFAULT_LINE_HANDLER(2),
+    EXTI_DEFAULT_LINE_HANDLER(3),
+    EXTI_DEFAULT_LINE_HANDLER(4),
+    EXTI_DEFAULT_LINE_HANDLER(5),
+    EXTI_DEFAULT_LINE_HANDLER(6),
+    EXTI_DEFAULT_LINE_HANDLER(7),
+    EXTI_DEFAULT_LINE_HANDLER(8),
+    EXTI_DEFAULT_LINE_HANDLER(9),
+    EXTI_DEFAULT_LINE_HANDLER(10),
+    EXTI_DEFAULT_LINE_HANDLER(11),
+    EXTI_DEFAULT_LINE_HANDLER(12),
+    EXTI_DEFAULT_LINE_HANDLER(13),
+    EXTI_DEFAULT_LINE_HANDLER(14),
+    EXTI_DEFAULT_LINE_HANDLER(15)
+};
+
+#if (defined(STM32WL55xx) && !defined(CORE_CM0PLUS)) || (defined(STM32WL54xx) && !defined(CORE_CM0PLUS)) || defined(STM32WLE5xx) || \
+    defined(STM32WLE4xx)
+
+// Dispatchers of the EXTI lines with dedicated vectors
+ISR_EXTI_LINE_DISPATCHER(0)
+ISR_EXTI_LINE_DISPATCHER(1)
+ISR_EXTI_LINE_DISPATCHER(2)
+ISR_EXTI_LINE_DISPATCHER(3)
+ISR_EXTI_LINE_DISPATCHER(4)
+
+// Dispatcher of the EXTI 5-9 lines
 void ISR_EXTI9_5(void) {
-	
-    // Get EXTI pending flags
-	unsigned long flags = (EXTI->PR1);
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
 
     // Dispatch lines
-	if(ExtiPends(flags, 5))
-		ISR_EXTI5();
-	if(ExtiPends(flags, 6))
-		ISR_EXTI6();
-	if(ExtiPends(flags, 7))
-		ISR_EXTI7();
-	if(ExtiPends(flags, 8))
-		ISR_EXTI8();
-	if(ExtiPends(flags, 9))
-		ISR_EXTI9();
+    exti_dispatch(flags & ExtiLines(5, 9), exti_line_handlers);
 }
 
 // Dispatcher of the EXTI 10-15 lines
 void ISR_EXTI15_10(void) {
-	
-    // Get EXTI pending flags
-	unsigned long flags = (EXTI->PR1);
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
 
     // Dispatch lines
-	if(ExtiPends(flags, 10))
-		ISR_EXTI10();
-	if(ExtiPends(flags, 11))
-		ISR_EXTI11();
-	if(ExtiPends(flags, 12))
-		ISR_EXTI12();
-	if(ExtiPends(flags, 13))
-		ISR_EXTI13();
-	if(ExtiPends(flags, 14))
-		ISR_EXTI14();
-	if(ExtiPends(flags, 15))
-		ISR_EXTI15();
+    exti_dispatch(flags & ExtiLines(10, 15), exti_line_handlers);
+}
+
+#endif
+
+#if (defined(STM32WL55xx) && defined(CORE_CM0PLUS)) || (defined(STM32WL54xx) && defined(CORE_CM0PLUS))
+
+// Dispatcher of the EXTI 0-1 lines
+void ISR_EXTI1_0(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(0, 1), exti_line_handlers);
+}
+
+// Dispatcher of the EXTI 2-3 lines
+void ISR_EXTI3_2(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(2, 3), exti_line_handlers);
+}
+
+// Dispatcher of the EXTI 4-15 lines
+void ISR_EXTI15_4(void) {
+
+    // Get pending flags of the enabled lines
+    unsigned long flags = EXTI_PENDING;
+
+    // Dispatch lines
+    exti_dispatch(flags & ExtiLines(4, 15), exti_line_handlers);
+}
+
+// Dispatcher of the DMA1_Channel1_2_3 interrupt
+void ISR_DMA1_Channel1_2_3(void) {
+
+    #if defined(DMA1)
+        // Get pending flags of the DMA1 channels with enabled interrupts
+        unsigned long dma1_flags = DMA1->ISR & (
+            DmaChannelEnabled(DMA1, 1) |
+            DmaChannelEnabled(DMA1, 2) |
+            DmaChannelEnabled(DMA1, 3)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma1_vectors[] = { ISR_DMA1_Channel1, ISR_DMA1_Channel2, ISR_DMA1_Channel3 };
+        isr_dispatch(dma1_flags, 2, dma1_vectors);
+    #endif
+}
+
+// Dispatcher of the DMA1_Channel4_5_6_7 interrupt
+void ISR_DMA1_Channel4_5_6_7(void) {
+
+    #if defined(DMA1)
+        // Get pending flags of the DMA1 channels with enabled interrupts
+        unsigned long dma1_flags = DMA1->ISR & (
+            DmaChannelEnabled(DMA1, 4) |
+            DmaChannelEnabled(DMA1, 5) |
+            DmaChannelEnabled(DMA1, 6) |
+            DmaChannelEnabled(DMA1, 7)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma1_vectors[] = { 0, 0, 0, ISR_DMA1_Channel4, ISR_DMA1_Channel5, ISR_DMA1_Channel6, ISR_DMA1_Channel7 };
+        isr_dispatch(dma1_flags, 2, dma1_vectors);
+    #endif
+}
+
+// Dispatcher of the DMA2_DMAMUX1_OVR interrupt
+void ISR_DMA2_DMAMUX1_OVR(void) {
+
+    #if defined(DMA2)
+        // Get pending flags of the DMA2 channels with enabled interrupts
+        unsigned long dma2_flags = DMA2->ISR & (
+            DmaChannelEnabled(DMA2, 1) |
+            DmaChannelEnabled(DMA2, 2) |
+            DmaChannelEnabled(DMA2, 3) |
+            DmaChannelEnabled(DMA2, 4) |
+            DmaChannelEnabled(DMA2, 5) |
+            DmaChannelEnabled(DMA2, 6) |
+            DmaChannelEnabled(DMA2, 7)
+        );
+        // Dispatch channels (4 flags per channel)
+        static const vector_function_ptr dma2_vectors[] = { ISR_DMA2_Channel1, ISR_DMA2_Channel2, ISR_DMA2_Channel3, ISR_DMA2_Channel4, ISR_DMA2_Channel5, ISR_DMA2_Channel6, ISR_DMA2_Channel7 };
+        isr_dispatch(dma2_flags, 2, dma2_vectors);
+    #endif
+
+    #if defined(DMAMUX1_ChannelStatus)
+        // Dispatch overrun of the DMAMUX1
+        if(DMAMUX1_ChannelStatus->CSR | DMAMUX1_RequestGenStatus->RGSR)
+            ISR_DMAMUX1_OVR();
+    #endif
 }
 
+#endif
+
 /* ======================================================== Vectors' table ======================================================== */
 
+#if (defined(STM32WL55xx) && defined(CORE_CM0PLUS)) || (defined(STM32WL54xx) && defined(CORE_CM0PLUS))
+
 const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
 
     // Stack pointer
@@ -163,25 +329,81 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     // Reset handler
     reser_handler,
 
-    /* ----------------------------- Exception vectors ----------------------------- */    
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    0,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_TZIC_ILA,
+    ISR_PVD_PVM,
+    ISR_RTC_LSECSS,
+    ISR_RCC_FLASH_C1SEV,
+    ISR_EXTI1_0,
+    ISR_EXTI3_2,
+    ISR_EXTI15_4,
+    ISR_ADC_COMP_DAC,
+    ISR_DMA1_Channel1_2_3,
+    ISR_DMA1_Channel4_5_6_7,
+    ISR_DMA2_DMAMUX1_OVR,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_LPTIM3,
+    ISR_TIM1,
+    ISR_TIM2,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_IPCC_C2_RX_C2_TX,
+    ISR_HSEM,
+    ISR_RNG,
+    ISR_AES_PKA,
+    ISR_I2C1,
+    ISR_I2C2,
+    ISR_I2C3,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_LPUART1,
+    ISR_SUBGHZSPI,
+    ISR_SUBGHZ_Radio
+};
+
+#elif (defined(STM32WL55xx) && !defined(CORE_CM0PLUS)) || (defined(STM32WL54xx) && !defined(CORE_CM0PLUS))
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
 
-    /**
-     * @note Exception vector No. -6 is reserved by ARM. It is not used in
-     *    Cortex-M0 cores. Here, the vector is used to store address of the
-     *    memory section storing version data of the firmware.
-     */
+    /* ----------------------------- Exception vectors ----------------------------- */
 
     EXC_NMI,
     EXC_HardFault,
     EXC_MemoryManagement,
     EXC_BusFault,
-    EXC_UageFault,
+    EXC_UsageFault,
     0,
     0,
     0,
     0,
     SVC_Handler,
-    DebugMon_Handler,
+    EXC_DebugMonitor,
     0,
     PendSV_Handler,
     SysTick_Handler,
@@ -194,11 +416,11 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     ISR_RTC_WKUP,
     ISR_FLASH,
     ISR_RCC,
-    ISR_EXTI0,
-    ISR_EXTI1,
-    ISR_EXTI2,
-    ISR_EXTI3,
-    ISR_EXTI4,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
     ISR_DMA1_Channel1,
     ISR_DMA1_Channel2,
     ISR_DMA1_Channel3,
@@ -249,7 +471,103 @@ const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vecto
     ISR_DMA2_Channel5,
     ISR_DMA2_Channel6,
     ISR_DMA2_Channel7,
-    ISR_DMAMUX1_OVR,
+    ISR_DMAMUX1_OVR
+};
+
+#elif defined(STM32WLE5xx) || defined(STM32WLE4xx)
+
+const vector_function_ptr isr_vectors_table[] __attribute__((section(".isr_vector"))) = {
+
+    // Stack pointer
+    (vector_function_ptr) (long) &_estack,
+    // Reset handler
+    reser_handler,
+
+    /* ----------------------------- Exception vectors ----------------------------- */
+
+    EXC_NMI,
+    EXC_HardFault,
+    EXC_MemoryManagement,
+    EXC_BusFault,
+    EXC_UsageFault,
+    0,
+    0,
+    0,
+    0,
+    SVC_Handler,
+    EXC_DebugMonitor,
+    0,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* ----------------------------- Interrupt vectors ----------------------------- */
+
+    ISR_WWDG,
+    ISR_PVD_PVM,
+    ISR_TAMP_STAMP_LSECSS_SSRU,
+    ISR_RTC_WKUP,
+    ISR_FLASH,
+    ISR_RCC,
+    ISR_EXTI0_Dispatcher,
+    ISR_EXTI1_Dispatcher,
+    ISR_EXTI2_Dispatcher,
+    ISR_EXTI3_Dispatcher,
+    ISR_EXTI4_Dispatcher,
+    ISR_DMA1_Channel1,
+    ISR_DMA1_Channel2,
+    ISR_DMA1_Channel3,
+    ISR_DMA1_Channel4,
+    ISR_DMA1_Channel5,
+    ISR_DMA1_Channel6,
+    ISR_DMA1_Channel7,
+    ISR_ADC,
+    ISR_DAC,
+    0,
+    ISR_COMP,
+    ISR_EXTI9_5,
+    ISR_TIM1_BRK,
+    ISR_TIM1_UP,
+    ISR_TIM1_TRG_COM,
+    ISR_TIM1_CC,
+    ISR_TIM2,
+    ISR_TIM16,
+    ISR_TIM17,
+    ISR_I2C1_EV,
+    ISR_I2C1_ER,
+    ISR_I2C2_EV,
+    ISR_I2C2_ER,
+    ISR_SPI1,
+    ISR_SPI2,
+    ISR_USART1,
+    ISR_USART2,
+    ISR_LPUART1,
+    ISR_LPTIM1,
+    ISR_LPTIM2,
+    ISR_EXTI15_10,
+    ISR_RTC_Alarm,
+    ISR_LPTIM3,
+    0,
+    0,
+    0,
+    ISR_HSEM,
+    ISR_I2C3_EV,
+    ISR_I2C3_ER,
+    ISR_SUBGHZ_Radio,
+    ISR_AES,
+    ISR_RNG,
+    ISR_PKA,
+    ISR_DMA2_Channel1,
+    ISR_DMA2_Channel2,
+    ISR_DMA2_Channel3,
+    ISR_DMA2_Channel4,
+    ISR_DMA2_Channel5,
+    ISR_DMA2_Channel6,
+    ISR_DMA2_Channel7,
+    ISR_DMAMUX1_OVR
 };
 
+#else
+#error "ISR vectors table is not defined for the target device"
+#endif
+
 /* ================================================================================================================================ */
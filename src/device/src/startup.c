@@ -14,19 +14,69 @@
 
 #include "device.h"
 #include "device/startup.h"
+#include "startup/memory.h"
+
+/* ============================================================= Types ============================================================ */
+
+/// Entry of the copy table describing section initialized from FLASH (generated by the linker script)
+typedef struct {
+
+    // Load address of the section's initializers
+    const unsigned long *src;
+    // Start of the section
+    unsigned long *dst;
+    // End of the section
+    unsigned long *end;
+
+} copy_table_entry;
+
+/// Entry of the zero table describing section zeroed at startup (generated by the linker script)
+typedef struct {
+
+    // Start of the section
+    unsigned long *start;
+    // End of the section
+    unsigned long *end;
+
+} zero_table_entry;
 
 /* ========================================================= Declarations ========================================================= */
 
-// Start of the .data section
-extern unsigned long _sidata;
-// Start of the .data section
-extern unsigned long _sdata;
-// End of the .data section
-extern unsigned long _edata;
-// Start of the .bss section
-extern unsigned long _sbss;
-// End of the .bss section
-extern unsigned long _ebss;
+// Start of the copy table
+extern const copy_table_entry __copy_table_start[];
+// End of the copy table
+extern const copy_table_entry __copy_table_end[];
+// Start of the copy table's part describing memories retained in Standby mode
+extern const copy_table_entry __copy_table_retained[];
+// Start of the zero table
+extern const zero_table_entry __zero_table_start[];
+// Start of the zero table's part describing memories retained in Standby mode
+extern const zero_table_entry __zero_table_retained[];
+// End of the zero table
+extern const zero_table_entry __zero_table_end[];
+// Start of the ECC table
+extern const zero_table_entry __ecc_table_start[];
+// End of the ECC table
+extern const zero_table_entry __ecc_table_end[];
+
+// Start of the RAM copy of the ISR vectors table
+extern vector_function_ptr __ram_vectors_start[];
+// End of the RAM copy of the ISR vectors table
+extern vector_function_ptr __ram_vectors_end[];
+
+// Start of the section zeroed on demand
+extern unsigned long __deferred_bss_start;
+// End of the section zeroed on demand
+extern unsigned long __deferred_bss_end;
+
+// Starts zeroing the given range with DMA (STARTUP_DMA_MEMORY_INIT option)
+extern void startup_dma_zero_begin(unsigned long *start, unsigned long *end);
+
+// Redirects interrupt vectors to the profiling trampoline (ISR_PROFILING option)
+extern void interrupts_profiling_init(void);
+
+// Sets up priority of the PendSV draining deferred work (DEFERRED_WORK option)
+extern void deferred_work_init(void);
 
 // Application's entrypoint
 extern int main(void);
@@ -34,6 +84,44 @@ extern int main(void);
 extern void __libc_init_array(void);
 extern void __libc_fini_array(void);
 
+/* ========================================================= Configuration ======================================================== */
+
+// Warm boot detection requires Standby flag of the PWR module
+#ifdef STM_UTILS_STARTUP_WARM_BOOT
+#if !defined(PWR_EXTSCR_C1SBF) && !defined(PWR_SR1_SBF) && !defined(PWR_CSR_SBF)
+#error "Target device does not provide Standby flag required by the warm boot (disable STARTUP_WARM_BOOT option)"
+#endif
+#endif
+
+// Index of the backup register holding the warm boot signature
+#ifndef STARTUP_WARM_BOOT_BACKUP_REGISTER
+#define STARTUP_WARM_BOOT_BACKUP_REGISTER 1
+#endif
+
+// Backup register holding the warm boot signature
+#if defined(TAMP)
+#define WARM_BOOT_BACKUP_REGISTER ((&TAMP->BKP0R)[STARTUP_WARM_BOOT_BACKUP_REGISTER])
+#elif defined(RTC)
+#define WARM_BOOT_BACKUP_REGISTER ((&RTC->BKP0R)[STARTUP_WARM_BOOT_BACKUP_REGISTER])
+#endif
+
+// Warm boot signature ('WARM')
+#define WARM_BOOT_SIGNATURE 0x4D524157UL
+
+/* ======================================================= Global variables ======================================================= */
+
+#ifdef STM_UTILS_STARTUP_BOOT_TIMING
+STM_NOINIT startup_boot_timing startup_boot_timing_record;
+#endif
+
+/* ======================================================= Static variables ======================================================= */
+
+// Whether the current boot is a warm boot (kept in .noinit as it is set before memory initialization)
+STM_NOINIT static bool warm_boot;
+
+// Start of the part of the `.deferred_bss` section that has not been zeroed yet
+static unsigned long *deferred_zero_cursor = &__deferred_bss_start;
+
 /* ====================================================== Static definitions ====================================================== */
 
 /**
@@ -50,6 +138,388 @@ static void early_cpu_setup(void) {
     #ifdef SCB_CCR_DIV_0_TRP_Msk
         SCB->CCR |= SCB_CCR_DIV_0_TRP_Msk;
     #endif
+
+    // Make sure that the stack is 8-byte aligned on exception entry as ISRs do not realign it (Cortex-M3 r1 cores reset
+    // with STKALIGN cleared, other cores reset with the bit set)
+    #if defined(STM_UTILS_ISR_PLAIN_HANDLERS) && defined(SCB_CCR_STKALIGN_Msk)
+        SCB->CCR |= SCB_CCR_STKALIGN_Msk;
+    #endif
+
+    // Enable flash accelerators and caches (performance profile)
+    #ifdef STM_UTILS_PERFORMANCE_PROFILE
+
+        // Enable 64-bit flash access (L1, required by the prefetch)
+        #ifdef FLASH_ACR_ACC64
+            FLASH->ACR |= FLASH_ACR_ACC64;
+        #endif
+        // Enable flash prefetch
+        #if defined(FLASH_ACR_PRFTEN)
+            FLASH->ACR |= FLASH_ACR_PRFTEN;
+        #elif defined(FLASH_ACR_PRFTBE)
+            FLASH->ACR |= FLASH_ACR_PRFTBE;
+        #endif
+        // Enable flash instruction and data caches
+        #ifdef FLASH_ACR_ICEN
+            FLASH->ACR |= FLASH_ACR_ICEN;
+        #endif
+        #ifdef FLASH_ACR_DCEN
+            FLASH->ACR |= FLASH_ACR_DCEN;
+        #endif
+        // Enable ART accelerator (F7)
+        #ifdef FLASH_ACR_ARTEN
+            FLASH->ACR |= FLASH_ACR_ARTEN;
+        #endif
+        // Enable flash preread and buffer cache (L0)
+        #ifdef FLASH_ACR_PRE_READ
+            FLASH->ACR |= FLASH_ACR_PRE_READ;
+        #endif
+        #ifdef FLASH_ACR_DISAB_BUF
+            FLASH->ACR &= ~FLASH_ACR_DISAB_BUF;
+        #endif
+
+        // Enable instruction cache (L5)
+        #if defined(ICACHE) && defined(ICACHE_CR_EN)
+            ICACHE->CR |= ICACHE_CR_EN;
+        #endif
+
+        // Enable branch prediction (Cortex-M7)
+        #ifdef SCB_CCR_BP_Msk
+            SCB->CCR |= SCB_CCR_BP_Msk;
+            __DSB();
+            __ISB();
+        #endif
+        // Enable core caches (Cortex-M7)
+        #if defined(__ICACHE_PRESENT) && (__ICACHE_PRESENT == 1U)
+            SCB_EnableICache();
+        #endif
+        #if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+            SCB_EnableDCache();
+        #endif
+
+    #endif
+}
+
+
+/**
+ * @brief Copies ISR vectors table to RAM and redirects vector fetches to the copy (RAM_VECTOR_TABLE option)
+ * 
+ * @note Cortex-M0 cores of F0 devices lack VTOR and so SRAM is remapped at 0x00000000 with SYSCFG instead (this is why
+ *    the copy is placed at the start of the RAM region)
+ */
+static inline void vectors_relocate(void) {
+
+    #ifdef STM_UTILS_RAM_VECTOR_TABLE
+
+        // Copy the table
+        const vector_function_ptr *src = isr_vectors_table;
+        for(vector_function_ptr *dst = __ram_vectors_start; dst < __ram_vectors_end; ++dst, ++src)
+            *dst = *src;
+
+        // Redirect vector fetches to the copy
+        #if defined(STM32MCU_MAJOR_TYPE_F0)
+            RCC->APB2ENR  |= RCC_APB2ENR_SYSCFGEN;
+            SYSCFG->CFGR1 |= SYSCFG_CFGR1_MEM_MODE;
+        #else
+            SCB->VTOR = (unsigned long) __ram_vectors_start;
+        #endif
+        __DSB();
+        __ISB();
+
+    #endif
+}
+
+
+/**
+ * @brief Redirects interrupt vectors of the RAM copy of the ISR vectors table to the profiling trampoline (ISR_PROFILING 
+ *    option)
+ * 
+ * @note Called after .bss is zeroed as the profiling overhead measured here is kept in .bss
+ */
+static inline void vectors_profile(void) {
+
+    #ifdef STM_UTILS_ISR_PROFILING
+        interrupts_profiling_init();
+    #endif
+}
+
+
+/**
+ * @brief Sets up the PendSV handler draining the deferred work queue (DEFERRED_WORK option, bare-metal builds only)
+ */
+static inline void deferred_work_setup(void) {
+
+    #if defined(STM_UTILS_DEFERRED_WORK) && !defined(STM_UTILS_DEFERRED_WORK_RTOS)
+        deferred_work_init();
+    #endif
+}
+
+
+/**
+ * @brief Starts the counter used to measure boot phases (DWT cycle counter if present, SysTick otherwise)
+ * 
+ * @note SysTick counts down with 24-bit resolution and so the fallback measurement wraps after 2^24 cycles. SysTick
+ *    is expected to be reconfigured by the application (HAL, RTOS) after boot
+ */
+static inline void boot_timing_start(void) {
+
+    #ifdef STM_UTILS_STARTUP_BOOT_TIMING
+
+        // Invalidate the record
+        startup_boot_timing_record.magic = 0;
+
+        // Try to start the DWT cycle counter
+        #if defined(DWT_CTRL_CYCCNTENA_Msk) && defined(CoreDebug_DEMCR_TRCENA_Msk)
+
+            // Enable DWT
+            CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+            // Unlock access to DWT registers (Cortex-M7 only)
+            #if (__CORTEX_M == 7U)
+                DWT->LAR = 0xC5ACCE55UL;
+            #endif
+
+            // Start counter (if implemented)
+            if(!(DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk)) {
+                DWT->CYCCNT = 0;
+                DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+                startup_boot_timing_record.counter = STARTUP_BOOT_TIMING_COUNTER_DWT;
+                return;
+            }
+
+        #endif
+
+        // Otherwise, fall back to SysTick counting down from the maximal value with the core clock
+        SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+        SysTick->VAL  = 0;
+        SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+        startup_boot_timing_record.counter = STARTUP_BOOT_TIMING_COUNTER_SYSTICK;
+
+    #endif
+}
+
+
+/**
+ * @brief Records end of the boot @p phase
+ */
+static inline void boot_timing_record(startup_boot_phase phase) {
+
+    #ifdef STM_UTILS_STARTUP_BOOT_TIMING
+
+        #if defined(DWT_CTRL_CYCCNTENA_Msk) && defined(CoreDebug_DEMCR_TRCENA_Msk)
+            if(startup_boot_timing_record.counter == STARTUP_BOOT_TIMING_COUNTER_DWT) {
+                startup_boot_timing_record.timestamps[phase] = DWT->CYCCNT;
+                return;
+            }
+        #endif
+
+        startup_boot_timing_record.timestamps[phase] = SysTick_LOAD_RELOAD_Msk - SysTick->VAL;
+
+    #endif
+}
+
+
+/**
+ * @brief Marks the boot timing record as complete
+ */
+static inline void boot_timing_finish(void) {
+
+    #ifdef STM_UTILS_STARTUP_BOOT_TIMING
+        startup_boot_timing_record.frequency = SystemCoreClock;
+        startup_boot_timing_record.magic     = STARTUP_BOOT_TIMING_MAGIC;
+    #endif
+}
+
+
+/**
+ * @brief Checks whether the MCU wakes up from Standby mode with warm boot armed by startup_warm_boot_arm()
+ */
+static inline bool warm_boot_detect(void) {
+
+    #ifdef STM_UTILS_STARTUP_WARM_BOOT
+
+        // Enable clock of the PWR module and of the RTC registers (if required)
+        #if defined(RCC_APB1ENR1_PWREN)
+            RCC->APB1ENR1 |= RCC_APB1ENR1_PWREN;
+        #elif defined(RCC_APB1ENR_PWREN)
+            RCC->APB1ENR |= RCC_APB1ENR_PWREN;
+        #endif
+        #if defined(RCC_APB1ENR1_RTCAPBEN)
+            RCC->APB1ENR1 |= RCC_APB1ENR1_RTCAPBEN;
+            (void) RCC->APB1ENR1;
+        #endif
+
+        // Check Standby flag of the core
+        #if defined(PWR_EXTSCR_C1SBF) && defined(CORE_CM0PLUS)
+            bool standby = (PWR->EXTSCR & PWR_EXTSCR_C2SBF);
+        #elif defined(PWR_EXTSCR_C1SBF)
+            bool standby = (PWR->EXTSCR & PWR_EXTSCR_C1SBF);
+        #elif defined(PWR_SR1_SBF)
+            bool standby = (PWR->SR1 & PWR_SR1_SBF);
+        #else
+            bool standby = (PWR->CSR & PWR_CSR_SBF);
+        #endif
+
+        // Check signature
+        return standby && (WARM_BOOT_BACKUP_REGISTER == WARM_BOOT_SIGNATURE);
+
+    #else
+        return false;
+    #endif
+}
+
+
+/**
+ * @brief Makes code copied to RAM visible to the instruction fetches (.ramfunc, .itcm_text and .ccmram_text sections)
+ * 
+ * @note Core caches of Cortex-M7 may be enabled before the copy. Copied code is written back from the data cache and stale
+ *    lines are dropped from the instruction cache
+ */
+static inline void code_sync(void) {
+
+    #if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        if(SCB->CCR & SCB_CCR_DC_Msk)
+            SCB_CleanDCache();
+    #endif
+    #if defined(__ICACHE_PRESENT) && (__ICACHE_PRESENT == 1U)
+        if(SCB->CCR & SCB_CCR_IC_Msk)
+            SCB_InvalidateICache();
+    #endif
+
+    __DSB();
+    __ISB();
+}
+
+
+/**
+ * @brief Copies words from @p src into the [@p dst, @p end) range (with bursts if enabled, see startup/memory.h)
+ * 
+ * @note Both ranges are required to be aligned to 8 bytes (what is guaranteed by the linker script)
+ */
+static inline void memory_copy(const unsigned long *src, unsigned long *dst, const unsigned long *end) {
+
+    #if defined(STM_UTILS_STARTUP_BURST_MEMORY_INIT) && defined(STARTUP_BURST_SUPPORTED)
+        memory_copy_burst(src, dst, end);
+    #else
+        memory_copy_words(src, dst, end);
+    #endif
+}
+
+
+/**
+ * @brief Expands LZ-compressed stream @p src into the [@p dst, @p end) range
+ * 
+ * @details The stream is a sequence of blocks, each consisting of: a token byte (upper nibble - number of literals, 
+ *    lower nibble - length of the match minus 4), extension bytes of the literals count (present if the nibble is 15,
+ *    added until a byte other than 255 is read), literals, 16-bit little-endian offset of the match (counted backwards
+ *    from the current output position) and extension bytes of the match length. The stream ends when the output
+ *    range is filled. Streams are produced by the src/device/scripts/compress_data.py script
+ */
+#ifdef STM_UTILS_STARTUP_COMPRESSED_DATA
+__attribute__ ((noinline, used)) static void memory_decompress(const unsigned char *src, unsigned char *dst, const unsigned char *end) {
+
+    while(dst < end) {
+
+        // Read token
+        unsigned long token = *(src++);
+
+        // Copy literals
+        unsigned long length = token >> 4;
+        if(length == 15) {
+            unsigned char extension;
+            do {
+                extension = *(src++);
+                length += extension;
+            } while(extension == 255);
+        }
+        while(length--)
+            *(dst++) = *(src++);
+
+        // Check if the last block has been processed
+        if(dst >= end)
+            break;
+
+        // Read offset of the match
+        const unsigned char *match = dst - (src[0] | (src[1] << 8));
+        src += 2;
+
+        // Copy match (possibly overlapping with the output)
+        length = token & 0xFUL;
+        if(length == 15) {
+            unsigned char extension;
+            do {
+                extension = *(src++);
+                length += extension;
+            } while(extension == 255);
+        }
+        length += 4;
+        while(length--)
+            *(dst++) = *(match++);
+    }
+}
+#endif
+
+
+/**
+ * @brief Fills the [@p dst, @p end) range with zeros (with bursts if enabled, see startup/memory.h)
+ * 
+ * @note The range is required to be aligned to 8 bytes (what is guaranteed by the linker script)
+ */
+static inline void memory_zero(unsigned long *dst, const unsigned long *end) {
+
+    #if defined(STM_UTILS_STARTUP_BURST_MEMORY_INIT) && defined(STARTUP_BURST_SUPPORTED)
+        memory_zero_burst(dst, end);
+    #else
+        memory_zero_words(dst, end);
+    #endif
+}
+
+
+/**
+ * @brief Initializes ECC (parity) of memory banks listed in the ECC table by writing them with zeros. Banks are
+ *    initialized only after power-on (brown-out) reset so that content of RAM (e.g. `.noinit` section) is retained
+ *    across other resets
+ * 
+ * @note Part of the bank above the current stack pointer (frame of the reset handler) is left untouched. For this reason 
+ *    the routine is forcibly inlined (no stack frame may be created below the stack pointer while banks are zeroed)
+ * @note Reset flags need to be cleared by the application (RMVF bit) so that banks are not reinitialized on subsequent
+ *    software resets
+ */
+__attribute__ ((always_inline)) static inline void ecc_init(void) {
+
+    #ifdef STM_UTILS_STARTUP_ECC_INIT
+
+        // Check reset cause
+        #if defined(RCC_RSR_PORRSTF)
+            if(!(RCC->RSR & (RCC_RSR_PORRSTF | RCC_RSR_BORRSTF)))
+                return;
+        #elif defined(RCC_CSR_PORRSTF)
+            if(!(RCC->CSR & (RCC_CSR_PORRSTF | RCC_CSR_BORRSTF)))
+                return;
+        #elif defined(RCC_CSR_BORRSTF)
+            if(!(RCC->CSR & RCC_CSR_BORRSTF))
+                return;
+        #endif
+
+        // Current stack pointer (aligned down to 8 bytes)
+        unsigned long *sp = (unsigned long *) (__get_MSP() & ~7UL);
+
+        // Initialize banks
+        for(const zero_table_entry *entry = __ecc_table_start; entry < __ecc_table_end; ++entry) {
+
+            // Skip stack frame of the reset handler
+            unsigned long *end = entry->end;
+            if(entry->start < sp && sp < end)
+                end = sp;
+
+            // Use the widest stores available
+            #ifdef STARTUP_BURST_SUPPORTED
+                memory_zero_burst(entry->start, end);
+            #else
+                for(unsigned long *dst = entry->start; dst < end; ++dst)
+                    *dst = 0;
+            #endif
+        }
+
+    #endif
 }
 
 /* ========================================================== Definitions ========================================================= */
@@ -57,30 +527,162 @@ static void early_cpu_setup(void) {
 void stub_function() { }
 
 
+// Default clock hooks (if not provided by the library itself; the weak definition would prevent the linker from pulling
+// the library's implementation out of the archive)
+#ifndef STM_UTILS_STARTUP_CLOCK_INIT
+
+void startup_clock_begin(void) __attribute__ ((weak, alias("stub_function")));
+
+
+void startup_clock_end(void) __attribute__ ((weak, alias("stub_function")));
+
+#endif
+
+
 void startup_extension(void) __attribute__ ((weak, alias("stub_function")));
 
 
+// Default DMA wait routine (if DMA memory initialization is not provided by the library)
+#ifndef STM_UTILS_STARTUP_DMA_MEMORY_INIT
+void startup_dma_zero_wait(void) __attribute__ ((weak, alias("stub_function")));
+#endif
+
+
+void warm_start_extension(void) __attribute__ ((weak, alias("stub_function")));
+
+
 void exit_extension(void) __attribute__ ((weak, alias("stub_function")));
 
 
+bool startup_is_warm_boot(void) {
+    return warm_boot;
+}
+
+
+#ifdef STM_UTILS_STARTUP_WARM_BOOT
+
+void startup_warm_boot_arm(void) {
+    WARM_BOOT_BACKUP_REGISTER = WARM_BOOT_SIGNATURE;
+}
+
+
+void startup_warm_boot_disarm(void) {
+    WARM_BOOT_BACKUP_REGISTER = 0;
+}
+
+#endif
+
+
+void startup_deferred_zero(void) {
+    memory_zero(deferred_zero_cursor, &__deferred_bss_end);
+    deferred_zero_cursor = &__deferred_bss_end;
+}
+
+
+bool startup_deferred_zero_step(unsigned long size) {
+
+    // Limit the chunk to the end of the section (before rounding, so that huge sizes do not wrap around)
+    unsigned long remaining = (unsigned long) &__deferred_bss_end - (unsigned long) deferred_zero_cursor;
+    if(size > remaining)
+        size = remaining;
+
+    // Round size up to the multiple of 8 bytes (alignment of the section, the remaining length is already aligned)
+    size = (size + 7UL) & ~7UL;
+    unsigned long *end = (unsigned long *) ((unsigned long) deferred_zero_cursor + size);
+
+    // Zero the chunk
+    memory_zero(deferred_zero_cursor, end);
+    deferred_zero_cursor = end;
+
+    return startup_deferred_zero_done();
+}
+
+
+bool startup_deferred_zero_done(void) {
+    return (deferred_zero_cursor == &__deferred_bss_end);
+}
+
+
 void reser_handler(void) {
 
+    // Initialize ECC of memory banks (if enabled) before any data is written to them
+    ecc_init();
+
+    // Start measuring boot time (if enabled)
+    boot_timing_start();
+
 	// Initialize basic functions of CPU
 	early_cpu_setup();
+    // Move ISR vectors table to RAM (if enabled)
+    vectors_relocate();
+    boot_timing_record(STARTUP_BOOT_PHASE_EARLY_CPU_SETUP);
+
+    // Check whether the MCU wakes up from Standby with retained memories
+    warm_boot = warm_boot_detect();
 
-    // Copy the data segment initializers from flash to SRAM.
-    for(unsigned long *src = &_sidata, *dst = &_sdata; dst < &_edata; )
-        *(dst++) = *(src++);
+    // Start clock sources (overlapped with memory initialization)
+    startup_clock_begin();
 
-    // Zero fill the bss segment
-    for(unsigned long *dst = &_sbss; dst < &_ebss; )
-        *(dst++) = 0;
+    // Copy initializers of all data sections and code executed from RAM from flash to SRAM (except retained memories on
+    // warm boot)
+    const copy_table_entry *copy_table_end = warm_boot ? __copy_table_retained : __copy_table_end;
+    for(const copy_table_entry *entry = __copy_table_start; entry < copy_table_end; ++entry) {
+
+        // Expand initializers compressed by the post-link step (marked with LSB of the source address)
+        #ifdef STM_UTILS_STARTUP_COMPRESSED_DATA
+            if((unsigned long) entry->src & 1UL) {
+                memory_decompress(
+                    (const unsigned char *) ((unsigned long) entry->src & ~1UL),
+                    (unsigned char *) entry->dst,
+                    (const unsigned char *) entry->end
+                );
+                continue;
+            }
+        #endif
+
+        memory_copy(entry->src, entry->dst, entry->end);
+    }
+    code_sync();
+    boot_timing_record(STARTUP_BOOT_PHASE_DATA_COPY);
+
+    // Zero fill all bss sections (the .dma_bss, listed first, is zeroed by DMA in the background if enabled; retained 
+    // memories are skipped on warm boot)
+    const zero_table_entry *zero_table_end = warm_boot ? __zero_table_retained : __zero_table_end;
+    const zero_table_entry *entry = __zero_table_start;
+    #ifdef STM_UTILS_STARTUP_DMA_MEMORY_INIT
+        startup_dma_zero_begin(entry->start, entry->end);
+        ++entry;
+    #endif
+    for(; entry < zero_table_end; ++entry)
+        memory_zero(entry->start, entry->end);
+    boot_timing_record(STARTUP_BOOT_PHASE_BSS_ZERO);
+
+    // Switch to the target system clock
+    startup_clock_end();
+    boot_timing_record(STARTUP_BOOT_PHASE_CLOCK_INIT);
 
     // Call external startup code before construtors call
-    startup_extension();
+    if(warm_boot)
+        warm_start_extension();
+    else
+        startup_extension();
+    boot_timing_record(STARTUP_BOOT_PHASE_STARTUP_EXTENSION);
+
+    // Wait for the DMA zeroing the .dma_bss (if enabled)
+    startup_dma_zero_wait();
+    boot_timing_record(STARTUP_BOOT_PHASE_BSS_WAIT);
+
+    // Start profiling of interrupts (if enabled)
+    vectors_profile();
+    // Set up the deferred work queue (if enabled)
+    deferred_work_setup();
 
     // Call constructors
     __libc_init_array();
+    boot_timing_record(STARTUP_BOOT_PHASE_INIT_ARRAY);
+
+    // Complete boot time measurement
+    boot_timing_finish();
 
     // Call the application's entry point
     main();
@@ -0,0 +1,202 @@
+/* ============================================================================================================================= *//**
+ * @file       clock.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 12:02:18 pm
+ * @modified   Saturday, 17th October 2026 12:02:18 pm
+ * @project    stm-utils
+ * @brief      Startup-time clock configuration (HSE + PLL) overlapped with memory initialization (STARTUP_CLOCK_INIT option)
+ * @details    startup_clock_begin() starts the HSE oscillator and the PLL before the reset handler initializes memory.
+ *    startup_clock_end() waits for the PLL lock afterwards and switches SYSCLK to the PLL. Configuration is taken from the
+ *    "Startup clock configuration" section of the hal_config.h
+ *    
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "device.h"
+#include "device/startup.h"
+#include "hal_config.h"
+
+/* ========================================================= Configuration ======================================================== */
+
+#if !defined(STM32MCU_MAJOR_TYPE_F2) && !defined(STM32MCU_MAJOR_TYPE_F4) && !defined(STM32MCU_MAJOR_TYPE_F7)
+#error "Startup clock initialization is supported for F2/F4/F7 devices only (disable STARTUP_CLOCK_INIT option)"
+#endif
+
+// Frequency of the system clock
+#define STARTUP_SYSCLK_VALUE (HSE_VALUE / STARTUP_PLL_M * STARTUP_PLL_N / STARTUP_PLL_P)
+// Frequency of the AHB clock
+#define STARTUP_HCLK_VALUE (STARTUP_SYSCLK_VALUE / STARTUP_AHB_DIVIDER)
+
+// Maximal frequency of the system clock of the device
+#if defined(STM32MCU_MAJOR_TYPE_F2)
+#define STARTUP_SYSCLK_MAX 120000000UL
+#elif defined(STM32F401xC) || defined(STM32F401xE)
+#define STARTUP_SYSCLK_MAX 84000000UL
+#elif defined(STM32F410Tx) || defined(STM32F410Cx) || defined(STM32F410Rx) || defined(STM32F411xE) || \
+      defined(STM32F412Cx) || defined(STM32F412Rx) || defined(STM32F412Vx) || defined(STM32F412Zx) || \
+      defined(STM32F413xx) || defined(STM32F423xx)
+#define STARTUP_SYSCLK_MAX 100000000UL
+#elif defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx)
+#define STARTUP_SYSCLK_MAX 168000000UL
+#elif defined(STM32MCU_MAJOR_TYPE_F4)
+#define STARTUP_SYSCLK_MAX 180000000UL
+#else
+#define STARTUP_SYSCLK_MAX 216000000UL
+#endif
+
+#if STARTUP_SYSCLK_VALUE > STARTUP_SYSCLK_MAX
+#error "Startup clock configuration exceeds the maximal SYSCLK frequency of the device (check STARTUP_PLL_x in hal_config.h)"
+#endif
+
+// Number of FLASH wait states for the target HCLK (one per 30 MHz in the 2.7V - 3.6V range)
+#ifndef STARTUP_FLASH_LATENCY
+#define STARTUP_FLASH_LATENCY ((STARTUP_HCLK_VALUE - 1UL) / 30000000UL)
+#endif
+
+// Frequency above which the over-drive mode is required
+#if defined(STM32MCU_MAJOR_TYPE_F7)
+#define STARTUP_OVERDRIVE_THRESHOLD 180000000UL
+#else
+#define STARTUP_OVERDRIVE_THRESHOLD 168000000UL
+#endif
+
+// Number of iterations of the PLL-lock polling loop corresponding to HSE_STARTUP_TIMEOUT [ms] (at least 4 cycles per iteration)
+#define STARTUP_CLOCK_TIMEOUT (HSE_STARTUP_TIMEOUT * (HSI_VALUE / 1000UL) / 4UL)
+
+/* ====================================================== Static definitions ====================================================== */
+
+/**
+ * @returns 
+ *    value of the RCC_CFGR_HPRE field corresponding to the AHB @p divider
+ */
+static inline unsigned long ahb_prescaler(unsigned long divider) {
+    switch(divider) {
+        case 2:   return 0x8UL << RCC_CFGR_HPRE_Pos;
+        case 4:   return 0x9UL << RCC_CFGR_HPRE_Pos;
+        case 8:   return 0xAUL << RCC_CFGR_HPRE_Pos;
+        case 16:  return 0xBUL << RCC_CFGR_HPRE_Pos;
+        case 64:  return 0xCUL << RCC_CFGR_HPRE_Pos;
+        case 128: return 0xDUL << RCC_CFGR_HPRE_Pos;
+        case 256: return 0xEUL << RCC_CFGR_HPRE_Pos;
+        case 512: return 0xFUL << RCC_CFGR_HPRE_Pos;
+        default:  return 0x0UL;
+    }
+}
+
+
+/**
+ * @returns 
+ *    value of the RCC_CFGR_PPREx field (shifted by @p shift) corresponding to the APB @p divider
+ */
+static inline unsigned long apb_prescaler(unsigned long divider, unsigned long shift) {
+    switch(divider) {
+        case 2:  return 0x4UL << shift;
+        case 4:  return 0x5UL << shift;
+        case 8:  return 0x6UL << shift;
+        case 16: return 0x7UL << shift;
+        default: return 0x0UL;
+    }
+}
+
+
+/**
+ * @brief Enables over-drive mode of the voltage regulator if required by the target frequency
+ * 
+ * @note Over-drive needs to be enabled when the PLL is already locked but before the flash latency is raised and the system
+ *    clock is switched to it (RM0090)
+ */
+static inline void enable_overdrive(void) {
+
+    #if defined(PWR_CR_ODEN)
+        if(STARTUP_SYSCLK_VALUE > STARTUP_OVERDRIVE_THRESHOLD) {
+            PWR->CR |= PWR_CR_ODEN;
+            while(!(PWR->CSR & PWR_CSR_ODRDY));
+            PWR->CR |= PWR_CR_ODSWEN;
+            while(!(PWR->CSR & PWR_CSR_ODSWRDY));
+        }
+    #elif defined(PWR_CR1_ODEN)
+        if(STARTUP_SYSCLK_VALUE > STARTUP_OVERDRIVE_THRESHOLD) {
+            PWR->CR1 |= PWR_CR1_ODEN;
+            while(!(PWR->CSR1 & PWR_CSR1_ODRDY));
+            PWR->CR1 |= PWR_CR1_ODSWEN;
+            while(!(PWR->CSR1 & PWR_CSR1_ODSWRDY));
+        }
+    #endif
+}
+
+/* ========================================================== Definitions ========================================================= */
+
+void startup_clock_begin(void) {
+
+    // Skip configuration if the PLL has been already started (e.g. by the bootloader)
+    if(RCC->CR & RCC_CR_PLLON)
+        return;
+
+    // Select the voltage scale 1 (required by the maximal frequencies)
+    RCC->APB1ENR |= RCC_APB1ENR_PWREN;
+    (void) RCC->APB1ENR;
+    #if defined(PWR_CR_VOS)
+        PWR->CR |= PWR_CR_VOS;
+    #elif defined(PWR_CR1_VOS)
+        PWR->CR1 |= PWR_CR1_VOS;
+    #endif
+
+    // Start HSE
+    #if (STARTUP_HSE_BYPASS == 1U)
+        RCC->CR |= RCC_CR_HSEBYP;
+    #endif
+    RCC->CR |= RCC_CR_HSEON;
+
+    // Configure PLL
+    RCC->PLLCFGR = 
+        RCC_PLLCFGR_PLLSRC_HSE                                  |
+        (STARTUP_PLL_M                  << RCC_PLLCFGR_PLLM_Pos) |
+        (STARTUP_PLL_N                  << RCC_PLLCFGR_PLLN_Pos) |
+        (((STARTUP_PLL_P >> 1UL) - 1UL) << RCC_PLLCFGR_PLLP_Pos) |
+        (STARTUP_PLL_Q                  << RCC_PLLCFGR_PLLQ_Pos);
+
+    // Start PLL right away (HSE clock is not released by the RCC until the oscillator is stable, so PLL starts to lock
+    // as soon as HSE is ready)
+    RCC->CR |= RCC_CR_PLLON;
+}
+
+
+void startup_clock_end(void) {
+
+    // Switch system clock to PLL (if not done yet)
+    if((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_PLL) {
+
+        // Wait for the PLL lock
+        unsigned long timeout = STARTUP_CLOCK_TIMEOUT;
+        while(!(RCC->CR & RCC_CR_PLLRDY) && (--timeout != 0));
+
+        // On failure, keep running from HSI
+        if(timeout != 0) {
+
+            // Enable over-drive (if needed)
+            enable_overdrive();
+
+            // Set FLASH latency before increasing frequency
+            FLASH->ACR = (FLASH->ACR & ~FLASH_ACR_LATENCY) | (STARTUP_FLASH_LATENCY << FLASH_ACR_LATENCY_Pos);
+            while((FLASH->ACR & FLASH_ACR_LATENCY) != (STARTUP_FLASH_LATENCY << FLASH_ACR_LATENCY_Pos));
+
+            // Set bus prescalers
+            RCC->CFGR = (RCC->CFGR & ~(RCC_CFGR_HPRE | RCC_CFGR_PPRE1 | RCC_CFGR_PPRE2)) |
+                ahb_prescaler(STARTUP_AHB_DIVIDER)                        |
+                apb_prescaler(STARTUP_APB1_DIVIDER, RCC_CFGR_PPRE1_Pos)   |
+                apb_prescaler(STARTUP_APB2_DIVIDER, RCC_CFGR_PPRE2_Pos);
+
+            // Switch system clock
+            RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW) | RCC_CFGR_SW_PLL;
+            while((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_PLL);
+        }
+    }
+
+    // Update the SystemCoreClock variable
+    SystemCoreClockUpdate();
+}
+
+/* ================================================================================================================================ */
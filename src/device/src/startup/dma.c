@@ -0,0 +1,299 @@
+/* ============================================================================================================================= *//**
+ * @file       dma.c
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 1:14:05 pm
+ * @modified   Saturday, 17th October 2026 1:14:05 pm
+ * @project    stm-utils
+ * @brief      Background zeroing of the .dma_bss section with a memory-to-memory DMA transfer (STARTUP_DMA_MEMORY_INIT option)
+ * @details    The transfer uses DMA2 Stream 0 on F2/F4/F7 devices, MDMA Channel 0 on H7 devices and DMA1 Channel 1 on
+ *    devices equipped with the channel-based DMA controller (e.g. G4, L4, WB, WL). The range is split into the 32-byte
+ *    aligned part zeroed by the DMA (so that no cache line and no DMA burst is shared with neighbouring data) and the
+ *    edges zeroed by the CPU. Only the first chunk of the transfer is started by startup_dma_zero_begin(), the
+ *    remaining ones are chained by startup_dma_zero_wait()
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+/* =========================================================== Includes =========================================================== */
+
+#include "device.h"
+#include "device/startup.h"
+
+/* ========================================================= Configuration ======================================================== */
+
+#if defined(DMA2_Stream0)
+
+// Maximal size of the single transfer (NDTR counts 32-bit items)
+#define DMA_MAX_CHUNK ((0xFFFFUL * 4UL) & ~31UL)
+
+#elif defined(MDMA_Channel0)
+
+// Size of the MDMA block (the transfer is composed of up to 4096 repeated blocks)
+#define DMA_BLOCK_SIZE 0x10000UL
+// Maximal number of blocks of the single transfer
+#define DMA_MAX_BLOCKS 0x1000UL
+
+#elif defined(DMA1_Channel1) && defined(DMA_CCR_MEM2MEM)
+
+// Maximal size of the single transfer (CNDTR counts 32-bit items)
+#define DMA_MAX_CHUNK ((0xFFFFUL * 4UL) & ~31UL)
+
+#else
+#error "Target device does not provide memory-to-memory DMA supported by the startup code (disable STARTUP_DMA_MEMORY_INIT option)"
+#endif
+
+// Alignment of the range zeroed by the DMA
+#define DMA_ALIGNMENT 32UL
+
+/* ======================================================= Static variables ======================================================= */
+
+// Source word of the transfer
+static const unsigned long zero = 0;
+
+// Start of the range zeroed by the DMA (the state lives in .noinit as it is set before the .bss is zeroed)
+STM_NOINIT static unsigned long *dma_start;
+// Start of the part of the range that has not been scheduled yet
+STM_NOINIT static unsigned long *dma_cursor;
+// End of the range zeroed by the DMA
+STM_NOINIT static unsigned long *dma_end;
+// Size of the transfer in progress [byte] (0 if no transfer is pending)
+STM_NOINIT static unsigned long dma_chunk;
+
+/* ====================================================== Static definitions ====================================================== */
+
+/**
+ * @brief Zeroes [@p dst, @p end) range with the CPU
+ */
+static inline void cpu_zero(unsigned long *dst, const unsigned long *end) {
+    while(dst < end)
+        *(dst++) = 0;
+}
+
+
+/**
+ * @brief Enables clock of the DMA controller
+ */
+static inline void dma_enable(void) {
+
+    #if defined(DMA2_Stream0)
+        RCC->AHB1ENR |= RCC_AHB1ENR_DMA2EN;
+        (void) RCC->AHB1ENR;
+    #elif defined(MDMA_Channel0)
+        RCC->AHB3ENR |= RCC_AHB3ENR_MDMAEN;
+        (void) RCC->AHB3ENR;
+    #elif defined(RCC_AHB1ENR_DMA1EN)
+        RCC->AHB1ENR |= RCC_AHB1ENR_DMA1EN;
+        (void) RCC->AHB1ENR;
+    #elif defined(RCC_AHBENR_DMA1EN)
+        RCC->AHBENR |= RCC_AHBENR_DMA1EN;
+        (void) RCC->AHBENR;
+    #elif defined(RCC_AHBENR_DMAEN)
+        RCC->AHBENR |= RCC_AHBENR_DMAEN;
+        (void) RCC->AHBENR;
+    #endif
+}
+
+
+/**
+ * @brief Starts the transfer of the next chunk of the range
+ */
+static void dma_start_chunk(void) {
+
+    unsigned long size = (unsigned long) dma_end - (unsigned long) dma_cursor;
+
+    #if defined(DMA2_Stream0)
+
+        // Limit size of the chunk
+        dma_chunk = (size > DMA_MAX_CHUNK) ? DMA_MAX_CHUNK : size;
+
+        // Reset the stream
+        DMA2_Stream0->CR = 0;
+        while(DMA2_Stream0->CR & DMA_SxCR_EN);
+        DMA2->LIFCR = DMA_LIFCR_CFEIF0 | DMA_LIFCR_CDMEIF0 | DMA_LIFCR_CTEIF0 | DMA_LIFCR_CHTIF0 | DMA_LIFCR_CTCIF0;
+
+        // Configure transfer (fixed source word, incremented destination, 4-beat bursts through the FIFO)
+        DMA2_Stream0->PAR  = (unsigned long) &zero;
+        DMA2_Stream0->M0AR = (unsigned long) dma_cursor;
+        DMA2_Stream0->NDTR = dma_chunk / 4UL;
+        DMA2_Stream0->FCR  = DMA_SxFCR_DMDIS | DMA_SxFCR_FTH;
+
+        // Start transfer
+        DMA2_Stream0->CR =
+            DMA_SxCR_DIR_1   |
+            DMA_SxCR_MINC    |
+            DMA_SxCR_PSIZE_1 |
+            DMA_SxCR_MSIZE_1 |
+            DMA_SxCR_MBURST_0 |
+            DMA_SxCR_PL      |
+            DMA_SxCR_EN;
+
+    #elif defined(MDMA_Channel0)
+
+        // Transfer whole blocks if possible (the remainder is transferred as a single block in the next chunk)
+        unsigned long blocks = size / DMA_BLOCK_SIZE;
+        if(blocks > DMA_MAX_BLOCKS)
+            blocks = DMA_MAX_BLOCKS;
+        dma_chunk = (blocks == 0) ? size : (blocks * DMA_BLOCK_SIZE);
+
+        // Reset the channel
+        MDMA_Channel0->CCR = 0;
+        MDMA_Channel0->CIFCR =
+            MDMA_CIFCR_CTEIF | MDMA_CIFCR_CCTCIF | MDMA_CIFCR_CBRTIF | MDMA_CIFCR_CBTIF | MDMA_CIFCR_CLTCIF;
+
+        // Configure software-triggered repeated-block transfer (fixed source word, incremented destination, 8-beat bursts)
+        MDMA_Channel0->CTCR =
+            MDMA_CTCR_SWRM                     |
+            MDMA_CTCR_TRGM_1                   |
+            (127UL << MDMA_CTCR_TLEN_Pos)      |
+            MDMA_CTCR_DBURST_0                 |
+            MDMA_CTCR_DBURST_1                 |
+            MDMA_CTCR_DINCOS_1                 |
+            MDMA_CTCR_SINCOS_1                 |
+            MDMA_CTCR_DSIZE_1                  |
+            MDMA_CTCR_SSIZE_1                  |
+            MDMA_CTCR_DINC_1;
+        MDMA_Channel0->CBNDTR =
+            (((blocks == 0) ? dma_chunk : DMA_BLOCK_SIZE) << MDMA_CBNDTR_BNDT_Pos) |
+            (((blocks == 0) ? 0 : (blocks - 1UL))            << MDMA_CBNDTR_BRC_Pos);
+        MDMA_Channel0->CSAR  = (unsigned long) &zero;
+        MDMA_Channel0->CDAR  = (unsigned long) dma_cursor;
+        MDMA_Channel0->CBRUR = 0;
+        MDMA_Channel0->CLAR  = 0;
+
+        // Select AHB bus for the destination in DTCM
+        MDMA_Channel0->CTBR =
+            ((unsigned long) dma_cursor >= D1_DTCMRAM_BASE && (unsigned long) dma_cursor < D1_AXISRAM_BASE) ?
+                MDMA_CTBR_DBUS : 0;
+
+        // Start transfer
+        MDMA_Channel0->CCR = MDMA_CCR_PL | MDMA_CCR_EN;
+        MDMA_Channel0->CCR |= MDMA_CCR_SWRQ;
+
+    #else
+
+        // Limit size of the chunk
+        dma_chunk = (size > DMA_MAX_CHUNK) ? DMA_MAX_CHUNK : size;
+
+        // Reset the channel
+        DMA1_Channel1->CCR = 0;
+        DMA1->IFCR = DMA_IFCR_CGIF1;
+
+        // Configure transfer (fixed source word, incremented destination)
+        DMA1_Channel1->CPAR  = (unsigned long) &zero;
+        DMA1_Channel1->CMAR  = (unsigned long) dma_cursor;
+        DMA1_Channel1->CNDTR = dma_chunk / 4UL;
+
+        // Start transfer
+        DMA1_Channel1->CCR =
+            DMA_CCR_MEM2MEM |
+            DMA_CCR_PL      |
+            DMA_CCR_MINC    |
+            DMA_CCR_PSIZE_1 |
+            DMA_CCR_MSIZE_1 |
+            DMA_CCR_EN;
+
+    #endif
+}
+
+
+/**
+ * @brief Waits for the transfer in progress
+ *
+ * @returns
+ *    @c true if the transfer has succeeded \n
+ *    @c false otherwise
+ */
+static bool dma_wait_chunk(void) {
+
+    #if defined(DMA2_Stream0)
+
+        while(!(DMA2->LISR & (DMA_LISR_TCIF0 | DMA_LISR_TEIF0)));
+        bool success = !(DMA2->LISR & DMA_LISR_TEIF0);
+
+        // Disable stream
+        DMA2_Stream0->CR = 0;
+        DMA2->LIFCR = DMA_LIFCR_CFEIF0 | DMA_LIFCR_CDMEIF0 | DMA_LIFCR_CTEIF0 | DMA_LIFCR_CHTIF0 | DMA_LIFCR_CTCIF0;
+
+    #elif defined(MDMA_Channel0)
+
+        while(!(MDMA_Channel0->CISR & (MDMA_CISR_CTCIF | MDMA_CISR_TEIF)));
+        bool success = !(MDMA_Channel0->CISR & MDMA_CISR_TEIF);
+
+        // Disable channel
+        MDMA_Channel0->CCR = 0;
+        MDMA_Channel0->CIFCR =
+            MDMA_CIFCR_CTEIF | MDMA_CIFCR_CCTCIF | MDMA_CIFCR_CBRTIF | MDMA_CIFCR_CBTIF | MDMA_CIFCR_CLTCIF;
+
+    #else
+
+        while(!(DMA1->ISR & (DMA_ISR_TCIF1 | DMA_ISR_TEIF1)));
+        bool success = !(DMA1->ISR & DMA_ISR_TEIF1);
+
+        // Disable channel
+        DMA1_Channel1->CCR = 0;
+        DMA1->IFCR = DMA_IFCR_CGIF1;
+
+    #endif
+
+    return success;
+}
+
+/* ========================================================== Definitions ========================================================= */
+
+void startup_dma_zero_begin(unsigned long *start, unsigned long *end) {
+
+    // Find range aligned to the cache line
+    unsigned long *aligned_start = (unsigned long *) (((unsigned long) start + DMA_ALIGNMENT - 1UL) & ~(DMA_ALIGNMENT - 1UL));
+    unsigned long *aligned_end   = (unsigned long *) (((unsigned long) end) & ~(DMA_ALIGNMENT - 1UL));
+
+    // Zero small ranges with the CPU
+    if(aligned_start >= aligned_end) {
+        cpu_zero(start, end);
+        dma_chunk = 0;
+        return;
+    }
+
+    // Zero edges with the CPU
+    cpu_zero(start, aligned_start);
+    cpu_zero(aligned_end, end);
+
+    // Start the first transfer
+    dma_start  = aligned_start;
+    dma_cursor = aligned_start;
+    dma_end    = aligned_end;
+    dma_enable();
+    dma_start_chunk();
+}
+
+
+void startup_dma_zero_wait(void) {
+
+    // Check whether anything is pending
+    if(dma_chunk == 0)
+        return;
+
+    // Transfer subsequent chunks
+    while(true) {
+
+        // On failure, zero the chunk with the CPU
+        if(!dma_wait_chunk())
+            cpu_zero(dma_cursor, (unsigned long *) ((unsigned long) dma_cursor + dma_chunk));
+
+        // Start the next chunk (if any left)
+        dma_cursor = (unsigned long *) ((unsigned long) dma_cursor + dma_chunk);
+        if(dma_cursor >= dma_end)
+            break;
+        dma_start_chunk();
+    }
+
+    dma_chunk = 0;
+
+    // Drop cache lines that might have been speculatively loaded before the DMA has written the range (Cortex-M7)
+    #if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        if(SCB->CCR & SCB_CCR_DC_Msk)
+            SCB_InvalidateDCache_by_Addr(dma_start, (int32_t) ((unsigned long) dma_end - (unsigned long) dma_start));
+    #endif
+}
+
+/* ================================================================================================================================ */
@@ -0,0 +1,116 @@
+/* ============================================================================================================================= *//**
+ * @file       memory.h
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Saturday, 17th October 2026 10:24:51 pm
+ * @modified   Saturday, 17th October 2026 10:24:51 pm
+ * @project    stm-utils
+ * @brief      Private memory initialization routines of the startup code (shared with the memory_copy benchmark)
+ * @details    Routines are required to be inlined into the reset handler as they run before the .data and .bss sections
+ *    are initialized. Burst variants (STARTUP_BURST_MEMORY_INIT option) move 16 bytes per iteration with a single
+ *    LDM/STM pair and are available on ARMv7-M and ARMv8-M Mainline cores only. On Cortex-M7 aligned register pairs are
+ *    transferred by the LSU as 64-bit accesses (full ECC words of the AXI SRAM)
+ *
+ * @copyright Krzysztof Pierczyk © 2026
+ * /// ============================================================================================================================ */
+
+#ifndef __STM_UTILS_STARTUP_MEMORY_H__
+#define __STM_UTILS_STARTUP_MEMORY_H__
+
+/* ========================================================= Configuration ======================================================== */
+
+// Burst routines require LDM/STM with writeback for arbitrary registers (ARMv7-M and ARMv8-M Mainline)
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#define STARTUP_BURST_SUPPORTED
+#endif
+
+/* ========================================================== Definitions ========================================================= */
+
+/**
+ * @brief Copies words from @p src into the [@p dst, @p end) range word by word
+ */
+__attribute__ ((always_inline))
+static inline void memory_copy_words(const unsigned long *src, unsigned long *dst, const unsigned long *end) {
+    while(dst < end)
+        *(dst++) = *(src++);
+}
+
+
+/**
+ * @brief Fills the [@p dst, @p end) range with zeros word by word
+ */
+__attribute__ ((always_inline))
+static inline void memory_zero_words(unsigned long *dst, const unsigned long *end) {
+    while(dst < end)
+        *(dst++) = 0;
+}
+
+
+#ifdef STARTUP_BURST_SUPPORTED
+
+/**
+ * @brief Copies words from @p src into the [@p dst, @p end) range using 16-byte LDM/STM bursts
+ *
+ * @note Both ranges are required to be aligned to 8 bytes
+ */
+__attribute__ ((always_inline))
+static inline void memory_copy_burst(const unsigned long *src, unsigned long *dst, const unsigned long *end) {
+
+    // Size of the range in bytes
+    unsigned long size = (unsigned long) end - (unsigned long) dst;
+
+    // Copy 16-byte blocks and the (optional) trailing 8-byte block
+    __asm volatile (
+        "    b      2f                    \n"
+        "1:  ldmia  %[src]!, {r3-r6}      \n"
+        "    stmia  %[dst]!, {r3-r6}      \n"
+        "2:  subs   %[size], %[size], #16 \n"
+        "    bhs    1b                    \n"
+        "    tst    %[size], #8           \n"
+        "    beq    3f                    \n"
+        "    ldmia  %[src]!, {r3-r4}      \n"
+        "    stmia  %[dst]!, {r3-r4}      \n"
+        "3:                               \n"
+        : [src] "+r" (src), [dst] "+r" (dst), [size] "+r" (size)
+        :
+        : "r3", "r4", "r5", "r6", "cc", "memory"
+    );
+}
+
+
+/**
+ * @brief Fills the [@p dst, @p end) range with zeros using 16-byte STM bursts
+ *
+ * @note The range is required to be aligned to 8 bytes
+ */
+__attribute__ ((always_inline))
+static inline void memory_zero_burst(unsigned long *dst, const unsigned long *end) {
+
+    // Size of the range in bytes
+    unsigned long size = (unsigned long) end - (unsigned long) dst;
+
+    // Zero 16-byte blocks and the (optional) trailing 8-byte block
+    __asm volatile (
+        "    movs   r3, #0                \n"
+        "    movs   r4, #0                \n"
+        "    movs   r5, #0                \n"
+        "    movs   r6, #0                \n"
+        "    b      2f                    \n"
+        "1:  stmia  %[dst]!, {r3-r6}      \n"
+        "2:  subs   %[size], %[size], #16 \n"
+        "    bhs    1b                    \n"
+        "    tst    %[size], #8           \n"
+        "    beq    3f                    \n"
+        "    stmia  %[dst]!, {r3-r4}      \n"
+        "3:                               \n"
+        : [dst] "+r" (dst), [size] "+r" (size)
+        :
+        : "r3", "r4", "r5", "r6", "cc", "memory"
+    );
+}
+
+#endif
+
+/* ================================================================================================================================ */
+
+#endif
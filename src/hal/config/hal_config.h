@@ -27,18 +27,42 @@
 
 // Information about RTOS usage
 #define USE_RTOS 0U
+
+// Flash accelerators configuration (enabled if the `performance` PERFORMANCE_PROFILE is selected)
+#ifdef STM_UTILS_PERFORMANCE_PROFILE
+
+// FLASH prefetch enable flag
+#define PREFETCH_ENABLE 1U
+// Instruction cache enable flag
+#define INSTRUCTION_CACHE_ENABLE 1U
+// Data cache enable flag
+#define DATA_CACHE_ENABLE 1U
+// ART accelerator enable flag (F7 device-specific)
+#define ART_ACCELERATOR_ENABLE 1U
+
+// FLASH preread enable flag (L0 device-specific)
+#define PREREAD_ENABLE 1U
+// FLASH buffer cache enable flag (L0 device-specific)
+#define BUFFER_CACHE_DISABLE 0U
+
+#else
+
 // FLASH prefetch enable flag
 #define PREFETCH_ENABLE 0U
 // Instruction cache enable flag
 #define INSTRUCTION_CACHE_ENABLE 0U
 // Data cache enable flag
 #define DATA_CACHE_ENABLE 0U
+// ART accelerator enable flag (F7 device-specific)
+#define ART_ACCELERATOR_ENABLE 0U
 
 // FLASH preread enable flag (L0 device-specific)
 #define PREREAD_ENABLE 0U
 // FLASH buffer cache enable flag (L0 device-specific)
 #define BUFFER_CACHE_DISABLE 0U
 
+#endif
+
 /* ================================================== System clocks' informations ================================================= */
 
 // Speed of the External High-Speed oscillator in [Hz]
@@ -74,6 +98,47 @@
 // Value of the SAI2 External clock source in [Hz]
 #define EXTERNAL_SAI2_CLOCK_VALUE 48000UL
 
+/* ================================================== Startup clock configuration ================================================= */
+
+/**
+ * @note The following values are used by the startup code if the STARTUP_CLOCK_INIT option is enabled (F2/F4/F7 devices).
+ *    In such a case the PLL is driven by the HSE oscillator and SYSCLK = HSE_VALUE / STARTUP_PLL_M * STARTUP_PLL_N / 
+ *    STARTUP_PLL_P
+ */
+
+// Use external clock source instead of crystal (HSE bypass)
+#define STARTUP_HSE_BYPASS 0U
+// PLL input divider (HSE_VALUE / STARTUP_PLL_M should lie in 1-2 MHz range)
+#define STARTUP_PLL_M 8U
+// PLL multiplier and dividers of the system clock (2, 4, 6 or 8) and the USB/SDIO/RNG clock (default SYSCLK is the
+// highest frequency allowed by the device that keeps the USB clock at 48 MHz)
+#if defined(STM32MCU_MAJOR_TYPE_F2)
+#define STARTUP_PLL_N 240U
+#define STARTUP_PLL_P 2U
+#define STARTUP_PLL_Q 5U
+#elif defined(STM32F401xC) || defined(STM32F401xE)
+#define STARTUP_PLL_N 336U
+#define STARTUP_PLL_P 4U
+#define STARTUP_PLL_Q 7U
+#elif defined(STM32F410Tx) || defined(STM32F410Cx) || defined(STM32F410Rx) || defined(STM32F411xE) || \
+      defined(STM32F412Cx) || defined(STM32F412Rx) || defined(STM32F412Vx) || defined(STM32F412Zx) || \
+      defined(STM32F413xx) || defined(STM32F423xx)
+#define STARTUP_PLL_N 384U
+#define STARTUP_PLL_P 4U
+#define STARTUP_PLL_Q 8U
+#else
+#define STARTUP_PLL_N 336U
+#define STARTUP_PLL_P 2U
+#define STARTUP_PLL_Q 7U
+#endif
+
+// AHB clock divider (1, 2, 4, 8, 16, 64, 128, 256 or 512)
+#define STARTUP_AHB_DIVIDER 1U
+// APB1 clock divider (1, 2, 4, 8 or 16)
+#define STARTUP_APB1_DIVIDER 4U
+// APB2 clock divider (1, 2, 4, 8 or 16)
+#define STARTUP_APB2_DIVIDER 2U
+
 /* ==================================================== Ethernet configuration ==================================================== */
 
 /* ------------- Section 1 : Ethernet peripheral configuration ------------- */